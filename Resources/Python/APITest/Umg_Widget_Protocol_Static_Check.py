@@ -57,6 +57,9 @@ def main() -> None:
     hidden_tools = {
         "check_widget_overlap",
         "export_umg_to_json",
+        "diff_umg",
+        "export_umg_snapshot",
+        "apply_umg_snapshot",
         "apply_json_to_umg",
         "apply_html_to_umg",
     }
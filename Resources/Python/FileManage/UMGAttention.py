@@ -11,6 +11,8 @@ class UMGAttention:
         Gets the asset path of the current target UMG asset.
         If a target is explicitly set, it returns that target.
         Otherwise, it falls back to the last edited UMG asset.
+        The response's "prefetch" object reports the background loading of
+        the target's dependencies started by set_target_umg_asset.
         """
         return self.client.send_command("get_target_umg_asset")
 
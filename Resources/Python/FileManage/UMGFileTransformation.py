@@ -9,13 +9,14 @@ class UMGFileTransformation:
         """Initializes the client for sending commands to Unreal Engine."""
         self.client = client
 
-    def export_umg_to_json(self, asset_path: str, widget_name: Optional[str] = None) -> Dict[str, Any]:
+    def export_umg_to_json(self, asset_path: str, widget_name: Optional[str] = None, include_hashes: bool = False) -> Dict[str, Any]:
         """
         'Decompiles' a UMG .uasset file into a JSON object.
 
         Args:
             asset_path: The asset path of the UMG widget to export.
             widget_name: Optional. The name of the specific widget to export (default "Root").
+            include_hashes: Optional. Adds "hash" and "content_hash" to every widget node, for diff_umg.
 
         Returns:
             A dictionary containing the result of the operation.
@@ -23,9 +24,68 @@ class UMGFileTransformation:
         payload = {'asset_path': asset_path}
         if widget_name:
             payload['widget_name'] = widget_name
+        if include_hashes:
+            payload['include_hashes'] = True
         return self.client.send_command('export_umg_to_json', payload)
 
-    def apply_json_to_umg(self, asset_path: str, json_data: Dict[str, Any], widget_name: Optional[str] = None) -> Dict[str, Any]:
+    def diff_umg(self, asset_path: str, baseline: Any, widget_name: Optional[str] = None) -> Dict[str, Any]:
+        """
+        Compares a stored export (made with include_hashes) against the live UMG asset.
+
+        Args:
+            asset_path: The asset path of the UMG widget to compare.
+            baseline: The stored export, as its JSON text or as a parsed dictionary.
+            widget_name: Optional. The widget to compare (default: the baseline root's widget_name).
+
+        Returns:
+            A dictionary with "unchanged" and the list of "changes".
+        """
+        if not isinstance(baseline, str):
+            baseline = json.dumps(baseline)
+        payload = {'asset_path': asset_path, 'baseline': baseline}
+        if widget_name:
+            payload['widget_name'] = widget_name
+        return self.client.send_command('diff_umg', payload)
+
+    def export_umg_snapshot(self, asset_path: str, widget_name: Optional[str] = None, file_path: Optional[str] = None) -> Dict[str, Any]:
+        """
+        Writes a widget subtree to a binary snapshot file, for stamping it into other assets with apply_umg_snapshot.
+
+        Args:
+            asset_path: The asset path of the UMG widget to snapshot.
+            widget_name: Optional. The root of the subtree (default "Root").
+            file_path: Optional. Output file (default: Saved/UmgMcp/Snapshots/<package path>/<widget>.umgsnap).
+
+        Returns:
+            A dictionary with the written "file_path" and the snapshot sizes.
+        """
+        payload = {'asset_path': asset_path}
+        if widget_name:
+            payload['widget_name'] = widget_name
+        if file_path:
+            payload['file_path'] = file_path
+        return self.client.send_command('export_umg_snapshot', payload)
+
+    def apply_umg_snapshot(self, file_path: str, asset_path: Optional[str] = None, widget_name: Optional[str] = None) -> Dict[str, Any]:
+        """
+        Creates the widgets of a binary snapshot under a widget of a UMG asset.
+
+        Args:
+            file_path: The snapshot file written by export_umg_snapshot.
+            asset_path: Optional. The asset to stamp into (default: the current target asset).
+            widget_name: Optional. The panel that receives the snapshot root (default "Root").
+
+        Returns:
+            A dictionary with "root_widget", "widgets_created" and any "renamed" widgets.
+        """
+        payload = {'file_path': file_path}
+        if asset_path:
+            payload['asset_path'] = asset_path
+        if widget_name:
+            payload['widget_name'] = widget_name
+        return self.client.send_command('apply_umg_snapshot', payload)
+
+    def apply_json_to_umg(self, asset_path: str, json_data: Dict[str, Any], widget_name: Optional[str] = None, mode: Optional[str] = None) -> Dict[str, Any]:
         """
         'Compiles' a JSON object into a UMG .uasset file, creating or modifying it.
 
@@ -33,6 +93,8 @@ class UMGFileTransformation:
             asset_path: The asset path of the UMG widget to apply the JSON to.
             json_data: The dictionary representing the UMG data.
             widget_name: Optional. The name of the specific widget to replace (default "Root").
+            mode: Optional. "merge" (default) upserts append-only; "reconcile" diffs the target subtree against
+                  json_data by widget name and creates, removes, moves or writes only what differs.
 
         Returns:
             A dictionary containing the result of the operation.
@@ -43,4 +105,6 @@ class UMGFileTransformation:
         payload = {'asset_path': asset_path, 'json_data': json_string_for_cpp}
         if widget_name:
             payload['widget_name'] = widget_name
+        if mode:
+            payload['mode'] = mode
         return self.client.send_command('apply_json_to_umg', payload)
\ No newline at end of file
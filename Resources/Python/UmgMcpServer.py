@@ -496,17 +496,18 @@ async def get_creatable_widget_types() -> Dict[str, Any]:
     """
     (Description loaded from prompts.json)
     """
-    # Per user instruction, return a philosophical guide instead of a fixed list.
-    # This encourages the AI to experiment based on its knowledge.
-    return {
-        "status": "success",
-        "result": {
-            "status": "info",
-            "data": {
-                "message": "Theoretically, any UMG widget class can be created. In practice, it depends on the AI's knowledge of valid class names and requires trial and error. Start with common types like 'Button', 'TextBlock', 'Image', 'CanvasPanel', 'VerticalBox'."
-            }
-        }
-    }
+    conn = get_unreal_connection()
+    umg_get_client = UMGGet.UMGGet(conn)
+    return await umg_get_client.list_widget_classes(include_abstract=False)
+
+@register_tool("list_widget_classes", "Lists indexed widget classes.")
+async def list_widget_classes(filter: str = "", include_abstract: bool = False, include_blueprints: bool = True, panels_only: bool = False) -> Dict[str, Any]:
+    """
+    (Description loaded from prompts.json)
+    """
+    conn = get_unreal_connection()
+    umg_get_client = UMGGet.UMGGet(conn)
+    return await umg_get_client.list_widget_classes(filter, include_abstract, include_blueprints, panels_only)
 
 # =============================================================================
 #  Category: Attention & Context
@@ -674,7 +675,7 @@ async def set_target_blueprint_asset(asset_path: str) -> Dict[str, Any]:
 # =============================================================================
 
 @register_tool("get_widget_tree", "Fetches a compact widget tree from the focused widget target, or root if no widget is focused.")
-async def get_widget_tree() -> Dict[str, Any]:
+async def get_widget_tree(since_revision: Optional[int] = None, max_depth: Optional[int] = None, max_nodes: Optional[int] = None, cursor: Optional[str] = None) -> Dict[str, Any]:
     """
     (Description loaded from prompts.json)
     """
@@ -686,7 +687,7 @@ async def get_widget_tree() -> Dict[str, Any]:
     # or just let the plugin handle it.
     # Given the user's strong preference for implicit defaults, we just call the method.
     
-    return await umg_get_client.get_widget_tree()
+    return await umg_get_client.get_widget_tree(since_revision, max_depth, max_nodes, cursor)
 
 @register_tool("query_widget_properties", "Queries specific properties of a widget.")
 async def query_widget_properties(widget_name: str, properties: List[str]) -> Dict[str, Any]:
@@ -698,13 +699,22 @@ async def query_widget_properties(widget_name: str, properties: List[str]) -> Di
     return await umg_get_client.query_widget_properties(widget_name, properties)
 
 @register_tool("get_layout_data", "Gets bounding boxes for widgets.")
-async def get_layout_data(resolution_width: int = 1920, resolution_height: int = 1080) -> Dict[str, Any]:
+async def get_layout_data(resolution_width: int = 1920, resolution_height: int = 1080, dpi_scale: float = 1.0, resolutions: Optional[List[Dict[str, Any]]] = None) -> Dict[str, Any]:
     """
     (Description loaded from prompts.json)
     """
     conn = get_unreal_connection()
     umg_get_client = UMGGet.UMGGet(conn)
-    return await umg_get_client.get_layout_data(resolution_width, resolution_height)
+    return await umg_get_client.get_layout_data(resolution_width, resolution_height, dpi_scale, resolutions)
+
+@register_tool("layout_sweep", "Lays widgets out at many viewports and DPI scales in one call.")
+async def layout_sweep(viewports: Optional[List[List[int]]] = None, dpi_scales: Optional[List[float]] = None, resolutions: Optional[List[Dict[str, Any]]] = None) -> Dict[str, Any]:
+    """
+    (Description loaded from prompts.json)
+    """
+    conn = get_unreal_connection()
+    umg_get_client = UMGGet.UMGGet(conn)
+    return await umg_get_client.layout_sweep(viewports, dpi_scales, resolutions)
 
 @register_tool("check_widget_overlap", "Checks for widget overlap.")
 async def check_widget_overlap(widget_names: Optional[List[str]] = None) -> Dict[str, Any]:
@@ -735,6 +745,15 @@ async def create_widget(widget_type: str, new_widget_name: str, parent_name: str
         
     return result
 
+@register_tool("create_widget_subtree", "Creates a nested widget subtree in one call.")
+async def create_widget_subtree(tree: Any, parent_name: str = "") -> Dict[str, Any]:
+    """
+    (Description loaded from prompts.json)
+    """
+    conn = get_unreal_connection()
+    umg_set_client = UMGSet.UMGSet(conn)
+    return await umg_set_client.create_widget_subtree(tree, parent_name)
+
 @register_tool("set_widget_properties", "Sets properties on a widget.")
 async def set_widget_properties(widget_name: str, properties: Dict[str, Any]) -> Dict[str, Any]:
     """
@@ -785,14 +804,45 @@ async def save_asset() -> Dict[str, Any]:
 # =============================================================================
 
 @register_tool("export_umg_to_json", "Decompiles UMG to JSON.")
-async def export_umg_to_json(asset_path: str, widget_name: str = "Root") -> Dict[str, Any]:
+async def export_umg_to_json(asset_path: str, widget_name: str = "Root", include_hashes: bool = False) -> Dict[str, Any]:
+    """
+    (Description loaded from prompts.json)
+    """
+    asset_path = normalize_project_path(asset_path)
+    conn = get_unreal_connection()
+    umg_file_client = UMGFileTransformation.UMGFileTransformation(conn)
+    return await umg_file_client.export_umg_to_json(asset_path, widget_name, include_hashes)
+
+@register_tool("diff_umg", "Compares a hashed UMG JSON export against the live asset.")
+async def diff_umg(asset_path: str, baseline: str, widget_name: Optional[str] = None) -> Dict[str, Any]:
+    """
+    (Description loaded from prompts.json)
+    """
+    asset_path = normalize_project_path(asset_path)
+    conn = get_unreal_connection()
+    umg_file_client = UMGFileTransformation.UMGFileTransformation(conn)
+    return await umg_file_client.diff_umg(asset_path, baseline, widget_name)
+
+@register_tool("export_umg_snapshot", "Writes a UMG widget subtree to a binary snapshot file.")
+async def export_umg_snapshot(asset_path: str, widget_name: str = "Root", file_path: Optional[str] = None) -> Dict[str, Any]:
     """
     (Description loaded from prompts.json)
     """
     asset_path = normalize_project_path(asset_path)
     conn = get_unreal_connection()
     umg_file_client = UMGFileTransformation.UMGFileTransformation(conn)
-    return await umg_file_client.export_umg_to_json(asset_path, widget_name)
+    return await umg_file_client.export_umg_snapshot(asset_path, widget_name, file_path)
+
+@register_tool("apply_umg_snapshot", "Stamps a binary UMG snapshot into an asset.")
+async def apply_umg_snapshot(file_path: str, asset_path: Optional[str] = None, widget_name: Optional[str] = None) -> Dict[str, Any]:
+    """
+    (Description loaded from prompts.json)
+    """
+    if asset_path:
+        asset_path = normalize_project_path(asset_path)
+    conn = get_unreal_connection()
+    umg_file_client = UMGFileTransformation.UMGFileTransformation(conn)
+    return await umg_file_client.apply_umg_snapshot(file_path, asset_path, widget_name)
 
 @register_tool("apply_layout", "Applies a layout logic to a UMG asset.")
 async def apply_layout(layout_content: str, widget_name: Optional[str] = None) -> Dict[str, Any]:
@@ -843,13 +893,13 @@ async def apply_layout(layout_content: str, widget_name: Optional[str] = None) -
     return await umg_trans_client.apply_json_to_umg(final_path, json_data, target_widget)
 
 @register_tool("apply_json_to_umg", "Compatibility bulk JSON apply command. Prefer apply_layout.")
-async def apply_json_to_umg(asset_path: str, json_data: dict, widget_name: Optional[str] = None) -> Dict[str, Any]:
+async def apply_json_to_umg(asset_path: str, json_data: dict, widget_name: Optional[str] = None, mode: Optional[str] = None) -> Dict[str, Any]:
     """Applies a JSON definition to a UMG asset. (Maintained for backward compatibility and specialized agent workflows)"""
     asset_path = normalize_project_path(asset_path)
     target_widget = widget_name if widget_name is not None else (context_manager.get_target_widget() or "Root")
     conn = get_unreal_connection()
     umg_trans_client = UMGFileTransformation.UMGFileTransformation(conn)
-    return await umg_trans_client.apply_json_to_umg(asset_path, json_data, target_widget)
+    return await umg_trans_client.apply_json_to_umg(asset_path, json_data, target_widget, mode)
 
 @register_tool("apply_html_to_umg", "Compatibility bulk HTML apply command. Prefer apply_layout.")
 async def apply_html_to_umg(asset_path: str, html_content: str, widget_name: Optional[str] = None) -> Dict[str, Any]:
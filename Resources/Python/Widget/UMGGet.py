@@ -16,21 +16,69 @@ class UMGGet:
         """Returns a list of all creatable widget class names."""
         return self.client.send_command("get_creatable_widget_types")
 
+    def list_widget_classes(self, filter: str = "", include_abstract: bool = False, include_blueprints: bool = True,
+                            panels_only: bool = False) -> Dict[str, Any]:
+        """Lists indexed UWidget subclasses, native and Blueprint-derived."""
+        params: Dict[str, Any] = {
+            "include_abstract": include_abstract,
+            "include_blueprints": include_blueprints,
+            "panels_only": panels_only,
+        }
+        if filter:
+            params["filter"] = filter
+        return self.client.send_command("list_widget_classes", params)
+
     # --- Sensing ---
-    def get_widget_tree(self) -> Dict[str, Any]:
-        """Retrieves a compact text tree from the focused widget target, or root if no widget is focused."""
-        return self.client.send_command("get_widget_tree", {})
+    def get_widget_tree(self, since_revision: Optional[int] = None, max_depth: Optional[int] = None,
+                        max_nodes: Optional[int] = None, cursor: Optional[str] = None) -> Dict[str, Any]:
+        """Retrieves a compact text tree from the focused widget target, or root if no widget is focused.
+
+        With since_revision, returns only the structural changes since that revision when it is still retained.
+        max_depth collapses deeper panels to a child count; max_nodes pages the output and returns next_cursor.
+        """
+        params: Dict[str, Any] = {}
+        if since_revision is not None:
+            params["since_revision"] = since_revision
+        if max_depth is not None:
+            params["max_depth"] = max_depth
+        if max_nodes is not None:
+            params["max_nodes"] = max_nodes
+        if cursor:
+            params["cursor"] = cursor
+        return self.client.send_command("get_widget_tree", params)
 
     def query_widget_properties(self, widget_name: str, properties: List[str]) -> Dict[str, Any]:
         """Queries a list of specific properties from a single widget by its name."""
         params = {"widget_name": widget_name, "properties": properties}
         return self.client.send_command("query_widget_properties", params)
 
-    def get_layout_data(self, resolution_width: int = 1920, resolution_height: int = 1080) -> Dict[str, Any]:
-        """Gets screen-space bounding boxes for all widgets at a given resolution."""
-        resolution = {"width": resolution_width, "height": resolution_height}
+    def get_layout_data(self, resolution_width: int = 1920, resolution_height: int = 1080, dpi_scale: float = 1.0,
+                        resolutions: Optional[List[Dict[str, Any]]] = None) -> Dict[str, Any]:
+        """Gets viewport-space bounding boxes for all widgets from a headless layout pass.
+
+        resolutions, when given, is a list of {"width", "height", "dpi_scale"} evaluated in one call.
+        """
+        if resolutions:
+            return self.client.send_command("get_layout_data", {"resolutions": resolutions})
+        resolution = {"width": resolution_width, "height": resolution_height, "dpi_scale": dpi_scale}
         return self.client.send_command("get_layout_data", {"resolution": resolution})
 
+    def layout_sweep(self, viewports: Optional[List[List[int]]] = None, dpi_scales: Optional[List[float]] = None,
+                     resolutions: Optional[List[Dict[str, Any]]] = None) -> Dict[str, Any]:
+        """Lays the UMG out at many viewports in one call and returns column-oriented rects per widget.
+
+        viewports ([width, height] pairs) are crossed with dpi_scales; resolutions is an explicit
+        list of {"width", "height", "dpi_scale"} instead.
+        """
+        params: Dict[str, Any] = {}
+        if viewports:
+            params["viewports"] = viewports
+            if dpi_scales:
+                params["dpi_scales"] = dpi_scales
+        elif resolutions:
+            params["resolutions"] = resolutions
+        return self.client.send_command("layout_sweep", params)
+
     def check_widget_overlap(self, widget_names: Optional[List[str]] = None) -> Dict[str, Any]:
         """Checks for layout overlap between specified widgets by name."""
         params = {}
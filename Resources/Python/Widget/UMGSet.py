@@ -21,6 +21,11 @@ class UMGSet:
         }
         return self.client.send_command("create_widget", params)
 
+    def create_widget_subtree(self, tree: Any, parent_name: str = "") -> Dict[str, Any]:
+        """Creates a nested widget subtree (one node or a list of sibling nodes) in one call."""
+        params = {"tree": tree, "parent_name": parent_name}
+        return self.client.send_command("create_widget_subtree", params)
+
     def delete_widget(self, widget_name: str, confirm_delete: bool = False) -> Dict[str, Any]:
         """Deletes a widget from the UMG asset."""
         params = {"widget_name": widget_name, "confirm_delete": confirm_delete}
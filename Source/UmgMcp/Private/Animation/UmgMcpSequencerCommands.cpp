@@ -12,6 +12,7 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "FileManage/UmgAttentionSubsystem.h"
+#include "Widget/UmgWidgetIndex.h"
 #include "Blueprint/WidgetTree.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 
@@ -1530,7 +1531,7 @@ TSharedPtr<FJsonObject> FUmgMcpSequencerCommands::SetPropertyKeys(const TSharedP
         }
     }
 
-    UWidget* Widget = Blueprint->WidgetTree ? Blueprint->WidgetTree->FindWidget(FName(*WidgetName)) : nullptr;
+    UWidget* Widget = FUmgWidgetIndexCache::Get().FindWidget(Blueprint, WidgetName);
     if (!Widget) return FUmgMcpCommonUtils::CreateErrorResponse(TEXT("Widget not found in tree"));
 
     if (!Widget->bIsVariable || !Blueprint->WidgetVariableNameToGuidMap.Contains(Widget->GetFName()))
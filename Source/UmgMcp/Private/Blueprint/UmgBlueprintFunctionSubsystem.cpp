@@ -9,6 +9,8 @@
 #include "Logging/LogMacros.h"
 #include "FileManage/UmgAttentionSubsystem.h"
 #include "Bridge/UmgMcpJsonCompat.h"
+#include "Bridge/UmgMcpRequestArena.h"
+#include "Widget/UmgWidgetIndex.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "UObject/Package.h"
@@ -30,6 +32,7 @@
 #include "BlueprintActionMenuUtils.h"
 #include "BlueprintNodeSpawner.h"
 #include "Misc/SecureHash.h"
+#include "String/Find.h"
 
 // Nodes
 #include "K2Node_CallFunction.h"
@@ -257,6 +260,11 @@ namespace
 			: Haystack.Contains(Needle, ESearchCase::IgnoreCase);
 	}
 
+	bool MatchesTextFilter(const FStringView Haystack, const FString& Needle)
+	{
+		return Needle.IsEmpty() || UE::String::FindFirst(Haystack, Needle, ESearchCase::IgnoreCase) != INDEX_NONE;
+	}
+
 	FString NormalizeBluecodeStatement(const FString& Statement)
 	{
 		FString Normalized = Statement;
@@ -3752,7 +3760,7 @@ TSharedPtr<FJsonObject> UUmgBlueprintFunctionSubsystem::CreateNodeInstance(UEdGr
                      if (!bWired && TargetBlueprint)
                      {
                          UWidgetBlueprint* WidgetBP = Cast<UWidgetBlueprint>(TargetBlueprint);
-                         UWidget* FoundWidget = (WidgetBP && WidgetBP->WidgetTree) ? WidgetBP->WidgetTree->FindWidget(FName(*ArgVal)) : nullptr;
+                         UWidget* FoundWidget = WidgetBP ? FUmgWidgetIndexCache::Get().FindWidget(WidgetBP, ArgVal) : nullptr;
                          if (FoundWidget)
                          {
                              if (!FoundWidget->bIsVariable || !WidgetBP->WidgetVariableNameToGuidMap.Contains(FoundWidget->GetFName()))
@@ -4813,7 +4821,7 @@ TSharedPtr<FJsonObject> UUmgBlueprintFunctionSubsystem::GetEvents(UBlueprint* Bl
     UWidget* ScopeWidget = nullptr;
     if (!ScopeWidgetName.IsEmpty() && WidgetBlueprint && WidgetBlueprint->WidgetTree)
     {
-        ScopeWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*ScopeWidgetName));
+        ScopeWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, ScopeWidgetName);
         if (!ScopeWidget)
         {
             Result->SetStringField(TEXT("scope_warning"), FString::Printf(TEXT("Focused widget '%s' was not found; scanned all widgets."), *ScopeWidgetName));
@@ -7436,8 +7444,12 @@ TSharedPtr<FJsonObject> UUmgBlueprintFunctionSubsystem::SearchNodes(UEdGraph* Gr
     FBlueprintActionMenuBuilder Menu;
     BuildBlueprintActionMenu(TargetBlueprint, Graph, bContextSensitive, Menu);
 
-    TArray<TSharedPtr<FJsonValue>> ActionsArray;
+    // Matching actions are collected into request scratch memory first; JSON is only built for the kept ones.
+    FMemMark ScratchMark(FMemStack::Get());
+    TUmgMcpScratchArray<TSharedPtr<FEdGraphSchemaAction>> KeptActions;
     int32 TotalMatches = 0;
+    const FString NormalizedQuery = NormalizeBluecodeStatement(Query);
+    TStringBuilder<1024> SearchBlob;
 
     for (int32 Index = 0; Index < Menu.GetNumActions(); ++Index)
     {
@@ -7459,33 +7471,32 @@ TSharedPtr<FJsonObject> UUmgBlueprintFunctionSubsystem::SearchNodes(UEdGraph* Gr
         const FString ActionSearchText = Action->GetFullSearchText();
         const FString ActionSignature = Spawner ? Spawner->GetSpawnerSignature().ToString() : TEXT("");
 
-        const FString SearchBlob = FString::Printf(
-            TEXT("%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s"),
-            *ActionName,
-            *ActionCategory,
-            *ActionTooltip,
-            *ActionKeywords,
-            *ActionSearchText,
-            *ActionSignature,
-            *ActionNodeClass,
-            *ActionNodeClassPath);
+        SearchBlob.Reset();
+        SearchBlob << ActionName << TEXT('\n')
+            << ActionCategory << TEXT('\n')
+            << ActionTooltip << TEXT('\n')
+            << ActionKeywords << TEXT('\n')
+            << ActionSearchText << TEXT('\n')
+            << ActionSignature << TEXT('\n')
+            << ActionNodeClass << TEXT('\n')
+            << ActionNodeClassPath;
 
         const bool bMatchesQuery = Query.IsEmpty() ||
             (bExact
                 ? ActionName.Equals(Query, ESearchCase::IgnoreCase) ||
-                    NormalizeBluecodeStatement(ActionName) == NormalizeBluecodeStatement(Query) ||
+                    NormalizeBluecodeStatement(ActionName) == NormalizedQuery ||
                     ActionSignature.Equals(Query, ESearchCase::IgnoreCase) ||
-                    NormalizeBluecodeStatement(ActionSignature) == NormalizeBluecodeStatement(Query) ||
+                    NormalizeBluecodeStatement(ActionSignature) == NormalizedQuery ||
                     ActionSearchText.Equals(Query, ESearchCase::IgnoreCase) ||
                     ActionNodeClass.Equals(Query, ESearchCase::IgnoreCase) ||
                     ActionNodeClassPath.Equals(Query, ESearchCase::IgnoreCase)
-                : MatchesTextFilter(SearchBlob, Query, false));
+                : MatchesTextFilter(SearchBlob.ToView(), Query));
 
         if (!bMatchesQuery)
         {
             continue;
         }
-        if (!Category.IsEmpty() && !Action->GetCategory().ToString().Contains(Category, ESearchCase::IgnoreCase))
+        if (!Category.IsEmpty() && !ActionCategory.Contains(Category, ESearchCase::IgnoreCase))
         {
             continue;
         }
@@ -7499,12 +7510,19 @@ TSharedPtr<FJsonObject> UUmgBlueprintFunctionSubsystem::SearchNodes(UEdGraph* Gr
         }
 
         ++TotalMatches;
-        if (ActionsArray.Num() < MaxCount)
+        if (KeptActions.Num() < MaxCount)
         {
-            ActionsArray.Add(MakeShared<FJsonValueObject>(ActionToJson(Action, Graph, bIncludePins)));
+            KeptActions.Add(Action);
         }
     }
 
+    TArray<TSharedPtr<FJsonValue>> ActionsArray;
+    ActionsArray.Reserve(KeptActions.Num());
+    for (const TSharedPtr<FEdGraphSchemaAction>& Action : KeptActions)
+    {
+        ActionsArray.Add(MakeShared<FJsonValueObject>(ActionToJson(Action, Graph, bIncludePins)));
+    }
+
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("query"), Query);
@@ -2,6 +2,7 @@
 #include "Bridge/UmgMcpBridge.h"
 #include "Bridge/UmgMcpJsonCompat.h"
 #include "Bridge/UmgMcpConfig.h"
+#include "Bridge/UmgMcpRequestArena.h"
 #include "UmgMcp.h"
 #include "Bridge/MCPServerRunnable.h"
 #include "Sockets.h"
@@ -65,6 +66,7 @@
 #include "Blueprint/UmgBlueprintFunctionSubsystem.h"
 #include "FileManage/UmgAttentionSubsystem.h"
 #include "Material/UmgMcpMaterialSubsystem.h"
+#include "Widget/UmgAssetPreloader.h"
 #include "Misc/Guid.h"
 #include "Misc/DateTime.h"
 #include "HAL/PlatformTime.h"
@@ -78,10 +80,81 @@ bool IsTargetIndependentCommand(const FString& CommandType)
 {
     return CommandType == TEXT("ping") ||
         CommandType == TEXT("get_widget_schema") ||
+        CommandType == TEXT("list_widget_classes") ||
         CommandType == TEXT("get_last_edited_umg_asset") ||
         CommandType == TEXT("get_recently_edited_umg_assets") ||
         CommandType == TEXT("list_assets");
 }
+
+// Commands whose payload can name textures, fonts or materials by object path.
+bool PreloadsReferencedAssets(const FString& CommandType)
+{
+    return CommandType == TEXT("set_widget_properties") ||
+        CommandType == TEXT("create_widget_subtree") ||
+        CommandType == TEXT("reparent_widget") ||
+        CommandType == TEXT("apply_json_to_umg") ||
+        CommandType == TEXT("apply_layout");
+}
+
+// Builds the client envelope from a handler result: {status: "success", ...fields} or {status: "error", error, ...fields}.
+void WrapCommandResult(const TSharedPtr<FJsonObject>& ResultJson, const TSharedPtr<FJsonObject>& ResponseJson)
+{
+    // Check if the result contains an error
+    bool bSuccess = true;
+    FString ErrorMessage;
+    
+    // Determine success by checking for "success" bool, or "status" string, or absence of "error"
+    if (ResultJson->HasField(TEXT("success")))
+    {
+        bSuccess = ResultJson->GetBoolField(TEXT("success"));
+        if (!bSuccess && ResultJson->HasField(TEXT("error")))
+        {
+            ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+        }
+    }
+    else if (ResultJson->HasField(TEXT("status")))
+    {
+        FString InnerStatus;
+        ResultJson->TryGetStringField(TEXT("status"), InnerStatus);
+        bSuccess = (InnerStatus != TEXT("error"));
+        if (!bSuccess && ResultJson->HasField(TEXT("error")))
+        {
+            ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+        }
+        else if (!bSuccess && ResultJson->HasField(TEXT("message")))
+        {
+            ErrorMessage = ResultJson->GetStringField(TEXT("message"));
+        }
+    }
+    
+    if (bSuccess)
+    {
+        // Flatten: copy all fields from ResultJson directly into ResponseJson (skip internal keys)
+        ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+        for (const auto& Field : ResultJson->Values)
+        {
+            const FString Key = UmgMcpJsonCompat::KeyToString(Field.Key);
+            if (Key != TEXT("success") && Key != TEXT("status"))
+            {
+                ResponseJson->SetField(Key, Field.Value);
+            }
+        }
+    }
+    else
+    {
+        // Preserve structured error metadata so clients can recover without reparsing text.
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+        for (const auto& Field : ResultJson->Values)
+        {
+            const FString Key = UmgMcpJsonCompat::KeyToString(Field.Key);
+            if (Key != TEXT("success") && Key != TEXT("status") && Key != TEXT("error"))
+            {
+                ResponseJson->SetField(Key, Field.Value);
+            }
+        }
+    }
+}
 }
 
 UUmgMcpBridge::UUmgMcpBridge()
@@ -124,6 +197,12 @@ void UUmgMcpBridge::Initialize(FSubsystemCollectionBase& Collection)
     bCommandQueueProcessing = false;
     FIPv4Address::Parse(MCP_SERVER_HOST_DEFAULT, ServerAddress);
 
+    // Commandlets (e.g. UmgMcpBatch on a build agent) have no MCP client and must not hold the port.
+    if (IsRunningCommandlet())
+    {
+        return;
+    }
+
     // Start the server automatically
     StartServer();
 }
@@ -297,6 +376,12 @@ void UUmgMcpBridge::StopServer()
             }
         }
         CommandQueue.Empty();
+        if (PreloadingCommand.IsValid())
+        {
+            PreloadingCommand->Response = MakeErrorResponse(TEXT("UmgMcp server is shutting down."), TEXT("server_stopping"));
+            if (PreloadingCommand->CompletionEvent) PreloadingCommand->CompletionEvent->Trigger();
+            PreloadingCommand.Reset();
+        }
         bCommandQueueProcessing = false;
     }
 
@@ -359,9 +444,23 @@ FString UUmgMcpBridge::ExecuteCommand(const FString& CommandType, const TSharedP
         Direct->RawRequestJson = RawRequestJson;
         Direct->Sequence = ++NextSequence;
         Direct->EnqueuedAt = FPlatformTime::Seconds();
+        FUmgMcpRequestArena RequestArena;
         return ExecuteQueuedCommand(Direct);
     }
     
+    // Layout payloads are parsed and validated here, off the game thread, so only the UObject mutation is queued
+    // and a malformed payload is answered without waiting for the game thread at all.
+    // A rejection is wrapped exactly like a handler result so clients see the same error shape either way.
+    TSharedPtr<FUmgPreparedLayout> PreparedLayout;
+    if (TSharedPtr<FJsonObject> Rejected = FUmgMcpFileTransformationCommands::PrepareCommand(CommandType, Params, PreparedLayout))
+    {
+        TSharedRef<FJsonObject> RejectedResponse = MakeShared<FJsonObject>();
+        WrapCommandResult(Rejected, RejectedResponse);
+        FString ResultString;
+        FJsonSerializer::Serialize(RejectedResponse, TJsonWriterFactory<>::Create(&ResultString));
+        return ResultString;
+    }
+
     // Otherwise, queue execution on Game Thread and wait
     // This ensures thread safety for UObject operations (creating widgets, animations, etc.)
     UE_LOG(LogUmgMcp, Verbose, TEXT("UmgMcpBridge: Queueing command for GameThread execution..."));
@@ -382,6 +481,7 @@ FString UUmgMcpBridge::ExecuteCommand(const FString& CommandType, const TSharedP
     TSharedRef<FQueuedBridgeCommand, ESPMode::ThreadSafe> QueuedCommand = MakeShared<FQueuedBridgeCommand, ESPMode::ThreadSafe>();
     QueuedCommand->CommandType = CommandType;
     QueuedCommand->Params = Params;
+    QueuedCommand->PreparedLayout = PreparedLayout;
     QueuedCommand->CompletionEvent = CompletionEvent;
     QueuedCommand->ClientId = InClientId.IsEmpty() ? TEXT("legacy") : InClientId;
     QueuedCommand->RequestId = InRequestId.IsEmpty() ? FGuid::NewGuid().ToString(EGuidFormats::Digits) : InRequestId;
@@ -449,8 +549,59 @@ void UUmgMcpBridge::ProcessNextQueuedCommand()
         CommandQueue.RemoveAt(0);
     }
 
-    if (QueuedCommand.IsValid())
+    if (!QueuedCommand.IsValid())
+    {
+        ContinueCommandQueue();
+        return;
+    }
+
+    // Referenced assets are streamed in first. The queue stays blocked until they arrive, so commands still run in
+    // arrival order, but the editor keeps ticking instead of stalling on serial package loads.
+    if (PreloadsReferencedAssets(QueuedCommand->CommandType))
     {
+        {
+            FScopeLock CommandLock(&CommandQueueCs);
+            PreloadingCommand = QueuedCommand;
+        }
+
+        // The callback can outlive the subsystem, and StopServer may already have answered the command.
+        TWeakObjectPtr<UUmgMcpBridge> WeakThis(this);
+        const bool bPreloading = FUmgAssetPreloader::Get().PreloadCommandAssets(QueuedCommand->Params, [WeakThis, QueuedCommand]()
+        {
+            UUmgMcpBridge* Bridge = WeakThis.Get();
+            if (!Bridge)
+            {
+                return;
+            }
+
+            {
+                FScopeLock CommandLock(&Bridge->CommandQueueCs);
+                if (Bridge->PreloadingCommand != QueuedCommand)
+                {
+                    return;
+                }
+                Bridge->PreloadingCommand.Reset();
+            }
+            Bridge->RunQueuedCommand(QueuedCommand);
+        });
+        if (bPreloading)
+        {
+            return;
+        }
+
+        FScopeLock CommandLock(&CommandQueueCs);
+        PreloadingCommand.Reset();
+    }
+
+    RunQueuedCommand(QueuedCommand);
+}
+
+void UUmgMcpBridge::RunQueuedCommand(const TSharedPtr<FQueuedBridgeCommand, ESPMode::ThreadSafe>& QueuedCommand)
+{
+    {
+        // Scratch memory used by this command is released when the arena closes,
+        // which is after the waiting socket thread already has its response string.
+        FUmgMcpRequestArena RequestArena;
         QueuedCommand->Response = ExecuteQueuedCommand(QueuedCommand);
         if (QueuedCommand->CompletionEvent)
         {
@@ -458,6 +609,11 @@ void UUmgMcpBridge::ProcessNextQueuedCommand()
         }
     }
 
+    ContinueCommandQueue();
+}
+
+void UUmgMcpBridge::ContinueCommandQueue()
+{
     bool bHasMoreCommands = false;
     {
         FScopeLock CommandLock(&CommandQueueCs);
@@ -790,7 +946,7 @@ FString UUmgMcpBridge::ExecuteQueuedCommand(const TSharedPtr<FQueuedBridgeComman
         }
         else
         {
-            Response = InternalExecuteCommand(Command->CommandType, Command->Params);
+            Response = InternalExecuteCommand(Command->CommandType, Command->Params, Command->PreparedLayout);
             if (!IsTargetIndependentCommand(Command->CommandType))
             {
                 CaptureSessionContext(Command->ClientId);
@@ -802,7 +958,8 @@ FString UUmgMcpBridge::ExecuteQueuedCommand(const TSharedPtr<FQueuedBridgeComman
     return Response;
 }
 
-FString UUmgMcpBridge::InternalExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+FString UUmgMcpBridge::InternalExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    const TSharedPtr<FUmgPreparedLayout>& PreparedLayout)
 {
     TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
     
@@ -957,23 +1114,29 @@ FString UUmgMcpBridge::InternalExecuteCommand(const FString& CommandType, const
         else if (CommandType == TEXT("get_widget_tree") ||
                  CommandType == TEXT("query_widget_properties") ||
                  CommandType == TEXT("get_layout_data") ||
+                 CommandType == TEXT("layout_sweep") ||
                  CommandType == TEXT("check_widget_overlap") ||
                  CommandType == TEXT("create_widget") ||
+                 CommandType == TEXT("create_widget_subtree") ||
                  CommandType == TEXT("set_widget_properties") ||
                  CommandType == TEXT("delete_widget") ||
                  CommandType == TEXT("reparent_widget") ||
                  CommandType == TEXT("reorder_widget_tree") ||
                  CommandType == TEXT("save_asset") ||
-                 CommandType == TEXT("get_widget_schema"))
+                 CommandType == TEXT("get_widget_schema") ||
+                 CommandType == TEXT("list_widget_classes"))
         {
             ResultJson = WidgetCommands->HandleCommand(CommandType, Params);
         }
         // File Transformation Commands
         else if (CommandType == TEXT("export_umg_to_json") ||
+                 CommandType == TEXT("diff_umg") ||
+                 CommandType == TEXT("export_umg_snapshot") ||
+                 CommandType == TEXT("apply_umg_snapshot") ||
                  CommandType == TEXT("apply_json_to_umg") ||
                  CommandType == TEXT("apply_layout"))
         {
-            ResultJson = FileTransformationCommands->HandleCommand(CommandType, Params);
+            ResultJson = FileTransformationCommands->HandleCommand(CommandType, Params, PreparedLayout);
         }
         // Sequencer Commands
         else if (CommandType == TEXT("get_all_animations") ||
@@ -1185,61 +1348,7 @@ FString UUmgMcpBridge::InternalExecuteCommand(const FString& CommandType, const
             return ResultString;
         }
         
-        // Check if the result contains an error
-        bool bSuccess = true;
-        FString ErrorMessage;
-        
-        // Determine success by checking for "success" bool, or "status" string, or absence of "error"
-        if (ResultJson->HasField(TEXT("success")))
-        {
-            bSuccess = ResultJson->GetBoolField(TEXT("success"));
-            if (!bSuccess && ResultJson->HasField(TEXT("error")))
-            {
-                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-            }
-        }
-        else if (ResultJson->HasField(TEXT("status")))
-        {
-            FString InnerStatus;
-            ResultJson->TryGetStringField(TEXT("status"), InnerStatus);
-            bSuccess = (InnerStatus != TEXT("error"));
-            if (!bSuccess && ResultJson->HasField(TEXT("error")))
-            {
-                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-            }
-            else if (!bSuccess && ResultJson->HasField(TEXT("message")))
-            {
-                ErrorMessage = ResultJson->GetStringField(TEXT("message"));
-            }
-        }
-        
-        if (bSuccess)
-        {
-            // Flatten: copy all fields from ResultJson directly into ResponseJson (skip internal keys)
-            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-            for (const auto& Field : ResultJson->Values)
-            {
-                const FString Key = UmgMcpJsonCompat::KeyToString(Field.Key);
-                if (Key != TEXT("success") && Key != TEXT("status"))
-                {
-                    ResponseJson->SetField(Key, Field.Value);
-                }
-            }
-        }
-        else
-        {
-            // Preserve structured error metadata so clients can recover without reparsing text.
-            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
-            for (const auto& Field : ResultJson->Values)
-            {
-                const FString Key = UmgMcpJsonCompat::KeyToString(Field.Key);
-                if (Key != TEXT("success") && Key != TEXT("status") && Key != TEXT("error"))
-                {
-                    ResponseJson->SetField(Key, Field.Value);
-                }
-            }
-        }
+        WrapCommandResult(ResultJson, ResponseJson);
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,26 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Bridge/UmgMcpRequestArena.h"
+
+namespace
+{
+    thread_local FUmgMcpRequestArena* GCurrentRequestArena = nullptr;
+}
+
+FUmgMcpRequestArena::FUmgMcpRequestArena()
+    : ScratchMark(FMemStack::Get())
+    , PreviousArena(GCurrentRequestArena)
+{
+    GCurrentRequestArena = this;
+}
+
+FUmgMcpRequestArena::~FUmgMcpRequestArena()
+{
+    check(GCurrentRequestArena == this);
+    GCurrentRequestArena = PreviousArena;
+    // ScratchMark pops here, returning every TUmgMcpScratchArray page allocated during the request.
+}
+
+FUmgMcpRequestArena* FUmgMcpRequestArena::Get()
+{
+    return GCurrentRequestArena;
+}
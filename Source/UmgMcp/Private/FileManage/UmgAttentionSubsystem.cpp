@@ -1,5 +1,6 @@
 // Copyright (c) 2025-2026 Winyunq. All rights reserved.
 #include "FileManage/UmgAttentionSubsystem.h"
+#include "Widget/UmgWidgetIndex.h"
 #include "Editor.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "WidgetBlueprint.h"
@@ -11,12 +12,24 @@
 #include "IAssetTools.h"
 #include "WidgetBlueprintFactory.h"
 #include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
 
 // Define a log category for easy debugging.
 DEFINE_LOG_CATEGORY_STATIC(LogUmgAttention, Log, All);
 
 namespace
 {
+// History warmup is speculative; anything a command or the dependency prefetcher requests is served first.
+constexpr TAsyncLoadPriority WarmupLoadPriority = FStreamableManager::DefaultAsyncLoadPriority - 1;
+
 bool ResolveUmgAssetPath(const FString& InAssetPath, FString& OutCleanPath, FString& OutPackageName, FString& OutObjectPath, FString& OutError)
 {
     OutCleanPath = InAssetPath.TrimStartAndEnd();
@@ -84,6 +97,13 @@ bool IsSameAssetPackagePath(const FString& LeftPath, const FString& RightPath)
 
     return LeftPackageName.Equals(RightPackageName, ESearchCase::IgnoreCase);
 }
+
+constexpr int32 AssetHistoryFileVersion = 1;
+
+FString GetAssetHistoryFilePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("UmgMcp") / TEXT("AssetHistory.json");
+}
 }
 
 void UUmgAttentionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -101,6 +121,10 @@ void UUmgAttentionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		}
 	}
 
+	UmgAssetHistory.Empty(MaxAssetHistory);
+	LoadAssetHistory();
+	StartHistoryWarmup();
+
 	UE_LOG(LogUmgAttention, Log, TEXT("UmgAttentionSubsystem Initialized."));
 }
 
@@ -116,6 +140,30 @@ void UUmgAttentionSubsystem::Deinitialize()
 		}
 	}
 
+	if (FilesLoadedHandle.IsValid())
+	{
+		if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+		{
+			AssetRegistryModule->Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+		}
+		FilesLoadedHandle.Reset();
+	}
+
+	if (WarmupHandle.IsValid())
+	{
+		WarmupHandle->CancelHandle();
+		WarmupHandle.Reset();
+	}
+
+	DependencyPrefetcher.Cancel();
+
+	if (HistorySaveHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(HistorySaveHandle);
+		HistorySaveHandle.Reset();
+	}
+	SaveAssetHistory();
+
 	UE_LOG(LogUmgAttention, Log, TEXT("UmgAttentionSubsystem Deinitialized."));
 
 	Super::Deinitialize();
@@ -133,9 +181,7 @@ void UUmgAttentionSubsystem::HandleAssetOpened(UObject* Asset, class IAssetEdito
 		FString AssetPath = Blueprint->GetPathName();
 		UE_LOG(LogUmgAttention, Log, TEXT("Blueprint Asset Opened: %s"), *AssetPath);
 
-		// Update history
-		UmgAssetHistory.Remove(AssetPath);
-		UmgAssetHistory.Insert(AssetPath, 0);
+		TouchAssetHistory(AssetPath);
 
         // If the opened asset is our current target, update the cached object pointer for free.
         if (AssetPath == AttentionTargetAssetPath)
@@ -167,6 +213,7 @@ bool UUmgAttentionSubsystem::SetTargetBlueprintAssetInternal(const FString& Asse
         UE_LOG(LogUmgAttention, Warning, TEXT("SetTargetUmgAsset: %s Clearing target."), *PathError);
         AttentionTargetAssetPath.Empty();
         CachedTargetBlueprint = nullptr;
+        DependencyPrefetcher.Cancel();
         return false;
     }
 
@@ -246,8 +293,8 @@ bool UUmgAttentionSubsystem::SetTargetBlueprintAssetInternal(const FString& Asse
         CurrentWidgetName.Empty(); // Clear stale widget scope when switching assets unless explicitly set later.
 
         // Also treat setting a target as an 'edit' action to update the history, ensuring consistency.
-        UmgAssetHistory.Remove(CleanAssetPath);
-        UmgAssetHistory.Insert(CleanAssetPath, 0);
+        TouchAssetHistory(CleanAssetPath);
+        DependencyPrefetcher.Start(PackageName);
         UE_LOG(LogUmgAttention, Log, TEXT("Successfully cached Blueprint asset object (%s)."), *TargetBP->GetClass()->GetName());
         return true;
     }
@@ -257,6 +304,7 @@ bool UUmgAttentionSubsystem::SetTargetBlueprintAssetInternal(const FString& Asse
         UE_LOG(LogUmgAttention, Warning, TEXT("Failed to load or create UMG asset from path: %s. Clearing attention target."), *CleanAssetPath);
         AttentionTargetAssetPath.Empty();
         CachedTargetBlueprint = nullptr;
+        DependencyPrefetcher.Cancel();
         return false;
     }
 }
@@ -384,28 +432,196 @@ UWidgetBlueprint* UUmgAttentionSubsystem::GetCachedTargetWidgetBlueprint() const
     return Cast<UWidgetBlueprint>(GetCachedTargetBlueprint());
 }
 
+FUmgPrefetchProgress UUmgAttentionSubsystem::GetPrefetchProgress() const
+{
+    return DependencyPrefetcher.GetProgress();
+}
+
 
 FString UUmgAttentionSubsystem::GetLastEditedUMGAsset() const
 {
-    if (UmgAssetHistory.Num() > 0)
-    {
-        return UmgAssetHistory[0];
-    }
-    return FString();
+    TLruCache<FString, FString>::TConstIterator It(UmgAssetHistory);
+    return It ? It.Value() : FString();
 }
 
 TArray<FString> UUmgAttentionSubsystem::GetRecentlyEditedUMGAssets(int32 MaxCount) const
 {
     TArray<FString> Result;
-    int32 Count = FMath::Min(UmgAssetHistory.Num(), MaxCount);
-    for (int32 i = 0; i < Count; ++i)
+    Result.Reserve(FMath::Clamp(MaxCount, 0, UmgAssetHistory.Num()));
+    for (TLruCache<FString, FString>::TConstIterator It(UmgAssetHistory); It && Result.Num() < MaxCount; ++It)
     {
         // Return the direct asset path, consistent with GetLastEditedUMGAsset
-        Result.Add(UmgAssetHistory[i]);
+        Result.Add(It.Value());
     }
     return Result;
 }
 
+void UUmgAttentionSubsystem::TouchAssetHistory(const FString& AssetPath)
+{
+    FString CleanAssetPath;
+    FString PackageName;
+    FString ObjectPath;
+    FString PathError;
+    if (!ResolveUmgAssetPath(AssetPath, CleanAssetPath, PackageName, ObjectPath, PathError))
+    {
+        return;
+    }
+
+    // Add refreshes the value and moves an existing key to the front; the least recent entry drops off at capacity.
+    UmgAssetHistory.Add(PackageName, AssetPath);
+
+    // Opening or targeting several assets in a row rewrites the file once, after things settle.
+    if (!HistorySaveHandle.IsValid())
+    {
+        HistorySaveHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UUmgAttentionSubsystem::SaveScheduledAssetHistory), HistorySaveDelaySeconds);
+    }
+}
+
+bool UUmgAttentionSubsystem::SaveScheduledAssetHistory(float DeltaTime)
+{
+    HistorySaveHandle.Reset();
+    SaveAssetHistory();
+    return false;
+}
+
+void UUmgAttentionSubsystem::LoadAssetHistory()
+{
+    FString JsonText;
+    if (!FFileHelper::LoadFileToString(JsonText, *GetAssetHistoryFilePath()))
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+    {
+        UE_LOG(LogUmgAttention, Warning, TEXT("Ignoring unreadable asset history file: %s"), *GetAssetHistoryFilePath());
+        return;
+    }
+
+    int32 Version = 0;
+    const TArray<TSharedPtr<FJsonValue>>* Assets = nullptr;
+    if (!Root->TryGetNumberField(TEXT("version"), Version) || Version != AssetHistoryFileVersion ||
+        !Root->TryGetArrayField(TEXT("assets"), Assets))
+    {
+        UE_LOG(LogUmgAttention, Warning, TEXT("Ignoring asset history file with an unknown layout: %s"), *GetAssetHistoryFilePath());
+        return;
+    }
+
+    // Stored most recent first, so insert back to front.
+    for (int32 Index = FMath::Min(Assets->Num(), MaxAssetHistory) - 1; Index >= 0; --Index)
+    {
+        FString AssetPath;
+        FString CleanAssetPath;
+        FString PackageName;
+        FString ObjectPath;
+        FString PathError;
+        if ((*Assets)[Index].IsValid() && (*Assets)[Index]->TryGetString(AssetPath) &&
+            ResolveUmgAssetPath(AssetPath, CleanAssetPath, PackageName, ObjectPath, PathError))
+        {
+            UmgAssetHistory.Add(PackageName, AssetPath);
+        }
+    }
+
+    UE_LOG(LogUmgAttention, Log, TEXT("Restored %d asset history entries."), UmgAssetHistory.Num());
+}
+
+void UUmgAttentionSubsystem::SaveAssetHistory() const
+{
+    TArray<TSharedPtr<FJsonValue>> Assets;
+    Assets.Reserve(UmgAssetHistory.Num());
+    for (TLruCache<FString, FString>::TConstIterator It(UmgAssetHistory); It; ++It)
+    {
+        Assets.Add(MakeShared<FJsonValueString>(It.Value()));
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetNumberField(TEXT("version"), AssetHistoryFileVersion);
+    Root->SetArrayField(TEXT("assets"), Assets);
+
+    FString JsonText;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+    if (!FJsonSerializer::Serialize(Root, Writer) || !FFileHelper::SaveStringToFile(JsonText, *GetAssetHistoryFilePath()))
+    {
+        UE_LOG(LogUmgAttention, Warning, TEXT("Failed to save asset history to %s"), *GetAssetHistoryFilePath());
+    }
+}
+
+void UUmgAttentionSubsystem::StartHistoryWarmup()
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    if (FilesLoadedHandle.IsValid())
+    {
+        AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+        FilesLoadedHandle.Reset();
+    }
+
+    // Commandlets run one command and exit; warming the editor's history would only slow them down.
+    if (IsRunningCommandlet() || UmgAssetHistory.Num() == 0)
+    {
+        return;
+    }
+
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        // Dependencies are only known once the initial scan is done.
+        FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddUObject(this, &UUmgAttentionSubsystem::StartHistoryWarmup);
+        return;
+    }
+
+    if (!UAssetManager::IsInitialized())
+    {
+        return;
+    }
+
+    TArray<FSoftObjectPath> PathsToLoad;
+    int32 Visited = 0;
+    for (TLruCache<FString, FString>::TConstIterator It(UmgAssetHistory); It && Visited < WarmupAssetCount; ++It, ++Visited)
+    {
+        const FName PackageName(*It.Key());
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssetsByPackageName(PackageName, Assets);
+        for (const FAssetData& Asset : Assets)
+        {
+            PathsToLoad.AddUnique(Asset.GetSoftObjectPath());
+        }
+
+        // User widgets placed in the tree are hard package dependencies; native widget classes are already resident.
+        TArray<FName> Dependencies;
+        AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+        for (const FName Dependency : Dependencies)
+        {
+            TArray<FAssetData> DependencyAssets;
+            AssetRegistry.GetAssetsByPackageName(Dependency, DependencyAssets);
+            for (const FAssetData& DependencyAsset : DependencyAssets)
+            {
+                if (DependencyAsset.IsInstanceOf(UWidgetBlueprint::StaticClass()))
+                {
+                    PathsToLoad.AddUnique(DependencyAsset.GetSoftObjectPath());
+                }
+            }
+        }
+    }
+
+    PathsToLoad.RemoveAll([](const FSoftObjectPath& Path) { return Path.ResolveObject() != nullptr; });
+    if (PathsToLoad.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 NumRequested = PathsToLoad.Num();
+    UE_LOG(LogUmgAttention, Log, TEXT("Warming up %d assets from the %d most recent history entries."), NumRequested, Visited);
+    WarmupHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        MoveTemp(PathsToLoad),
+        FStreamableDelegate::CreateWeakLambda(this, [NumRequested]()
+        {
+            UE_LOG(LogUmgAttention, Log, TEXT("Asset history warmup finished (%d assets)."), NumRequested);
+        }),
+        WarmupLoadPriority);
+}
+
 void UUmgAttentionSubsystem::SetTargetAnimation(const FString& AnimationName)
 {
 	CurrentAnimationName = AnimationName;
@@ -435,7 +651,7 @@ bool UUmgAttentionSubsystem::SetTargetWidget(const FString& WidgetName)
         return false;
     }
 
-    if (!WidgetBP->WidgetTree->FindWidget(FName(*CleanWidgetName)))
+    if (!FUmgWidgetIndexCache::Get().FindWidget(WidgetBP, CleanWidgetName))
     {
         CurrentWidgetName.Empty();
         UE_LOG(LogUmgAttention, Warning, TEXT("SetTargetWidget: Widget '%s' was not found in target asset '%s'. Focus cleared."),
@@ -456,7 +672,7 @@ FString UUmgAttentionSubsystem::GetTargetWidget() const
 	// If a focused widget is set, check if it still exists in the tree (has not been deleted)
 	if (!CurrentWidgetName.IsEmpty() && WidgetBP && WidgetBP->WidgetTree)
 	{
-		if (WidgetBP->WidgetTree->FindWidget(FName(*CurrentWidgetName)))
+		if (FUmgWidgetIndexCache::Get().FindWidget(WidgetBP, CurrentWidgetName))
 		{
 			return CurrentWidgetName;
 		}
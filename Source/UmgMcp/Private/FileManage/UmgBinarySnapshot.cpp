@@ -0,0 +1,1060 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "FileManage/UmgBinarySnapshot.h"
+#include "UmgMcp.h"
+#include "FileManage/UmgAttentionSubsystem.h"
+#include "FileManage/UmgExportPlanCache.h"
+#include "Widget/UmgWidgetClassResolver.h"
+#include "Widget/UmgWidgetIndex.h"
+
+#include "Async/MappedFileHandle.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/PanelSlot.h"
+#include "Components/PanelWidget.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Memory/MemoryView.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArchiveUObject.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/StructuredArchive.h"
+#include "UObject/UnrealType.h"
+#include "WidgetBlueprint.h"
+
+namespace
+{
+    // "UMGS" as a little-endian uint32; a snapshot read on a big-endian host fails this check.
+    static constexpr uint32 SnapshotMagic = 0x53474D55;
+
+    // Fixed-size records, read in place from the mapped file. Every section starts 8-byte aligned.
+    struct FSnapshotHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        int32 NumStrings;
+        int32 NumClasses;
+        int32 NumWidgets;
+        int32 NumProperties;
+        uint64 StringsOffset;
+        uint64 StringsSize;
+        uint64 ClassesOffset;
+        uint64 WidgetsOffset;
+        uint64 PropertiesOffset;
+        uint64 BlobOffset;
+        uint64 BlobSize;
+    };
+
+    struct FSnapshotClassRecord
+    {
+        int32 PathIndex;
+        int32 Padding;
+        uint64 Fingerprint;
+    };
+
+    struct FSnapshotWidgetRecord
+    {
+        int32 NameIndex;
+        int32 ClassIndex;
+
+        /** Class of the slot in the source tree; INDEX_NONE when the widget had none. */
+        int32 SlotClassIndex;
+
+        /** Pre-order index of the parent; INDEX_NONE for the snapshot root only. */
+        int32 ParentIndex;
+
+        /** The widget's records are [FirstProperty, FirstProperty + NumProperties); the last NumSlotProperties are its slot's. */
+        int32 FirstProperty;
+        int32 NumProperties;
+        int32 NumSlotProperties;
+        int32 Padding;
+    };
+
+    struct FSnapshotPropertyRecord
+    {
+        int32 NameIndex;
+        int32 BlobSize;
+        uint64 BlobOffset;
+    };
+
+    // Widget names and property names differ only by case often enough that TMap's case-insensitive FString keys would merge them.
+    struct FCaseSensitiveStringKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+    {
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    class FSnapshotStringTable
+    {
+    public:
+        int32 Intern(const FString& Value)
+        {
+            if (const int32* Found = Indices.Find(Value))
+            {
+                return *Found;
+            }
+            const int32 Index = Strings.Add(Value);
+            Indices.Add(Value, Index);
+            return Index;
+        }
+
+        TArray<FString> Strings;
+
+    private:
+        TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs> Indices;
+    };
+
+    // Names and object references inside property values are written as string table indices.
+    class FSnapshotWriter : public FMemoryWriter
+    {
+    public:
+        FSnapshotWriter(TArray<uint8>& InBytes, FSnapshotStringTable& InStrings)
+            : FMemoryWriter(InBytes, true)
+            , Strings(InStrings)
+        {
+        }
+
+        using FMemoryWriter::operator<<;
+
+        virtual FArchive& operator<<(FName& Value) override
+        {
+            int32 Index = Strings.Intern(Value.ToString());
+            return *this << Index;
+        }
+
+        virtual FArchive& operator<<(UObject*& Value) override
+        {
+            int32 Index = Value ? Strings.Intern(Value->GetPathName()) : INDEX_NONE;
+            return *this << Index;
+        }
+
+        virtual FArchive& operator<<(FObjectPtr& Value) override { return FArchiveUObject::SerializeObjectPtr(*this, Value); }
+        virtual FArchive& operator<<(FLazyObjectPtr& Value) override { return FArchiveUObject::SerializeLazyObjectPtr(*this, Value); }
+        virtual FArchive& operator<<(FSoftObjectPtr& Value) override { return FArchiveUObject::SerializeSoftObjectPtr(*this, Value); }
+        virtual FArchive& operator<<(FSoftObjectPath& Value) override { return FArchiveUObject::SerializeSoftObjectPath(*this, Value); }
+        virtual FArchive& operator<<(FWeakObjectPtr& Value) override { return FArchiveUObject::SerializeWeakObjectPtr(*this, Value); }
+
+        virtual FString GetArchiveName() const override { return TEXT("FUmgBinarySnapshot Writer"); }
+
+    private:
+        FSnapshotStringTable& Strings;
+    };
+
+    class FSnapshotReader : public FMemoryReaderView
+    {
+    public:
+        FSnapshotReader(FMemoryView InBytes, const TArray<FString>& InStrings)
+            : FMemoryReaderView(InBytes, true)
+            , Strings(InStrings)
+        {
+        }
+
+        using FMemoryReaderView::operator<<;
+
+        virtual FArchive& operator<<(FName& Value) override
+        {
+            int32 Index = INDEX_NONE;
+            *this << Index;
+            if (!Strings.IsValidIndex(Index))
+            {
+                SetError();
+                Value = NAME_None;
+                return *this;
+            }
+            Value = FName(*Strings[Index]);
+            return *this;
+        }
+
+        virtual FArchive& operator<<(UObject*& Value) override
+        {
+            int32 Index = INDEX_NONE;
+            *this << Index;
+            Value = nullptr;
+            if (Index == INDEX_NONE)
+            {
+                return *this;
+            }
+            if (!Strings.IsValidIndex(Index))
+            {
+                SetError();
+                return *this;
+            }
+
+            if (UObject** Cached = Objects.Find(Index))
+            {
+                Value = *Cached;
+                return *this;
+            }
+            const FString& Path = Strings[Index];
+            Value = StaticFindObject(UObject::StaticClass(), nullptr, *Path);
+            if (!Value)
+            {
+                Value = StaticLoadObject(UObject::StaticClass(), nullptr, *Path, nullptr, LOAD_NoWarn);
+            }
+            if (!Value)
+            {
+                UnresolvedPaths.AddUnique(Path);
+            }
+            Objects.Add(Index, Value);
+            return *this;
+        }
+
+        virtual FArchive& operator<<(FObjectPtr& Value) override { return FArchiveUObject::SerializeObjectPtr(*this, Value); }
+        virtual FArchive& operator<<(FLazyObjectPtr& Value) override { return FArchiveUObject::SerializeLazyObjectPtr(*this, Value); }
+        virtual FArchive& operator<<(FSoftObjectPtr& Value) override { return FArchiveUObject::SerializeSoftObjectPtr(*this, Value); }
+        virtual FArchive& operator<<(FSoftObjectPath& Value) override { return FArchiveUObject::SerializeSoftObjectPath(*this, Value); }
+        virtual FArchive& operator<<(FWeakObjectPtr& Value) override { return FArchiveUObject::SerializeWeakObjectPtr(*this, Value); }
+
+        virtual FString GetArchiveName() const override { return TEXT("FUmgBinarySnapshot Reader"); }
+
+        /** Positions the reader on a value. Strings inside it (FString, FText, ...) may not claim more than its bytes. */
+        void SeekRecord(const FSnapshotPropertyRecord& Record)
+        {
+            Seek(static_cast<int64>(Record.BlobOffset));
+            ArMaxSerializeSize = FMath::Max(Record.BlobSize, 1);
+        }
+
+        /** Object paths that named nothing loadable; those references were left null. */
+        TArray<FString> UnresolvedPaths;
+
+    private:
+        const TArray<FString>& Strings;
+        TMap<int32, UObject*> Objects;
+    };
+
+    // Element counts inside a value come from the file and SerializeItem allocates for them before reading a single
+    // element, so every container count is bounded by the bytes left in its record. The walk follows the encodings
+    // that are known exactly; anything else (structs, text, soft references, enums) is opaque and ends it.
+    enum class EValueWalk : uint8
+    {
+        Walked,
+        Opaque,
+        Corrupt,
+    };
+
+    static bool IsWalkable(const FProperty* Property)
+    {
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            return IsWalkable(ArrayProperty->Inner);
+        }
+        if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            return IsWalkable(SetProperty->ElementProp);
+        }
+        if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+        {
+            return IsWalkable(MapProperty->KeyProp) && IsWalkable(MapProperty->ValueProp);
+        }
+        if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+        {
+            return ByteProperty->Enum == nullptr;
+        }
+        return Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>() || Property->IsA<FNameProperty>()
+            || Property->IsA<FStrProperty>() || Property->GetClass() == FObjectProperty::StaticClass()
+            || Property->GetClass() == FClassProperty::StaticClass();
+    }
+
+    static bool ContainsContainer(const FProperty* Property)
+    {
+        if (Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>())
+        {
+            return true;
+        }
+        if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+        {
+            for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+            {
+                if (ContainsContainer(*It))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // A container whose count the walk cannot reach (one nested in a struct, or after an opaque element) could not be
+    // bounded before decoding, so such properties are left out of snapshots altogether.
+    static bool HasBoundableCounts(const FProperty* Property)
+    {
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            return IsWalkable(ArrayProperty->Inner) || !ContainsContainer(ArrayProperty->Inner);
+        }
+        if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            return IsWalkable(SetProperty->ElementProp) || !ContainsContainer(SetProperty->ElementProp);
+        }
+        if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+        {
+            return (IsWalkable(MapProperty->KeyProp) && IsWalkable(MapProperty->ValueProp))
+                || (!ContainsContainer(MapProperty->KeyProp) && !ContainsContainer(MapProperty->ValueProp));
+        }
+        return !ContainsContainer(Property);
+    }
+
+    static bool ReadInt32(FMemoryView& Cursor, int32& OutValue)
+    {
+        if (Cursor.GetSize() < sizeof(int32))
+        {
+            return false;
+        }
+        FMemory::Memcpy(&OutValue, Cursor.GetData(), sizeof(int32));
+        Cursor += sizeof(int32);
+        return true;
+    }
+
+    static bool SkipBytes(FMemoryView& Cursor, uint64 Size)
+    {
+        if (Cursor.GetSize() < Size)
+        {
+            return false;
+        }
+        Cursor += Size;
+        return true;
+    }
+
+    // Every element takes at least one byte, so a count larger than what is left cannot be genuine.
+    static bool ReadCount(FMemoryView& Cursor, int32& OutCount)
+    {
+        return ReadInt32(Cursor, OutCount) && OutCount >= 0 && static_cast<uint64>(OutCount) <= Cursor.GetSize();
+    }
+
+    static EValueWalk WalkValue(FMemoryView& Cursor, const FProperty* Property)
+    {
+        const FProperty* Inner = nullptr;
+        const FProperty* MapValue = nullptr;
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            Inner = ArrayProperty->Inner;
+        }
+        else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            Inner = SetProperty->ElementProp;
+        }
+        else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+        {
+            Inner = MapProperty->KeyProp;
+            MapValue = MapProperty->ValueProp;
+        }
+
+        if (Inner)
+        {
+            // Sets and maps lead with the number of elements to remove, which is 0 for the full values the writer stores.
+            int32 NumToRemove = 0;
+            if (!Property->IsA<FArrayProperty>() && (!ReadInt32(Cursor, NumToRemove) || NumToRemove != 0))
+            {
+                return EValueWalk::Corrupt;
+            }
+            int32 Count = 0;
+            if (!ReadCount(Cursor, Count))
+            {
+                return EValueWalk::Corrupt;
+            }
+            if (!IsWalkable(Inner) || (MapValue && !IsWalkable(MapValue)))
+            {
+                return EValueWalk::Opaque;
+            }
+            for (int32 Element = 0; Element < Count; ++Element)
+            {
+                if (WalkValue(Cursor, Inner) == EValueWalk::Corrupt || (MapValue && WalkValue(Cursor, MapValue) == EValueWalk::Corrupt))
+                {
+                    return EValueWalk::Corrupt;
+                }
+            }
+            return EValueWalk::Walked;
+        }
+
+        if (!IsWalkable(Property))
+        {
+            return EValueWalk::Opaque;
+        }
+        if (Property->IsA<FStrProperty>())
+        {
+            // FString's own encoding: a negative length means UTF-16 characters.
+            int32 SaveNum = 0;
+            if (!ReadInt32(Cursor, SaveNum) || SaveNum == MIN_int32)
+            {
+                return EValueWalk::Corrupt;
+            }
+            return SkipBytes(Cursor, SaveNum < 0 ? static_cast<uint64>(-SaveNum) * sizeof(UTF16CHAR) : static_cast<uint64>(SaveNum))
+                ? EValueWalk::Walked : EValueWalk::Corrupt;
+        }
+        if (Property->IsA<FBoolProperty>())
+        {
+            return SkipBytes(Cursor, sizeof(uint8)) ? EValueWalk::Walked : EValueWalk::Corrupt;
+        }
+        if (Property->IsA<FNumericProperty>())
+        {
+            return SkipBytes(Cursor, Property->GetElementSize()) ? EValueWalk::Walked : EValueWalk::Corrupt;
+        }
+        // Names and object references are string table indices (see FSnapshotWriter).
+        return SkipBytes(Cursor, sizeof(int32)) ? EValueWalk::Walked : EValueWalk::Corrupt;
+    }
+
+    // Decodes one stored value into scratch memory and reports whether it consumed exactly its record.
+    static bool DecodesCleanly(FSnapshotReader& Blob, FMemoryView BlobView, FProperty* Property, const FSnapshotPropertyRecord& Record)
+    {
+        FMemoryView Cursor = BlobView.Mid(Record.BlobOffset, Record.BlobSize);
+        if (WalkValue(Cursor, Property) == EValueWalk::Corrupt)
+        {
+            return false;
+        }
+
+        void* Scratch = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+        Property->InitializeValue(Scratch);
+        Blob.SeekRecord(Record);
+        {
+            FStructuredArchiveFromArchive Adapter(Blob);
+            Property->SerializeItem(Adapter.GetSlot(), Scratch, nullptr);
+        }
+        const bool bClean = !Blob.IsError() && Blob.Tell() == static_cast<int64>(Record.BlobOffset) + Record.BlobSize;
+        Blob.ClearError();
+        Property->DestroyValue(Scratch);
+        FMemory::Free(Scratch);
+        return bClean;
+    }
+
+    // Maps the whole file read-only. Platforms and files that cannot be mapped (e.g. inside a pak) are read instead.
+    class FMappedSnapshotFile
+    {
+    public:
+        bool Open(const FString& FilePath)
+        {
+            FOpenMappedResult Mapped = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*FilePath);
+            if (Mapped.HasValue())
+            {
+                Handle = Mapped.StealValue();
+                if (Handle && Handle->GetFileSize() > 0)
+                {
+                    Region.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+                }
+            }
+            if (Region)
+            {
+                View = FMemoryView(Region->GetMappedPtr(), Region->GetMappedSize());
+                return true;
+            }
+
+            if (!FFileHelper::LoadFileToArray(Fallback, *FilePath))
+            {
+                return false;
+            }
+            View = FMemoryView(Fallback.GetData(), Fallback.Num());
+            return true;
+        }
+
+        bool IsMapped() const { return Region.IsValid(); }
+
+        FMemoryView View;
+
+    private:
+        TUniquePtr<IMappedFileHandle> Handle;
+        TUniquePtr<IMappedFileRegion> Region;
+        TArray64<uint8> Fallback;
+    };
+
+    template <typename RecordType>
+    static const RecordType* GetRecords(FMemoryView View, uint64 Offset, int32 Count)
+    {
+        if (Count < 0 || Offset % alignof(RecordType) != 0 || Offset > View.GetSize()
+            || static_cast<uint64>(Count) * sizeof(RecordType) > View.GetSize() - Offset)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<const RecordType*>(static_cast<const uint8*>(View.GetData()) + Offset);
+    }
+
+    static uint64 AlignSection(uint64 Offset)
+    {
+        return Align(Offset, 8);
+    }
+
+    // Instanced subobjects belong to the source asset and delegates bind into its graph; neither can be stamped elsewhere.
+    // Values with container counts the reader cannot bound up front are left out as well.
+    static bool IsSnapshotProperty(const FProperty* Property)
+    {
+        return !Property->ContainsInstancedObjectProperty()
+            && !Property->IsA<FDelegateProperty>()
+            && !Property->IsA<FMulticastDelegateProperty>()
+            && HasBoundableCounts(Property);
+    }
+
+    static FString ResolveSnapshotPath(const FString& FilePath)
+    {
+        return FPaths::IsRelative(FilePath) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), FilePath) : FilePath;
+    }
+
+    static FString ResolveAssetPath(const FString& AssetPath)
+    {
+        if (!AssetPath.TrimStartAndEnd().IsEmpty() || !GEditor)
+        {
+            return AssetPath;
+        }
+        UUmgAttentionSubsystem* AttentionSubsystem = GEditor->GetEditorSubsystem<UUmgAttentionSubsystem>();
+        return AttentionSubsystem ? AttentionSubsystem->GetTargetUmgAsset() : AssetPath;
+    }
+
+    static UWidgetBlueprint* LoadWidgetBlueprint(const FString& AssetPath)
+    {
+        const FString PackageName = FPackageName::ObjectPathToPackageName(AssetPath);
+        return PackageName.IsEmpty() ? nullptr : Cast<UWidgetBlueprint>(StaticLoadObject(UWidgetBlueprint::StaticClass(), nullptr, *PackageName));
+    }
+
+    static bool IsRootName(const FString& WidgetName)
+    {
+        return WidgetName.IsEmpty() || WidgetName.Equals(TEXT("Root"), ESearchCase::IgnoreCase);
+    }
+
+    static TSharedPtr<FJsonObject> MakeError(const TCHAR* Code, const FString& Message)
+    {
+        UE_LOG(LogUmgMcp, Error, TEXT("FUmgBinarySnapshot: %s"), *Message);
+        TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+        ResultJson->SetBoolField(TEXT("success"), false);
+        ResultJson->SetStringField(TEXT("error_code"), Code);
+        ResultJson->SetStringField(TEXT("error"), Message);
+        return ResultJson;
+    }
+
+    static void CollectSubtree(UWidget* Widget, int32 ParentIndex, TArray<TPair<UWidget*, int32>>& OutWidgets)
+    {
+        const int32 Index = OutWidgets.Emplace(Widget, ParentIndex);
+        if (const UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
+        {
+            for (int32 ChildIndex = 0; ChildIndex < Panel->GetChildrenCount(); ++ChildIndex)
+            {
+                if (UWidget* Child = Panel->GetChildAt(ChildIndex))
+                {
+                    CollectSubtree(Child, Index, OutWidgets);
+                }
+            }
+        }
+    }
+
+    /** Builds the sections of one snapshot file in memory. */
+    class FSnapshotBuilder
+    {
+    public:
+        FSnapshotBuilder()
+            : Blob(BlobBytes, Strings)
+        {
+        }
+
+        void AddWidget(UWidget* Widget, int32 ParentIndex)
+        {
+            FSnapshotWidgetRecord& Record = Widgets.AddZeroed_GetRef();
+            Record.NameIndex = Strings.Intern(Widget->GetName());
+            Record.ClassIndex = InternClass(Widget->GetClass());
+            Record.SlotClassIndex = Widget->Slot ? InternClass(Widget->Slot->GetClass()) : INDEX_NONE;
+            Record.ParentIndex = ParentIndex;
+            Record.FirstProperty = Properties.Num();
+
+            const int32 NumWidgetProperties = WriteProperties(Widget);
+            const int32 NumSlotProperties = Widget->Slot ? WriteProperties(Widget->Slot) : 0;
+            Record.NumProperties = NumWidgetProperties + NumSlotProperties;
+            Record.NumSlotProperties = NumSlotProperties;
+        }
+
+        TArray<uint8> Finish()
+        {
+            TArray<uint8> StringBytes;
+            {
+                FMemoryWriter StringWriter(StringBytes, true);
+                StringWriter << Strings.Strings;
+            }
+
+            FSnapshotHeader Header = {};
+            Header.Magic = SnapshotMagic;
+            Header.Version = FUmgBinarySnapshot::FormatVersion;
+            Header.NumStrings = Strings.Strings.Num();
+            Header.NumClasses = Classes.Num();
+            Header.NumWidgets = Widgets.Num();
+            Header.NumProperties = Properties.Num();
+
+            uint64 Cursor = AlignSection(sizeof(FSnapshotHeader));
+            Header.StringsOffset = Cursor;
+            Header.StringsSize = StringBytes.Num();
+            Cursor = AlignSection(Cursor + StringBytes.Num());
+            Header.ClassesOffset = Cursor;
+            Cursor = AlignSection(Cursor + Classes.Num() * sizeof(FSnapshotClassRecord));
+            Header.WidgetsOffset = Cursor;
+            Cursor = AlignSection(Cursor + Widgets.Num() * sizeof(FSnapshotWidgetRecord));
+            Header.PropertiesOffset = Cursor;
+            Cursor = AlignSection(Cursor + Properties.Num() * sizeof(FSnapshotPropertyRecord));
+            Header.BlobOffset = Cursor;
+            Header.BlobSize = BlobBytes.Num();
+
+            TArray<uint8> File;
+            File.SetNumZeroed(Cursor + BlobBytes.Num());
+            uint8* Data = File.GetData();
+            FMemory::Memcpy(Data, &Header, sizeof(Header));
+            FMemory::Memcpy(Data + Header.StringsOffset, StringBytes.GetData(), StringBytes.Num());
+            FMemory::Memcpy(Data + Header.ClassesOffset, Classes.GetData(), Classes.Num() * sizeof(FSnapshotClassRecord));
+            FMemory::Memcpy(Data + Header.WidgetsOffset, Widgets.GetData(), Widgets.Num() * sizeof(FSnapshotWidgetRecord));
+            FMemory::Memcpy(Data + Header.PropertiesOffset, Properties.GetData(), Properties.Num() * sizeof(FSnapshotPropertyRecord));
+            FMemory::Memcpy(Data + Header.BlobOffset, BlobBytes.GetData(), BlobBytes.Num());
+            return File;
+        }
+
+        int32 NumStrings() const { return Strings.Strings.Num(); }
+        int32 NumClasses() const { return Classes.Num(); }
+        int32 NumProperties() const { return Properties.Num(); }
+
+    private:
+        int32 InternClass(const UClass* Class)
+        {
+            if (const int32* Found = ClassIndices.Find(Class))
+            {
+                return *Found;
+            }
+            FSnapshotClassRecord& Record = Classes.AddZeroed_GetRef();
+            Record.PathIndex = Strings.Intern(Class->GetPathName());
+            Record.Fingerprint = FUmgBinarySnapshot::ComputeClassFingerprint(Class);
+            return ClassIndices.Add(Class, Classes.Num() - 1);
+        }
+
+        // The same properties export_umg_to_json writes: the class plan's entries that differ from the class default.
+        int32 WriteProperties(const UObject* Object)
+        {
+            const TSharedRef<const FUmgExportPlan> Plan = FUmgExportPlanCache::Get().GetPlan(Object->GetClass());
+            int32 Count = 0;
+            for (const FUmgExportProperty& Entry : Plan->Properties)
+            {
+                const void* ValuePtr = Entry.GetValue(Object);
+                if (Entry.bIsSlot || !IsSnapshotProperty(Entry.Property) || Entry.Property->Identical(ValuePtr, Entry.DefaultValue))
+                {
+                    continue;
+                }
+
+                FSnapshotPropertyRecord& Record = Properties.AddZeroed_GetRef();
+                Record.NameIndex = Strings.Intern(Entry.Name);
+                Record.BlobOffset = Blob.Tell();
+                {
+                    FStructuredArchiveFromArchive Adapter(Blob);
+                    Entry.Property->SerializeItem(Adapter.GetSlot(), const_cast<void*>(ValuePtr), nullptr);
+                }
+                Record.BlobSize = static_cast<int32>(Blob.Tell() - static_cast<int64>(Record.BlobOffset));
+                ++Count;
+            }
+            return Count;
+        }
+
+        FSnapshotStringTable Strings;
+        TArray<uint8> BlobBytes;
+        FSnapshotWriter Blob;
+        TMap<const UClass*, int32> ClassIndices;
+        TArray<FSnapshotClassRecord> Classes;
+        TArray<FSnapshotWidgetRecord> Widgets;
+        TArray<FSnapshotPropertyRecord> Properties;
+    };
+}
+
+uint64 FUmgBinarySnapshot::ComputeClassFingerprint(const UClass* Class)
+{
+    check(Class);
+    FXxHash64Builder Builder;
+    for (TFieldIterator<FProperty> PropIt(Class); PropIt; ++PropIt)
+    {
+        const FProperty* Property = *PropIt;
+        const FString Signature = FString::Printf(TEXT("%s %s %d %d;"), *Property->GetCPPType(), *Property->GetName(), Property->GetOffset_ForInternal(), Property->GetSize());
+        const FTCHARToUTF8 Utf8(*Signature);
+        Builder.Update(Utf8.Get(), Utf8.Length());
+    }
+    return Builder.Finalize().Hash;
+}
+
+FString FUmgBinarySnapshot::GetDefaultFilePath(const FString& AssetPath, const FString& WidgetName)
+{
+    FString PackagePath = FPackageName::ObjectPathToPackageName(AssetPath);
+    PackagePath.RemoveFromStart(TEXT("/"));
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UmgMcp"), TEXT("Snapshots"), PackagePath, WidgetName + TEXT(".umgsnap"));
+}
+
+TSharedPtr<FJsonObject> FUmgBinarySnapshot::ExportToFile(const FString& AssetPath, const FString& TargetWidgetName, const FString& FilePath)
+{
+    check(IsInGameThread());
+
+    const FString FinalAssetPath = ResolveAssetPath(AssetPath);
+    UWidgetBlueprint* WidgetBlueprint = LoadWidgetBlueprint(FinalAssetPath);
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        return MakeError(TEXT("asset_unavailable"), FString::Printf(TEXT("Failed to load a Widget Blueprint from '%s'."), *FinalAssetPath));
+    }
+
+    UWidget* Root = IsRootName(TargetWidgetName)
+        ? WidgetBlueprint->WidgetTree->RootWidget.Get()
+        : FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, TargetWidgetName);
+    if (!Root)
+    {
+        return MakeError(TEXT("widget_not_found"), FString::Printf(TEXT("Widget '%s' not found in '%s'."), IsRootName(TargetWidgetName) ? TEXT("Root") : *TargetWidgetName, *FinalAssetPath));
+    }
+
+    TArray<TPair<UWidget*, int32>> Subtree;
+    CollectSubtree(Root, INDEX_NONE, Subtree);
+
+    FSnapshotBuilder Builder;
+    for (const TPair<UWidget*, int32>& Entry : Subtree)
+    {
+        Builder.AddWidget(Entry.Key, Entry.Value);
+    }
+    const TArray<uint8> Bytes = Builder.Finish();
+
+    const FString OutputPath = FilePath.IsEmpty() ? GetDefaultFilePath(FinalAssetPath, Root->GetName()) : ResolveSnapshotPath(FilePath);
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), true);
+    if (!FFileHelper::SaveArrayToFile(Bytes, *OutputPath))
+    {
+        return MakeError(TEXT("write_failed"), FString::Printf(TEXT("Failed to write snapshot '%s'."), *OutputPath));
+    }
+
+    UE_LOG(LogUmgMcp, Log, TEXT("FUmgBinarySnapshot: Wrote %d widgets of '%s' (Target: %s) to '%s' (%d bytes)."),
+        Subtree.Num(), *FinalAssetPath, *Root->GetName(), *OutputPath, Bytes.Num());
+
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    ResultJson->SetBoolField(TEXT("success"), true);
+    ResultJson->SetStringField(TEXT("asset_path"), FinalAssetPath);
+    ResultJson->SetStringField(TEXT("target_widget"), Root->GetName());
+    ResultJson->SetStringField(TEXT("file_path"), OutputPath);
+    ResultJson->SetNumberField(TEXT("format_version"), FormatVersion);
+    ResultJson->SetNumberField(TEXT("widget_count"), Subtree.Num());
+    ResultJson->SetNumberField(TEXT("class_count"), Builder.NumClasses());
+    ResultJson->SetNumberField(TEXT("string_count"), Builder.NumStrings());
+    ResultJson->SetNumberField(TEXT("property_count"), Builder.NumProperties());
+    ResultJson->SetNumberField(TEXT("bytes"), Bytes.Num());
+    return ResultJson;
+}
+
+TSharedPtr<FJsonObject> FUmgBinarySnapshot::ApplyFromFile(const FString& FilePath, const FString& AssetPath, const FString& TargetWidgetName)
+{
+    check(IsInGameThread());
+
+    const FString SnapshotPath = ResolveSnapshotPath(FilePath);
+    FMappedSnapshotFile File;
+    if (FilePath.IsEmpty() || !File.Open(SnapshotPath))
+    {
+        return MakeError(TEXT("file_unavailable"), FString::Printf(TEXT("Snapshot '%s' could not be opened."), *SnapshotPath));
+    }
+    const FMemoryView View = File.View;
+
+    // 1. Header and section bounds; every record below is read in place.
+    const FSnapshotHeader* Header = GetRecords<FSnapshotHeader>(View, 0, 1);
+    if (!Header || Header->Magic != SnapshotMagic)
+    {
+        return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("'%s' is not a UMG snapshot."), *SnapshotPath));
+    }
+    if (Header->Version != FormatVersion)
+    {
+        return MakeError(TEXT("stale_snapshot"), FString::Printf(TEXT("Snapshot '%s' has format version %u; this build reads %u. Export it again."),
+            *SnapshotPath, Header->Version, FormatVersion));
+    }
+
+    const FSnapshotClassRecord* Classes = GetRecords<FSnapshotClassRecord>(View, Header->ClassesOffset, Header->NumClasses);
+    const FSnapshotWidgetRecord* Widgets = GetRecords<FSnapshotWidgetRecord>(View, Header->WidgetsOffset, Header->NumWidgets);
+    const FSnapshotPropertyRecord* Properties = GetRecords<FSnapshotPropertyRecord>(View, Header->PropertiesOffset, Header->NumProperties);
+    const bool bSectionsValid = Classes && Widgets && Properties && Header->NumWidgets > 0
+        && Header->StringsOffset <= View.GetSize() && Header->StringsSize <= View.GetSize() - Header->StringsOffset
+        && Header->BlobOffset <= View.GetSize() && Header->BlobSize <= View.GetSize() - Header->BlobOffset;
+    if (!bSectionsValid)
+    {
+        return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("Snapshot '%s' is truncated or corrupt."), *SnapshotPath));
+    }
+
+    // The table is TArray<FString> in archive form. Its counts come from the file, so each one is checked against the
+    // section size before anything is allocated for it.
+    TArray<FString> Strings;
+    {
+        FMemoryView Cursor = View.Mid(Header->StringsOffset, Header->StringsSize);
+        int32 NumStrings = 0;
+        bool bTableValid = ReadInt32(Cursor, NumStrings) && NumStrings == Header->NumStrings && NumStrings >= 0
+            && static_cast<uint64>(NumStrings) * sizeof(int32) <= Cursor.GetSize();
+        if (bTableValid)
+        {
+            Strings.Reserve(NumStrings);
+        }
+        for (int32 StringIndex = 0; bTableValid && StringIndex < NumStrings; ++StringIndex)
+        {
+            const uint8* Start = static_cast<const uint8*>(Cursor.GetData());
+            int32 SaveNum = 0;
+            bTableValid = ReadInt32(Cursor, SaveNum) && SaveNum != MIN_int32
+                && SkipBytes(Cursor, SaveNum < 0 ? static_cast<uint64>(-SaveNum) * sizeof(UTF16CHAR) : static_cast<uint64>(SaveNum));
+            if (bTableValid)
+            {
+                FMemoryReaderView StringReader(FMemoryView(Start, static_cast<const uint8*>(Cursor.GetData()) - Start), true);
+                StringReader << Strings.AddDefaulted_GetRef();
+                bTableValid = !StringReader.IsError();
+            }
+        }
+        if (!bTableValid || !Cursor.IsEmpty())
+        {
+            return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("Snapshot '%s' has a corrupt string table."), *SnapshotPath));
+        }
+    }
+
+    // 2. Resolve every class and compare its layout with the one the values were written against.
+    TArray<UClass*> ResolvedClasses;
+    TArray<FString> StaleClasses;
+    for (int32 ClassIndex = 0; ClassIndex < Header->NumClasses; ++ClassIndex)
+    {
+        const FSnapshotClassRecord& Record = Classes[ClassIndex];
+        if (!Strings.IsValidIndex(Record.PathIndex))
+        {
+            return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("Snapshot '%s' has a corrupt class table."), *SnapshotPath));
+        }
+        const FString& ClassPath = Strings[Record.PathIndex];
+        UClass* Class = FUmgWidgetClassResolver::Get().Resolve(ClassPath);
+        if (!Class)
+        {
+            return MakeError(TEXT("unknown_class"), FString::Printf(TEXT("Widget class '%s' could not be resolved."), *ClassPath));
+        }
+        if (ComputeClassFingerprint(Class) != Record.Fingerprint)
+        {
+            StaleClasses.Add(ClassPath);
+        }
+        ResolvedClasses.Add(Class);
+    }
+    if (StaleClasses.Num() > 0)
+    {
+        return MakeError(TEXT("stale_snapshot"), FString::Printf(TEXT("Classes changed since '%s' was written: %s. Export it again."),
+            *SnapshotPath, *FString::Join(StaleClasses, TEXT(", "))));
+    }
+
+    // 3. Check the records and bind every property record to its reflected property.
+    TArray<FProperty*> ResolvedProperties;
+    ResolvedProperties.SetNumZeroed(Header->NumProperties);
+    TMap<TPair<const UClass*, int32>, FProperty*> PropertyLookups;
+    auto IsClassOf = [&ResolvedClasses](int32 ClassIndex, const UClass* BaseClass)
+    {
+        return ResolvedClasses.IsValidIndex(ClassIndex) && ResolvedClasses[ClassIndex]->IsChildOf(BaseClass);
+    };
+    for (int32 WidgetIndex = 0; WidgetIndex < Header->NumWidgets; ++WidgetIndex)
+    {
+        const FSnapshotWidgetRecord& Record = Widgets[WidgetIndex];
+        const bool bRecordValid = Strings.IsValidIndex(Record.NameIndex)
+            && IsClassOf(Record.ClassIndex, UWidget::StaticClass())
+            && (Record.SlotClassIndex == INDEX_NONE || IsClassOf(Record.SlotClassIndex, UPanelSlot::StaticClass()))
+            && (WidgetIndex == 0 ? Record.ParentIndex == INDEX_NONE : (Record.ParentIndex >= 0 && Record.ParentIndex < WidgetIndex))
+            && (WidgetIndex == 0 || IsClassOf(Widgets[Record.ParentIndex].ClassIndex, UPanelWidget::StaticClass()))
+            && Record.FirstProperty >= 0 && Record.NumProperties >= 0 && Record.NumSlotProperties >= 0
+            && Record.NumSlotProperties <= Record.NumProperties
+            && Record.FirstProperty <= Header->NumProperties - Record.NumProperties
+            && (Record.NumSlotProperties == 0 || Record.SlotClassIndex != INDEX_NONE);
+        if (!bRecordValid)
+        {
+            return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("Snapshot '%s' has a corrupt widget record (%d)."), *SnapshotPath, WidgetIndex));
+        }
+
+        const int32 FirstSlotProperty = Record.FirstProperty + Record.NumProperties - Record.NumSlotProperties;
+        for (int32 PropertyIndex = Record.FirstProperty; PropertyIndex < Record.FirstProperty + Record.NumProperties; ++PropertyIndex)
+        {
+            const FSnapshotPropertyRecord& PropertyRecord = Properties[PropertyIndex];
+            const UClass* Owner = ResolvedClasses[PropertyIndex < FirstSlotProperty ? Record.ClassIndex : Record.SlotClassIndex];
+            if (!Strings.IsValidIndex(PropertyRecord.NameIndex) || PropertyRecord.BlobSize < 0
+                || PropertyRecord.BlobOffset > Header->BlobSize || static_cast<uint64>(PropertyRecord.BlobSize) > Header->BlobSize - PropertyRecord.BlobOffset)
+            {
+                return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("Snapshot '%s' has a corrupt property record (%d)."), *SnapshotPath, PropertyIndex));
+            }
+
+            const TPair<const UClass*, int32> LookupKey(Owner, PropertyRecord.NameIndex);
+            FProperty** Found = PropertyLookups.Find(LookupKey);
+            FProperty* Property = Found ? *Found : PropertyLookups.Add(LookupKey, FindFProperty<FProperty>(Owner, FName(*Strings[PropertyRecord.NameIndex])));
+            if (!Property)
+            {
+                return MakeError(TEXT("stale_snapshot"), FString::Printf(TEXT("Property '%s' no longer exists on '%s'. Export the snapshot again."),
+                    *Strings[PropertyRecord.NameIndex], *Owner->GetPathName()));
+            }
+            if (!IsSnapshotProperty(Property))
+            {
+                // The writer never stores these, so the record was not written by it.
+                return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("Snapshot '%s' stores '%s', which snapshots do not carry (record %d)."),
+                    *SnapshotPath, *Property->GetName(), PropertyIndex));
+            }
+                        ResolvedProperties[PropertyIndex] = Property;
+        }
+    }
+
+    // Dry run: decode every value into scratch memory, so a truncated or corrupt blob is rejected before the asset
+    // is touched instead of leaving half-initialized widgets behind. Referenced objects are resolved here and cached.
+    const FMemoryView BlobView = View.Mid(Header->BlobOffset, Header->BlobSize);
+    FSnapshotReader Blob(BlobView, Strings);
+    for (int32 PropertyIndex = 0; PropertyIndex < Header->NumProperties; ++PropertyIndex)
+    {
+        FProperty* Property = ResolvedProperties[PropertyIndex];
+        if (Property && !DecodesCleanly(Blob, BlobView, Property, Properties[PropertyIndex]))
+        {
+            return MakeError(TEXT("invalid_snapshot"), FString::Printf(TEXT("Snapshot '%s' has a corrupt value for '%s' (record %d)."),
+                *SnapshotPath, *Property->GetName(), PropertyIndex));
+        }
+    }
+
+    // 4. Target asset and widget.
+    const FString FinalAssetPath = ResolveAssetPath(AssetPath);
+    UWidgetBlueprint* WidgetBlueprint = LoadWidgetBlueprint(FinalAssetPath);
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        return MakeError(TEXT("asset_unavailable"), FString::Printf(TEXT("Failed to load a Widget Blueprint from '%s'."), *FinalAssetPath));
+    }
+    UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+
+    UWidget* TargetWidget = IsRootName(TargetWidgetName) ? WidgetTree->RootWidget.Get() : FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, TargetWidgetName);
+    if (!TargetWidget && !IsRootName(TargetWidgetName))
+    {
+        return MakeError(TEXT("widget_not_found"), FString::Printf(TEXT("Widget '%s' not found in '%s'."), *TargetWidgetName, *FinalAssetPath));
+    }
+    UPanelWidget* TargetPanel = Cast<UPanelWidget>(TargetWidget);
+    if (TargetWidget && (!TargetPanel || !TargetPanel->CanAddMoreChildren()))
+    {
+        return MakeError(TEXT("invalid_target"), FString::Printf(TEXT("Widget '%s' cannot take another child."), *TargetWidget->GetName()));
+    }
+
+    // 5. Names already taken in the asset (or earlier in this snapshot) get a unique suffix.
+    TArray<FName> Names;
+    Names.Reserve(Header->NumWidgets);
+    TSet<FName> UsedNames;
+    TSharedPtr<FJsonObject> Renamed = MakeShared<FJsonObject>();
+    for (int32 WidgetIndex = 0; WidgetIndex < Header->NumWidgets; ++WidgetIndex)
+    {
+        const FSnapshotWidgetRecord& Record = Widgets[WidgetIndex];
+        const FName SourceName(*Strings[Record.NameIndex]);
+        FName Name = SourceName;
+        while (UsedNames.Contains(Name) || StaticFindObjectFast(nullptr, WidgetTree, Name))
+        {
+            Name = MakeUniqueObjectName(WidgetTree, ResolvedClasses[Record.ClassIndex], SourceName);
+        }
+        if (Name != SourceName)
+        {
+            Renamed->SetStringField(SourceName.ToString(), Name.ToString());
+        }
+        UsedNames.Add(Name);
+        Names.Add(Name);
+    }
+
+    // 6. Everything is checked; create the widgets and copy the stored values into them.
+    WidgetBlueprint->Modify();
+
+    int32 PropertiesWritten = 0;
+    TArray<FString> FailedProperties;
+    auto ReadProperties = [&](UObject* Object, int32 First, int32 Count)
+    {
+        for (int32 PropertyIndex = First; PropertyIndex < First + Count; ++PropertyIndex)
+        {
+            const FSnapshotPropertyRecord& Record = Properties[PropertyIndex];
+            FProperty* Property = ResolvedProperties[PropertyIndex];
+            Blob.SeekRecord(Record);
+            {
+                FStructuredArchiveFromArchive Adapter(Blob);
+                Property->SerializeItem(Adapter.GetSlot(), Property->ContainerPtrToValuePtr<void>(Object), nullptr);
+            }
+            if (Blob.IsError() || Blob.Tell() != static_cast<int64>(Record.BlobOffset) + Record.BlobSize)
+            {
+                FailedProperties.Add(FString::Printf(TEXT("%s.%s"), *Object->GetName(), *Property->GetName()));
+                Blob.ClearError();
+                continue;
+            }
+            ++PropertiesWritten;
+        }
+    };
+
+    TArray<UWidget*> Created;
+    Created.Reserve(Header->NumWidgets);
+    bool bSkippedRootSlot = false;
+    for (int32 WidgetIndex = 0; WidgetIndex < Header->NumWidgets; ++WidgetIndex)
+    {
+        const FSnapshotWidgetRecord& Record = Widgets[WidgetIndex];
+        UWidget* Widget = NewObject<UWidget>(WidgetTree, ResolvedClasses[Record.ClassIndex], Names[WidgetIndex]);
+        Created.Add(Widget);
+
+        UPanelWidget* Parent = Record.ParentIndex == INDEX_NONE ? TargetPanel : Cast<UPanelWidget>(Created[Record.ParentIndex]);
+        UPanelSlot* Slot = nullptr;
+        if (Parent)
+        {
+            Slot = Parent->AddChild(Widget);
+            if (!Slot)
+            {
+                UE_LOG(LogUmgMcp, Warning, TEXT("FUmgBinarySnapshot: '%s' refused child '%s'."), *Parent->GetName(), *Widget->GetName());
+            }
+        }
+        else
+        {
+            WidgetTree->RootWidget = Widget;
+        }
+
+        ReadProperties(Widget, Record.FirstProperty, Record.NumProperties - Record.NumSlotProperties);
+
+        // Inner slots come from the snapshot's own panels; the root's comes from the target and may be another class.
+        if (Record.NumSlotProperties > 0)
+        {
+            if (Slot && Slot->GetClass() == ResolvedClasses[Record.SlotClassIndex])
+            {
+                ReadProperties(Slot, Record.FirstProperty + Record.NumProperties - Record.NumSlotProperties, Record.NumSlotProperties);
+            }
+            else
+            {
+                bSkippedRootSlot |= WidgetIndex == 0;
+            }
+        }
+    }
+
+#if WITH_EDITORONLY_DATA
+    // Register variable GUIDs for the stamped widgets, as CreateWidgetSubtree does, so compiling or renaming them works.
+    for (UWidget* Widget : Created)
+    {
+        const FGuid* ExistingGuid = WidgetBlueprint->WidgetVariableNameToGuidMap.Find(Widget->GetFName());
+        if (!ExistingGuid || !ExistingGuid->IsValid())
+        {
+            WidgetBlueprint->WidgetVariableNameToGuidMap.Add(Widget->GetFName(), FGuid::NewGuid());
+        }
+    }
+#endif
+
+    FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
+    if (UPackage* Package = WidgetBlueprint->GetOutermost())
+    {
+        Package->MarkPackageDirty();
+    }
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+
+    UE_LOG(LogUmgMcp, Log, TEXT("FUmgBinarySnapshot: Stamped %d widgets from '%s' into '%s' under '%s' (%s)."),
+        Created.Num(), *SnapshotPath, *FinalAssetPath, TargetWidget ? *TargetWidget->GetName() : TEXT("Root"), File.IsMapped() ? TEXT("mapped") : TEXT("read"));
+
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    ResultJson->SetBoolField(TEXT("success"), true);
+    ResultJson->SetStringField(TEXT("asset_path"), FinalAssetPath);
+    ResultJson->SetStringField(TEXT("target_widget"), TargetWidget ? TargetWidget->GetName() : FString());
+    ResultJson->SetStringField(TEXT("root_widget"), Created[0]->GetName());
+    ResultJson->SetNumberField(TEXT("widgets_created"), Created.Num());
+    ResultJson->SetNumberField(TEXT("properties_written"), PropertiesWritten);
+    if (Renamed->Values.Num() > 0)
+    {
+        ResultJson->SetObjectField(TEXT("renamed"), Renamed);
+    }
+    if (bSkippedRootSlot)
+    {
+        // The template was captured under a different panel type, so its slot layout does not apply here.
+        ResultJson->SetBoolField(TEXT("root_slot_skipped"), true);
+    }
+    if (FailedProperties.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> FailedJson;
+        for (const FString& Failed : FailedProperties)
+        {
+            FailedJson.Add(MakeShared<FJsonValueString>(Failed));
+        }
+        ResultJson->SetArrayField(TEXT("failed_properties"), FailedJson);
+    }
+    if (Blob.UnresolvedPaths.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> UnresolvedJson;
+        for (const FString& Path : Blob.UnresolvedPaths)
+        {
+            UnresolvedJson.Add(MakeShared<FJsonValueString>(Path));
+        }
+        ResultJson->SetArrayField(TEXT("unresolved_references"), UnresolvedJson);
+    }
+    return ResultJson;
+}
@@ -0,0 +1,211 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "FileManage/UmgDependencyPrefetcher.h"
+#include "UmgMcp.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    static int64 EstimatePackageBytes(const IAssetRegistry& AssetRegistry, FName PackageName)
+    {
+        const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+        if (PackageData.IsSet() && PackageData->DiskSize > 0)
+        {
+            return PackageData->DiskSize;
+        }
+
+        FString FileName;
+        if (FPackageName::DoesPackageExist(PackageName.ToString(), &FileName))
+        {
+            return FMath::Max<int64>(IFileManager::Get().FileSize(*FileName), 0);
+        }
+        return 0;
+    }
+}
+
+FUmgDependencyPrefetcher::~FUmgDependencyPrefetcher()
+{
+    Cancel();
+}
+
+void FUmgDependencyPrefetcher::Start(const FString& PackageName, int64 BudgetBytes)
+{
+    // Re-selecting the current target must not throw away a walk in progress or the assets it already holds.
+    if (Progress.PackageName == PackageName && Progress.BudgetBytes == BudgetBytes && (TickHandle.IsValid() || Handle.IsValid()))
+    {
+        return;
+    }
+
+    Cancel();
+
+    Progress.PackageName = PackageName;
+    Progress.BudgetBytes = BudgetBytes;
+
+    if (IsRunningCommandlet() || !UAssetManager::IsInitialized())
+    {
+        return;
+    }
+
+    // Breadth first, so the target's direct references win the budget over what they reference in turn.
+    WalkQueue.Add(FName(*PackageName));
+    Visited.Add(WalkQueue[0]);
+    Progress.bWalking = true;
+    Progress.bComplete = false;
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FUmgDependencyPrefetcher::TickWalk));
+}
+
+bool FUmgDependencyPrefetcher::TickWalk(float DeltaTime)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+    while (WalkIndex < WalkQueue.Num() && FPlatformTime::Seconds() - StartTime < WalkBudgetSeconds)
+    {
+        TArray<FName> Dependencies;
+        // No query flags: hard references and soft ones (soft object paths, primary asset lists) alike.
+        AssetRegistry.GetDependencies(WalkQueue[WalkIndex++], Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+
+        for (const FName Dependency : Dependencies)
+        {
+            if (Visited.Num() >= MaxVisitedPackages)
+            {
+                break;
+            }
+            if (Visited.Contains(Dependency))
+            {
+                continue;
+            }
+            Visited.Add(Dependency);
+
+            // Native classes are always resident, and only mounted content packages can be streamed.
+            FNameBuilder DependencyName(Dependency);
+            if (FPackageName::IsScriptPackage(DependencyName.ToView()) || !FPackageName::IsValidLongPackageName(DependencyName.ToView()))
+            {
+                continue;
+            }
+
+            if (FindPackage(nullptr, DependencyName.ToString()))
+            {
+                // Already loaded: nothing to stream, but what it references may not be.
+                ++Progress.ResidentPackages;
+                WalkQueue.Add(Dependency);
+                continue;
+            }
+
+            const int64 PackageBytes = EstimatePackageBytes(AssetRegistry, Dependency);
+            if (Progress.EstimatedBytes + PackageBytes > Progress.BudgetBytes)
+            {
+                ++Progress.SkippedOverBudget;
+                continue;
+            }
+
+            TArray<FAssetData> Assets;
+            AssetRegistry.GetAssetsByPackageName(Dependency, Assets);
+            if (Assets.Num() == 0)
+            {
+                continue;
+            }
+
+            for (const FAssetData& Asset : Assets)
+            {
+                PathsToLoad.Add(Asset.GetSoftObjectPath());
+            }
+            Progress.EstimatedBytes += PackageBytes;
+            ++Progress.RequestedPackages;
+            WalkQueue.Add(Dependency);
+        }
+    }
+
+    if (WalkIndex < WalkQueue.Num())
+    {
+        return true;
+    }
+
+    TickHandle.Reset();
+    RequestLoad();
+    return false;
+}
+
+void FUmgDependencyPrefetcher::RequestLoad()
+{
+    WalkQueue.Empty();
+    WalkIndex = 0;
+    Visited.Empty();
+    Progress.bWalking = false;
+    Progress.bComplete = true;
+
+    Progress.RequestedAssets = PathsToLoad.Num();
+    if (PathsToLoad.Num() == 0)
+    {
+        return;
+    }
+
+    // Below the preloader's high priority, so assets a running command is waiting for are served first.
+    Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        MoveTemp(PathsToLoad),
+        FStreamableDelegate(),
+        FStreamableManager::DefaultAsyncLoadPriority);
+    PathsToLoad.Reset();
+
+    if (!Handle.IsValid())
+    {
+        UE_LOG(LogUmgMcp, Warning, TEXT("FUmgDependencyPrefetcher: Async load request for '%s' failed; dependencies will load on demand."), *Progress.PackageName);
+        Progress.RequestedPackages = 0;
+        Progress.RequestedAssets = 0;
+        Progress.EstimatedBytes = 0;
+        return;
+    }
+
+    Progress.bComplete = Handle->HasLoadCompleted();
+    UE_LOG(LogUmgMcp, Log, TEXT("FUmgDependencyPrefetcher: Streaming %d packages (%lld bytes on disk) for '%s'; %d resident, %d over budget."),
+        Progress.RequestedPackages, Progress.EstimatedBytes, *Progress.PackageName, Progress.ResidentPackages, Progress.SkippedOverBudget);
+}
+
+void FUmgDependencyPrefetcher::Cancel()
+{
+    if (TickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+    WalkQueue.Empty();
+    WalkIndex = 0;
+    Visited.Empty();
+    PathsToLoad.Empty();
+
+    if (Handle.IsValid())
+    {
+        if (Handle->IsLoadingInProgress())
+        {
+            Handle->CancelHandle();
+        }
+        else
+        {
+            Handle->ReleaseHandle();
+        }
+        Handle.Reset();
+    }
+
+    // Nothing is prefetched for a cleared or failed target, so get_target_umg_asset must not keep reporting the old one.
+    Progress = FUmgPrefetchProgress();
+}
+
+FUmgPrefetchProgress FUmgDependencyPrefetcher::GetProgress() const
+{
+    FUmgPrefetchProgress Result = Progress;
+    if (Handle.IsValid())
+    {
+        int32 Loaded = 0;
+        int32 Requested = 0;
+        Handle->GetLoadedCount(Loaded, Requested);
+        Result.LoadedAssets = Loaded;
+        Result.bComplete = Handle->HasLoadCompleted();
+    }
+    return Result;
+}
@@ -0,0 +1,161 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "FileManage/UmgExportPlanCache.h"
+#include "Components/PanelSlot.h"
+#include "Editor.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    static bool IsPlainValueProperty(const FProperty* Property)
+    {
+        if (Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>() || Property->IsA<FEnumProperty>()
+            || Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FTextProperty>())
+        {
+            return true;
+        }
+        if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+        {
+            if (!StructProperty->Struct || !(StructProperty->Struct->StructFlags & STRUCT_Native))
+            {
+                return false;
+            }
+            for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+            {
+                if (!IsPlainValueProperty(*It))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            return IsPlainValueProperty(ArrayProperty->Inner);
+        }
+        if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            return IsPlainValueProperty(SetProperty->ElementProp);
+        }
+        if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+        {
+            return IsPlainValueProperty(MapProperty->KeyProp) && IsPlainValueProperty(MapProperty->ValueProp);
+        }
+        return false;
+    }
+}
+
+FUmgExportPlanCache& FUmgExportPlanCache::Get()
+{
+    static FUmgExportPlanCache Instance;
+    return Instance;
+}
+
+TSharedRef<const FUmgExportPlan> FUmgExportPlanCache::GetPlan(const UClass* Class)
+{
+    check(IsInGameThread());
+    check(Class);
+
+    BindHooks();
+
+    // The weak pointer catches a collected class whose address was reused by a new one.
+    if (const TSharedRef<const FUmgExportPlan>* Cached = Plans.Find(Class); Cached && (*Cached)->Class.Get() == Class)
+    {
+        return *Cached;
+    }
+
+    TSharedRef<const FUmgExportPlan> Plan = BuildPlan(Class);
+    Plans.Add(Class, Plan);
+    return Plan;
+}
+
+TSharedRef<const FUmgExportPlan> FUmgExportPlanCache::BuildPlan(const UClass* Class)
+{
+    static const FName SlotName(TEXT("Slot"));
+    static const FName ContentName(TEXT("Content"));
+    static const FName ParentName(TEXT("Parent"));
+
+    TSharedRef<FUmgExportPlan> Plan = MakeShared<FUmgExportPlan>();
+    Plan->Class = Class;
+
+    const bool bIsSlotClass = Class->IsChildOf(UPanelSlot::StaticClass());
+    const UObject* Defaults = Class->GetDefaultObject();
+
+    for (TFieldIterator<FProperty> PropIt(Class); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        if (!Property->HasAnyPropertyFlags(CPF_Edit) || Property->HasAnyPropertyFlags(CPF_Transient))
+        {
+            continue;
+        }
+
+        const FName PropertyName = Property->GetFName();
+        if (bIsSlotClass)
+        {
+            if (PropertyName == ContentName || PropertyName == ParentName)
+            {
+                continue;
+            }
+        }
+#if WITH_EDITOR
+        else if (Property->HasAnyPropertyFlags(CPF_EditorOnly))
+        {
+            continue;
+        }
+#endif
+
+        FUmgExportProperty& Entry = Plan->Properties.AddDefaulted_GetRef();
+        Entry.Property = Property;
+        Entry.Name = Property->GetName();
+        Entry.Offset = Property->GetOffset_ForInternal();
+        Entry.DefaultValue = Property->ContainerPtrToValuePtr<void>(Defaults);
+        Entry.bIsSlot = !bIsSlotClass && PropertyName == SlotName && CastField<FObjectProperty>(Property) != nullptr;
+
+        // Blueprint-declared properties are freed when their class is recompiled, so only native ones outlive the game-thread pass.
+        const UClass* OwnerClass = Property->GetOwnerClass();
+        Entry.bCopyByValue = !Entry.bIsSlot && OwnerClass && OwnerClass->HasAnyClassFlags(CLASS_Native) && IsPlainValueProperty(Property);
+    }
+
+    return Plan;
+}
+
+void FUmgExportPlanCache::Invalidate()
+{
+    Plans.Reset();
+}
+
+void FUmgExportPlanCache::Reset()
+{
+    if (GEditor && BlueprintCompiledHandle.IsValid())
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    BlueprintCompiledHandle.Reset();
+    FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+    ObjectsReinstancedHandle.Reset();
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    ReloadCompleteHandle.Reset();
+    Invalidate();
+}
+
+void FUmgExportPlanCache::BindHooks()
+{
+    if (GEditor && !BlueprintCompiledHandle.IsValid())
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FUmgExportPlanCache::Invalidate);
+    }
+    if (!ObjectsReinstancedHandle.IsValid())
+    {
+        ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([this](const TMap<UObject*, UObject*>&)
+        {
+            Invalidate();
+        });
+    }
+    if (!ReloadCompleteHandle.IsValid())
+    {
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+        {
+            Invalidate();
+        });
+    }
+}
@@ -2,8 +2,14 @@
 #include "FileManage/UmgFileTransformation.h"
 #include "Bridge/UmgMcpJsonCompat.h"
 #include "UmgMcp.h"
-#include "PropertyNameMappings.h"
+#include "Widget/UmgPropertyPathCache.h"
+#include "Widget/UmgWidgetIndex.h"
+#include "Widget/UmgWidgetClassResolver.h"
+#include "Widget/UmgOrderPlanner.h"
+#include "Widget/UmgSetSubsystem.h"
 #include "FileManage/UmgAttentionSubsystem.h"
+#include "FileManage/UmgExportPlanCache.h"
+#include "FileManage/UmgLayoutJsonStream.h"
 
 #include "Blueprint/UserWidget.h"
 #include "WidgetBlueprint.h"
@@ -19,35 +25,54 @@
 #include "Misc/PackageName.h"
 #include "UObject/ObjectMacros.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Hash/xxhash.h"
 #include "WidgetBlueprintFactory.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 
 // Forward declarations
+static UWidget* CreateSingleWidget(const FString& WidgetName, const FString& WidgetClassPath, const TSharedPtr<FJsonObject>& Properties, UWidgetTree* WidgetTree, UWidget* ParentWidget);
 static UWidget* CreateWidgetFromJson(const TSharedPtr<FJsonObject>& WidgetJson, UWidgetTree* WidgetTree, UWidget* ParentWidget);
+static UWidget* CreateWidgetsFromStream(const FUmgPreparedLayout& Layout, UWidgetTree* WidgetTree, UWidget* ParentWidget);
 static void ApplyPropertiesToExistingWidget(const TSharedPtr<FJsonObject>& WidgetJson, UWidget* TargetWidget);
 static void MergeChildrenAppendOnly(const TSharedPtr<FJsonObject>& WidgetJson, UWidgetTree* WidgetTree, UWidget* TargetWidget);
 static void UpsertWidgetFromJsonAppendOnly(const TSharedPtr<FJsonObject>& WidgetJson, UWidgetTree* WidgetTree, UWidget* TargetWidget);
 
-struct FJsonWidgetInfo
+// Walks the payload without touching UObjects. The root may omit widget_name / widget_class when it only merges
+// into the apply target; every other node must name itself and its class.
+static bool CollectJsonWidgetInfos(const TSharedPtr<FJsonObject>& JsonNode, const FString& ParentName, bool bIsRoot, FUmgPreparedLayout& Layout)
 {
-    FString Name;
-    FString ClassPath;
-    FString ParentName;
-};
-
-static void CollectJsonWidgetInfos(const TSharedPtr<FJsonObject>& JsonNode, const FString& ParentName, TMap<FString, FJsonWidgetInfo>& OutMap)
-{
-    if (!JsonNode.IsValid()) return;
+    if (!JsonNode.IsValid())
+    {
+        return true;
+    }
 
-    FJsonWidgetInfo Info;
+    FUmgJsonWidgetInfo Info;
     JsonNode->TryGetStringField(TEXT("widget_name"), Info.Name);
     JsonNode->TryGetStringField(TEXT("widget_class"), Info.ClassPath);
     Info.ParentName = ParentName;
 
+    if (!bIsRoot && (Info.Name.IsEmpty() || Info.ClassPath.IsEmpty()))
+    {
+        Layout.ErrorCode = TEXT("invalid_node");
+        Layout.Error = FString::Printf(TEXT("A child of '%s' is missing widget_name or widget_class."), ParentName.IsEmpty() ? TEXT("the target widget") : *ParentName);
+        return false;
+    }
+
     if (!Info.Name.IsEmpty())
     {
-        OutMap.Add(Info.Name, Info);
+        if (Layout.Widgets.Contains(Info.Name))
+        {
+            Layout.ErrorCode = TEXT("duplicate_name");
+            Layout.Error = FString::Printf(TEXT("Widget name '%s' appears more than once in the layout."), *Info.Name);
+            return false;
+        }
+        Layout.Widgets.Add(Info.Name, Info);
+    }
+    if (!Info.ClassPath.IsEmpty())
+    {
+        Layout.ClassPaths.AddUnique(Info.ClassPath);
     }
 
     const TArray<TSharedPtr<FJsonValue>>* ChildrenArray = nullptr;
@@ -56,87 +81,52 @@ static void CollectJsonWidgetInfos(const TSharedPtr<FJsonObject>& JsonNode, cons
         for (const auto& ChildVal : *ChildrenArray)
         {
             const TSharedPtr<FJsonObject>* ChildObj;
-            if (ChildVal->TryGetObject(ChildObj))
+            if (ChildVal->TryGetObject(ChildObj) && !CollectJsonWidgetInfos(*ChildObj, Info.Name, false, Layout))
             {
-                CollectJsonWidgetInfos(*ChildObj, Info.Name, OutMap);
+                return false;
             }
         }
     }
+    return true;
 }
 
-bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& JsonData, const FString& TargetWidgetName);
+void UUmgFileTransformation::NormalizeJsonKeysInPlace(const TSharedPtr<FJsonObject>& JsonObject, const UStruct* OwnerStruct)
+{
+    FUmgPropertyPathCache::Get().NormalizeJsonKeysInPlace(JsonObject, OwnerStruct);
+}
 
-TSharedPtr<FJsonObject> UUmgFileTransformation::NormalizeJsonKeysToPascalCase(const TSharedPtr<FJsonObject>& SourceJson)
+// Writes the planned properties of Object that differ from the class default.
+static void ExportPlannedProperties(const FUmgExportPlan& Plan, const UObject* Object, FJsonObject& OutProperties)
 {
-    if (!SourceJson.IsValid())
-    {
-        return nullptr;
-    }
-    
-    TSharedPtr<FJsonObject> NormalizedJson = MakeShared<FJsonObject>();
-    
-    for (const auto& Pair : SourceJson->Values)
+    for (const FUmgExportProperty& Entry : Plan.Properties)
     {
-        FString OriginalKey = UmgMcpJsonCompat::KeyToString(Pair.Key);
-        FString NormalizedKey;
-        
-        // Handle dotted keys (e.g. "slot.position")
-        if (OriginalKey.Contains(TEXT(".")))
-        {
-            TArray<FString> Parts;
-            OriginalKey.ParseIntoArray(Parts, TEXT("."));
-            for (int32 i = 0; i < Parts.Num(); ++i)
-            {
-                Parts[i] = NormalizePropertyName(Parts[i]);
-            }
-            NormalizedKey = FString::Join(Parts, TEXT("."));
-        }
-        else
+        const void* ValuePtr = Entry.GetValue(Object);
+        if (Entry.Property->Identical(ValuePtr, Entry.DefaultValue))
         {
-            NormalizedKey = NormalizePropertyName(OriginalKey);
+            continue;
         }
 
-        if (NormalizedKey != OriginalKey)
-        {
-            UE_LOG(LogUmgMcp, Verbose, TEXT("NormalizeJsonKeys: '%s' → '%s'"), *OriginalKey, *NormalizedKey);
-        }
-        
-        // Recursively process nested objects and arrays
-        TSharedPtr<FJsonValue> Value = Pair.Value;
-        if (Value->Type == EJson::Object)
+        if (Entry.bIsSlot)
         {
-            TSharedPtr<FJsonObject> NestedObj = Value->AsObject();
-            TSharedPtr<FJsonObject> NormalizedNestedObj = NormalizeJsonKeysToPascalCase(NestedObj);
-            NormalizedJson->SetObjectField(NormalizedKey, NormalizedNestedObj);
-        }
-        else if (Value->Type == EJson::Array)
-        {
-            // Process objects within arrays
-            TArray<TSharedPtr<FJsonValue>> SourceArray = Value->AsArray();
-            TArray<TSharedPtr<FJsonValue>> NormalizedArray;
-            
-            for (const TSharedPtr<FJsonValue>& ArrayValue : SourceArray)
+            const UPanelSlot* SlotObject = Cast<UPanelSlot>(CastFieldChecked<FObjectProperty>(Entry.Property)->GetObjectPropertyValue(ValuePtr));
+            if (SlotObject)
             {
-                if (ArrayValue->Type == EJson::Object)
-                {
-                    TSharedPtr<FJsonObject> NormalizedArrayObj = NormalizeJsonKeysToPascalCase(ArrayValue->AsObject());
-                    NormalizedArray.Add(MakeShared<FJsonValueObject>(NormalizedArrayObj));
-                }
-                else
+                TSharedPtr<FJsonObject> SlotPropertiesJson = MakeShared<FJsonObject>();
+                ExportPlannedProperties(*FUmgExportPlanCache::Get().GetPlan(SlotObject->GetClass()), SlotObject, *SlotPropertiesJson);
+                if (SlotPropertiesJson->Values.Num() > 0)
                 {
-                    NormalizedArray.Add(ArrayValue);
+                    OutProperties.SetObjectField(Entry.Name, SlotPropertiesJson);
                 }
             }
-            NormalizedJson->SetArrayField(NormalizedKey, NormalizedArray);
+            continue;
         }
-        else
+
+        TSharedPtr<FJsonValue> PropertyJsonValue = FJsonObjectConverter::UPropertyToJsonValue(Entry.Property, ValuePtr);
+        if (PropertyJsonValue.IsValid())
         {
-            // Primitive types: copy directly
-            NormalizedJson->SetField(NormalizedKey, Value);
+            OutProperties.SetField(Entry.Name, PropertyJsonValue);
         }
     }
-    
-    return NormalizedJson;
 }
 
 TSharedPtr<FJsonObject> UUmgFileTransformation::ExportWidgetToJson(UWidget* Widget)
@@ -148,193 +138,1594 @@ TSharedPtr<FJsonObject> UUmgFileTransformation::ExportWidgetToJson(UWidget* Widg
     }
 
     TSharedPtr<FJsonObject> WidgetJson = MakeShared<FJsonObject>();
-    UObject* DefaultWidget = Widget->GetClass()->GetDefaultObject();
 
     // 1. Add basic information
     WidgetJson->SetStringField(TEXT("widget_name"), Widget->GetName());
     WidgetJson->SetStringField(TEXT("widget_class"), Widget->GetClass()->GetPathName());
 
-    // 2. Iterate over all properties and only add non-default ones
+    // 2. Add the non-default properties; the per-class plan has already filtered reflection down to exportable ones.
     TSharedPtr<FJsonObject> PropertiesJson = MakeShared<FJsonObject>();
+    ExportPlannedProperties(*FUmgExportPlanCache::Get().GetPlan(Widget->GetClass()), Widget, *PropertiesJson);
+
+    if (PropertiesJson->Values.Num() > 0)
+    {
+        WidgetJson->SetObjectField(TEXT("properties"), PropertiesJson);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ChildrenJsonArray;
+    if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
+    {
+        ChildrenJsonArray.Reserve(PanelWidget->GetChildrenCount());
+        for (int32 i = 0; i < PanelWidget->GetChildrenCount(); ++i)
+        {
+            if (UWidget* ChildWidget = PanelWidget->GetChildAt(i))
+            {
+                TSharedPtr<FJsonObject> ChildJson = ExportWidgetToJson(ChildWidget);
+                if (ChildJson.IsValid())
+                {
+                    ChildrenJsonArray.Add(MakeShared<FJsonValueObject>(ChildJson));
+                }
+            }
+        }
+    }
     
-    for (TFieldIterator<FProperty> PropIt(Widget->GetClass()); PropIt; ++PropIt)
+    if (ChildrenJsonArray.Num() > 0)
     {
-        FProperty* Property = *PropIt;
+        WidgetJson->SetField(TEXT("children"), MakeShared<FJsonValueArray>(MoveTemp(ChildrenJsonArray)));
+    }
 
-        bool bIsEditorOnly = false;
-#if WITH_EDITOR
-        bIsEditorOnly = Property->HasAnyPropertyFlags(CPF_EditorOnly);
-#endif
+    return WidgetJson;
+}
+
+namespace
+{
+    // One non-default property captured for export: either a copy in the snapshot buffer, converted on a worker,
+    // or JSON produced during capture for values that reference live objects.
+    using FExportJsonWriter = TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>;
+    using FExportJsonWriterFactory = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>;
+
+    static FString HashToString(uint64 Hash)
+    {
+        return FString::Printf(TEXT("%016llx"), Hash);
+    }
+
+    struct FSnapshotValue
+    {
+        const FUmgExportProperty* Entry = nullptr;
+        int32 BufferOffset = INDEX_NONE;
+        TSharedPtr<FJsonValue> Json;
+    };
+
+    struct FWidgetSnapshot
+    {
+        FString Name;
+        FString ClassPath;
+        int32 Depth = 0;
+        int32 SubtreeSize = 1;
+        TArray<FSnapshotValue> Properties;
+        TArray<FSnapshotValue> SlotProperties;
+        TArray<int32> Children;
+    };
+
+    /**
+     * Export data copied off a widget subtree on the game thread. Serialize touches no UObject, so it can run on any
+     * thread while the editor keeps editing the asset; subtrees are written to JSON text in parallel.
+     */
+    class FExportSnapshot
+    {
+        using FFieldList = TArray<TPair<const FString*, TSharedPtr<FJsonValue>>>;
+
+    public:
+        FExportSnapshot() = default;
+        FExportSnapshot(const FExportSnapshot&) = delete;
+        FExportSnapshot& operator=(const FExportSnapshot&) = delete;
+
+        ~FExportSnapshot()
+        {
+            for (const FPendingCopy& Copy : Copies)
+            {
+                Copy.Entry->Property->DestroyValue(Buffer + Copy.Offset);
+            }
+            FMemory::Free(Buffer);
+        }
+
+        void Capture(UWidget* Root)
+        {
+            check(IsInGameThread());
+            CaptureWidget(Root, 0);
+
+            // Every copy is placed before the buffer exists, so it is allocated once and never relocated.
+            Buffer = static_cast<uint8*>(FMemory::Malloc(FMath::Max(BufferSize, 1), BufferAlignment));
+            for (const FPendingCopy& Copy : Copies)
+            {
+                FProperty* Property = Copy.Entry->Property;
+                Property->InitializeValue(Buffer + Copy.Offset);
+                Property->CopyCompleteValue(Buffer + Copy.Offset, Copy.Source);
+            }
+        }
+
+        const FString& GetRootName() const { return Widgets[0].Name; }
+
+        /** Whether the captured root is the asset's root widget rather than a subtree inside it. */
+        bool bAssetRoot = false;
+
+        int32 Num() const { return Widgets.Num(); }
+        const FWidgetSnapshot& GetWidget(int32 Index) const { return Widgets[Index]; }
+        uint64 GetSubtreeHash(int32 Index) const { return SubtreeHashes[Index]; }
+        uint64 GetContentHash(int32 Index) const { return ContentHashes[Index]; }
+
+        /**
+         * Content hash: class path and condensed properties JSON, as UTF-8. Subtree hash: the content hash followed by
+         * each child's name and subtree hash in child order. A widget's own name is left out so that identical subtrees
+         * hash alike; renaming a child still changes its parent. Once computed, Serialize writes both into every node.
+         */
+        void ComputeHashes()
+        {
+            if (SubtreeHashes.Num() == Widgets.Num())
+            {
+                return;
+            }
+
+            ContentHashes.SetNumUninitialized(Widgets.Num());
+            ParallelFor(Widgets.Num(), [this](int32 Index)
+            {
+                const FWidgetSnapshot& Snapshot = Widgets[Index];
+                FFieldList Fields;
+                FFieldList SlotFields;
+                CollectFields(Snapshot, Fields, SlotFields);
+
+                FString Text;
+                TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Text);
+                Writer->WriteObjectStart();
+                Writer->WriteValue(TEXT("widget_class"), Snapshot.ClassPath);
+                Writer->WriteObjectStart(TEXT("properties"));
+                WriteFields(Fields, SlotFields, Writer);
+                Writer->WriteObjectEnd();
+                Writer->WriteObjectEnd();
+                Writer->Close();
+
+                const FTCHARToUTF8 Utf8(*Text);
+                ContentHashes[Index] = FXxHash64::HashBuffer(Utf8.Get(), Utf8.Length()).Hash;
+            });
+
+            // Children follow their parent in pre-order, so a reverse pass hashes every child before its parent.
+            SubtreeHashes.SetNumUninitialized(Widgets.Num());
+            for (int32 Index = Widgets.Num() - 1; Index >= 0; --Index)
+            {
+                FXxHash64Builder Builder;
+                Builder.Update(&ContentHashes[Index], sizeof(uint64));
+                for (const int32 Child : Widgets[Index].Children)
+                {
+                    const FTCHARToUTF8 ChildName(*Widgets[Child].Name);
+                    Builder.Update(ChildName.Get(), ChildName.Length() + 1);
+                    Builder.Update(&SubtreeHashes[Child], sizeof(uint64));
+                }
+                SubtreeHashes[Index] = Builder.Finalize().Hash;
+            }
+        }
+
+        /** Live properties of one widget in export form, for comparing against a stored export. */
+        TSharedRef<FJsonObject> BuildPropertiesObject(int32 Index) const
+        {
+            FFieldList Fields;
+            FFieldList SlotFields;
+            CollectFields(Widgets[Index], Fields, SlotFields);
+
+            TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+            for (const TPair<const FString*, TSharedPtr<FJsonValue>>& Field : Fields)
+            {
+                if (Field.Value.IsValid())
+                {
+                    Properties->SetField(*Field.Key, Field.Value);
+                    continue;
+                }
+                TSharedRef<FJsonObject> SlotProperties = MakeShared<FJsonObject>();
+                for (const TPair<const FString*, TSharedPtr<FJsonValue>>& SlotField : SlotFields)
+                {
+                    SlotProperties->SetField(*SlotField.Key, SlotField.Value);
+                }
+                Properties->SetObjectField(*Field.Key, SlotProperties);
+            }
+            return Properties;
+        }
+
+        FString Serialize() const
+        {
+            // Small trees are written in one pass; large ones are cut into subtrees of roughly ChunkSize widgets.
+            const int32 ChunkSize = FMath::Max(MinChunkSize, Widgets.Num() / FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() * 4));
+            TArray<int32> SplitRoots;
+            if (Widgets.Num() > ChunkSize)
+            {
+                CollectSplitRoots(0, ChunkSize, SplitRoots);
+            }
+
+            TArray<FString> SubtreeTexts;
+            SubtreeTexts.SetNum(SplitRoots.Num());
+            ParallelFor(SplitRoots.Num(), [this, &SplitRoots, &SubtreeTexts](int32 Index)
+            {
+                const int32 WidgetIndex = SplitRoots[Index];
+                // Pretty-printed children sit two indent levels below their parent object.
+                TSharedRef<FExportJsonWriter> Writer = FExportJsonWriterFactory::Create(&SubtreeTexts[Index], Widgets[WidgetIndex].Depth * 2);
+                WriteWidget(WidgetIndex, Writer, nullptr);
+                Writer->Close();
+            });
+
+            // The part above the split points is written with a placeholder string where each subtree goes.
+            const FString TokenPrefix = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+            TMap<int32, FString> Placeholders;
+            Placeholders.Reserve(SplitRoots.Num());
+            for (int32 Index = 0; Index < SplitRoots.Num(); ++Index)
+            {
+                Placeholders.Add(SplitRoots[Index], FString::Printf(TEXT("%s:%d"), *TokenPrefix, Index));
+            }
+
+            FString Skeleton;
+            TSharedRef<FExportJsonWriter> Writer = FExportJsonWriterFactory::Create(&Skeleton);
+            WriteWidget(0, Writer, &Placeholders);
+            Writer->Close();
+            if (SplitRoots.Num() == 0)
+            {
+                return Skeleton;
+            }
+
+            // Placeholders appear in pre-order, the order SplitRoots was collected in, so one forward scan splices them.
+            int32 TotalLength = Skeleton.Len();
+            for (const FString& Text : SubtreeTexts)
+            {
+                TotalLength += Text.Len();
+            }
+            FString Output;
+            Output.Reserve(TotalLength);
+
+            int32 Cursor = 0;
+            for (int32 Index = 0; Index < SplitRoots.Num(); ++Index)
+            {
+                const FString QuotedToken = FString::Printf(TEXT("\"%s\""), *Placeholders.FindChecked(SplitRoots[Index]));
+                const int32 TokenStart = Skeleton.Find(QuotedToken, ESearchCase::CaseSensitive, ESearchDir::FromStart, Cursor);
+                check(TokenStart != INDEX_NONE);
+                Output.Append(*Skeleton + Cursor, TokenStart - Cursor);
+                Output.Append(SubtreeTexts[Index]);
+                Cursor = TokenStart + QuotedToken.Len();
+            }
+            Output.Append(*Skeleton + Cursor, Skeleton.Len() - Cursor);
+            return Output;
+        }
+
+    private:
+        struct FPendingCopy
+        {
+            const FUmgExportProperty* Entry = nullptr;
+            int32 Offset = 0;
+            const void* Source = nullptr;
+        };
+
+        static constexpr int32 MinChunkSize = 256;
+
+        int32 CaptureWidget(UWidget* Widget, int32 Depth)
+        {
+            const int32 Index = Widgets.AddDefaulted();
+            {
+                FWidgetSnapshot& Snapshot = Widgets[Index];
+                Snapshot.Name = Widget->GetName();
+                Snapshot.ClassPath = Widget->GetClass()->GetPathName();
+                Snapshot.Depth = Depth;
+            }
+
+            TArray<FSnapshotValue> Properties;
+            TArray<FSnapshotValue> SlotProperties;
+            for (const FUmgExportProperty& Entry : KeepPlan(Widget->GetClass()).Properties)
+            {
+                const void* ValuePtr = Entry.GetValue(Widget);
+                if (Entry.Property->Identical(ValuePtr, Entry.DefaultValue))
+                {
+                    continue;
+                }
+
+                if (Entry.bIsSlot)
+                {
+                    const UPanelSlot* SlotObject = Cast<UPanelSlot>(CastFieldChecked<FObjectProperty>(Entry.Property)->GetObjectPropertyValue(ValuePtr));
+                    if (!SlotObject)
+                    {
+                        continue;
+                    }
+                    for (const FUmgExportProperty& SlotEntry : KeepPlan(SlotObject->GetClass()).Properties)
+                    {
+                        const void* SlotValuePtr = SlotEntry.GetValue(SlotObject);
+                        if (!SlotEntry.Property->Identical(SlotValuePtr, SlotEntry.DefaultValue))
+                        {
+                            SlotProperties.Add(CaptureValue(SlotEntry, SlotValuePtr));
+                        }
+                    }
+                    if (SlotProperties.Num() > 0)
+                    {
+                        FSnapshotValue& SlotMarker = Properties.AddDefaulted_GetRef();
+                        SlotMarker.Entry = &Entry;
+                    }
+                    continue;
+                }
+
+                Properties.Add(CaptureValue(Entry, ValuePtr));
+            }
+            Widgets[Index].Properties = MoveTemp(Properties);
+            Widgets[Index].SlotProperties = MoveTemp(SlotProperties);
+
+            if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
+            {
+                for (int32 ChildIndex = 0; ChildIndex < PanelWidget->GetChildrenCount(); ++ChildIndex)
+                {
+                    if (UWidget* ChildWidget = PanelWidget->GetChildAt(ChildIndex))
+                    {
+                        const int32 Child = CaptureWidget(ChildWidget, Depth + 1);
+                        Widgets[Index].Children.Add(Child);
+                        Widgets[Index].SubtreeSize += Widgets[Child].SubtreeSize;
+                    }
+                }
+            }
+            return Index;
+        }
+
+        const FUmgExportPlan& KeepPlan(const UClass* Class)
+        {
+            TSharedRef<const FUmgExportPlan> Plan = FUmgExportPlanCache::Get().GetPlan(Class);
+            if (Plans.Num() == 0 || Plans.Last() != Plan)
+            {
+                Plans.AddUnique(Plan);
+            }
+            return *Plan;
+        }
+
+        FSnapshotValue CaptureValue(const FUmgExportProperty& Entry, const void* ValuePtr)
+        {
+            FSnapshotValue Value;
+            Value.Entry = &Entry;
+            if (!Entry.bCopyByValue)
+            {
+                Value.Json = FJsonObjectConverter::UPropertyToJsonValue(Entry.Property, ValuePtr);
+                return Value;
+            }
+
+            const int32 Alignment = FMath::Max(Entry.Property->GetMinAlignment(), 1);
+            Value.BufferOffset = Align(BufferSize, Alignment);
+            BufferSize = Value.BufferOffset + Entry.Property->GetSize();
+            BufferAlignment = FMath::Max<uint32>(BufferAlignment, Alignment);
+
+            FPendingCopy& Copy = Copies.AddDefaulted_GetRef();
+            Copy.Entry = &Entry;
+            Copy.Offset = Value.BufferOffset;
+            Copy.Source = ValuePtr;
+            return Value;
+        }
+
+        void CollectSplitRoots(int32 Index, int32 ChunkSize, TArray<int32>& OutRoots) const
+        {
+            for (const int32 Child : Widgets[Index].Children)
+            {
+                if (Widgets[Child].SubtreeSize <= ChunkSize || Widgets[Child].Children.Num() == 0)
+                {
+                    OutRoots.Add(Child);
+                }
+                else
+                {
+                    CollectSplitRoots(Child, ChunkSize, OutRoots);
+                }
+            }
+        }
+
+        TSharedPtr<FJsonValue> ToJson(const FSnapshotValue& Value) const
+        {
+            return Value.BufferOffset != INDEX_NONE
+                ? FJsonObjectConverter::UPropertyToJsonValue(Value.Entry->Property, Buffer + Value.BufferOffset)
+                : Value.Json;
+        }
+
+        // Property fields in plan order. A null value stands for the nested Slot object, listed only when it has fields.
+        void CollectFields(const FWidgetSnapshot& Snapshot, FFieldList& OutFields, FFieldList& OutSlotFields) const
+        {
+            for (const FSnapshotValue& Value : Snapshot.SlotProperties)
+            {
+                if (TSharedPtr<FJsonValue> Json = ToJson(Value))
+                {
+                    OutSlotFields.Emplace(&Value.Entry->Name, MoveTemp(Json));
+                }
+            }
+            for (const FSnapshotValue& Value : Snapshot.Properties)
+            {
+                if (Value.Entry->bIsSlot)
+                {
+                    if (OutSlotFields.Num() > 0)
+                    {
+                        OutFields.Emplace(&Value.Entry->Name, nullptr);
+                    }
+                }
+                else if (TSharedPtr<FJsonValue> Json = ToJson(Value))
+                {
+                    OutFields.Emplace(&Value.Entry->Name, MoveTemp(Json));
+                }
+            }
+        }
+
+        template <typename PrintPolicy>
+        static void WriteFields(const FFieldList& Fields, const FFieldList& SlotFields, const TSharedRef<TJsonWriter<TCHAR, PrintPolicy>>& Writer)
+        {
+            for (const TPair<const FString*, TSharedPtr<FJsonValue>>& Field : Fields)
+            {
+                if (!Field.Value.IsValid())
+                {
+                    Writer->WriteObjectStart(*Field.Key);
+                    for (const TPair<const FString*, TSharedPtr<FJsonValue>>& SlotField : SlotFields)
+                    {
+                        FJsonSerializer::Serialize(SlotField.Value, *SlotField.Key, Writer, false);
+                    }
+                    Writer->WriteObjectEnd();
+                    continue;
+                }
+                FJsonSerializer::Serialize(Field.Value, *Field.Key, Writer, false);
+            }
+        }
+
+        // Same shape ExportWidgetToJson builds: widget_name, widget_class, non-empty properties (with a nested Slot), children.
+        void WriteWidget(int32 Index, const TSharedRef<FExportJsonWriter>& Writer, const TMap<int32, FString>* Placeholders) const
+        {
+            const FWidgetSnapshot& Snapshot = Widgets[Index];
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("widget_name"), Snapshot.Name);
+            Writer->WriteValue(TEXT("widget_class"), Snapshot.ClassPath);
+            if (SubtreeHashes.Num() > 0)
+            {
+                Writer->WriteValue(TEXT("hash"), HashToString(SubtreeHashes[Index]));
+                Writer->WriteValue(TEXT("content_hash"), HashToString(ContentHashes[Index]));
+                if (Index == 0)
+                {
+                    // Lets a later diff tell a renamed asset root from a subtree export whose root is gone.
+                    Writer->WriteValue(TEXT("asset_root"), bAssetRoot);
+                }
+            }
+
+            FFieldList Fields;
+            FFieldList SlotFields;
+            CollectFields(Snapshot, Fields, SlotFields);
+            if (Fields.Num() > 0)
+            {
+                Writer->WriteObjectStart(TEXT("properties"));
+                WriteFields(Fields, SlotFields, Writer);
+                Writer->WriteObjectEnd();
+            }
+
+            if (Snapshot.Children.Num() > 0)
+            {
+                Writer->WriteArrayStart(TEXT("children"));
+                for (const int32 Child : Snapshot.Children)
+                {
+                    if (const FString* Placeholder = Placeholders ? Placeholders->Find(Child) : nullptr)
+                    {
+                        Writer->WriteValue(*Placeholder);
+                    }
+                    else
+                    {
+                        WriteWidget(Child, Writer, Placeholders);
+                    }
+                }
+                Writer->WriteArrayEnd();
+            }
+
+            Writer->WriteObjectEnd();
+        }
+
+        TArray<FWidgetSnapshot> Widgets;
+        TArray<uint64> ContentHashes;
+        TArray<uint64> SubtreeHashes;
+
+        /** Keeps the plans alive, and with them the FUmgExportProperty entries the values point at. */
+        TArray<TSharedRef<const FUmgExportPlan>> Plans;
+
+        TArray<FPendingCopy> Copies;
+        uint8* Buffer = nullptr;
+        int32 BufferSize = 0;
+        uint32 BufferAlignment = 16;
+    };
+
+    // Loads the asset, resolves the export root and captures it. Game thread only.
+    // OutErrorCode, when given, receives asset_unavailable or widget_not_found on failure.
+    static TSharedPtr<FExportSnapshot> CaptureExportSnapshot(const FString& AssetPath, const FString& TargetWidgetName, FString* OutErrorCode = nullptr)
+    {
+        check(IsInGameThread());
+        auto Fail = [OutErrorCode](const TCHAR* ErrorCode) -> TSharedPtr<FExportSnapshot>
+        {
+            if (OutErrorCode)
+            {
+                *OutErrorCode = ErrorCode;
+            }
+            return nullptr;
+        };
+        FString PackageName = FPackageName::ObjectPathToPackageName(AssetPath);
+
+        UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(StaticLoadObject(UWidgetBlueprint::StaticClass(), nullptr, *PackageName));
+
+        if (!WidgetBlueprint)
+        {
+            UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: Failed to load UWidgetBlueprint from path '%s'."), *AssetPath);
+            return Fail(TEXT("asset_unavailable"));
+        }
+
+        if (!WidgetBlueprint->WidgetTree)
+        {
+            UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: WidgetTree is null in UWidgetBlueprint '%s'."), *AssetPath);
+            return Fail(TEXT("asset_unavailable"));
+        }
+
+        UWidget* TargetWidget = nullptr;
+        if (TargetWidgetName.IsEmpty() || TargetWidgetName.Equals(TEXT("Root"), ESearchCase::IgnoreCase))
+        {
+            TargetWidget = WidgetBlueprint->WidgetTree->RootWidget;
+            if (!TargetWidget)
+            {
+                UE_LOG(LogUmgMcp, Warning, TEXT("ExportUmgAssetToJsonString: Root widget not found in UWidgetBlueprint '%s'. This may be an empty UI."), *AssetPath);
+                return Fail(TEXT("widget_not_found"));
+            }
+        }
+        else
+        {
+            TargetWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, TargetWidgetName);
+            if (!TargetWidget)
+            {
+                UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: Target widget '%s' not found in '%s'."), *TargetWidgetName, *AssetPath);
+                return Fail(TEXT("widget_not_found"));
+            }
+        }
+
+        TSharedPtr<FExportSnapshot> Snapshot = MakeShared<FExportSnapshot>();
+        Snapshot->bAssetRoot = TargetWidget == WidgetBlueprint->WidgetTree->RootWidget;
+        Snapshot->Capture(TargetWidget);
+        return Snapshot;
+    }
+
+    /**
+     * Compares a stored export (with hashes) against a live snapshot. Equal subtree hashes end the descent, so only the
+     * changed paths are visited; a widget is matched by name among its parent's children.
+     */
+    class FHashTreeDiff
+    {
+    public:
+        explicit FHashTreeDiff(const FExportSnapshot& InSnapshot)
+            : Snapshot(InSnapshot)
+        {
+        }
+
+        void Run(const TSharedPtr<FJsonObject>& BaselineRoot)
+        {
+            // The root's own name is not part of any hash, so a rename of the export root is checked directly.
+            FString BaselineName;
+            BaselineRoot->TryGetStringField(TEXT("widget_name"), BaselineName);
+            if (BaselineName != Snapshot.GetRootName())
+            {
+                TSharedRef<FJsonObject> Change = AddChange(TEXT("renamed"), Snapshot.GetRootName(), Snapshot.GetRootName());
+                Change->SetStringField(TEXT("from"), BaselineName);
+            }
+            CompareNode(BaselineRoot, 0, Snapshot.GetRootName());
+
+            // A widget that left one parent and joined another shows up as both; report it once as a move. Comparing a
+            // moved subtree can surface further moves, so pair until nothing is left to pair.
+            TArray<FString> MovedNames;
+            do
+            {
+                MovedNames.Reset();
+                for (const TPair<FString, FRemovedNode>& Removed : RemovedNodes)
+                {
+                    if (AddedNodes.Contains(Removed.Key))
+                    {
+                        MovedNames.Add(Removed.Key);
+                    }
+                }
+                for (const FString& Name : MovedNames)
+                {
+                    const FRemovedNode Removed = RemovedNodes.FindAndRemoveChecked(Name);
+                    const FAddedNode Added = AddedNodes.FindAndRemoveChecked(Name);
+                    TSharedRef<FJsonObject> Change = AddChange(TEXT("moved"), Name, Added.Path);
+                    Change->SetStringField(TEXT("from"), Removed.Path);
+                    CompareNode(Removed.Node, Added.Index, Added.Path);
+                }
+            }
+            while (MovedNames.Num() > 0);
+
+            for (const TPair<FString, FRemovedNode>& Removed : RemovedNodes)
+            {
+                TSharedRef<FJsonObject> Change = AddChange(TEXT("removed"), Removed.Key, Removed.Value.Path);
+                Change->SetStringField(TEXT("widget_class"), Removed.Value.ClassPath);
+            }
+            for (const TPair<FString, FAddedNode>& Added : AddedNodes)
+            {
+                TSharedRef<FJsonObject> Change = AddChange(TEXT("added"), Added.Key, Added.Value.Path);
+                Change->SetStringField(TEXT("widget_class"), Snapshot.GetWidget(Added.Value.Index).ClassPath);
+                Change->SetNumberField(TEXT("widget_count"), Snapshot.GetWidget(Added.Value.Index).SubtreeSize);
+            }
+        }
+
+        TArray<TSharedPtr<FJsonValue>> Changes;
+        int32 NodesCompared = 0;
+
+    private:
+        struct FRemovedNode
+        {
+            FString Path;
+            FString ClassPath;
+            TSharedPtr<FJsonObject> Node;
+        };
+
+        struct FAddedNode
+        {
+            FString Path;
+            int32 Index = INDEX_NONE;
+        };
+
+        TSharedRef<FJsonObject> AddChange(const TCHAR* Kind, const FString& WidgetName, const FString& Path)
+        {
+            TSharedRef<FJsonObject> Change = MakeShared<FJsonObject>();
+            Change->SetStringField(TEXT("change"), Kind);
+            Change->SetStringField(TEXT("widget_name"), WidgetName);
+            Change->SetStringField(TEXT("path"), Path);
+            Changes.Add(MakeShared<FJsonValueObject>(Change));
+            return Change;
+        }
+
+        void CompareNode(const TSharedPtr<FJsonObject>& Baseline, int32 LiveIndex, const FString& Path)
+        {
+            ++NodesCompared;
+            const FWidgetSnapshot& Live = Snapshot.GetWidget(LiveIndex);
+
+            FString BaselineHash;
+            if (Baseline->TryGetStringField(TEXT("hash"), BaselineHash) && BaselineHash == HashToString(Snapshot.GetSubtreeHash(LiveIndex)))
+            {
+                return;
+            }
+
+            FString BaselineClass;
+            Baseline->TryGetStringField(TEXT("widget_class"), BaselineClass);
+            if (BaselineClass != Live.ClassPath)
+            {
+                TSharedRef<FJsonObject> Change = AddChange(TEXT("class_changed"), Live.Name, Path);
+                Change->SetStringField(TEXT("from"), BaselineClass);
+                Change->SetStringField(TEXT("to"), Live.ClassPath);
+            }
+            else
+            {
+                FString BaselineContentHash;
+                Baseline->TryGetStringField(TEXT("content_hash"), BaselineContentHash);
+                if (BaselineContentHash != HashToString(Snapshot.GetContentHash(LiveIndex)))
+                {
+                    TSharedRef<FJsonObject> Change = AddChange(TEXT("modified"), Live.Name, Path);
+                    Change->SetArrayField(TEXT("properties"), DiffProperties(Baseline, LiveIndex));
+                }
+            }
+
+            CompareChildren(Baseline, LiveIndex, Path);
+        }
+
+        TArray<TSharedPtr<FJsonValue>> DiffProperties(const TSharedPtr<FJsonObject>& Baseline, int32 LiveIndex) const
+        {
+            const TSharedRef<FJsonObject> LiveProperties = Snapshot.BuildPropertiesObject(LiveIndex);
+            const TSharedPtr<FJsonObject>* BaselinePropertiesPtr = nullptr;
+            const TSharedPtr<FJsonObject> BaselineProperties = Baseline->TryGetObjectField(TEXT("properties"), BaselinePropertiesPtr)
+                ? *BaselinePropertiesPtr
+                : MakeShared<FJsonObject>();
+
+            TArray<FString> ChangedKeys;
+            for (const auto& Pair : LiveProperties->Values)
+            {
+                const FString Key = UmgMcpJsonCompat::KeyToString(Pair.Key);
+                const TSharedPtr<FJsonValue> BaselineValue = BaselineProperties->TryGetField(Key);
+                if (!BaselineValue.IsValid() || !FJsonValue::CompareEqual(*BaselineValue, *Pair.Value))
+                {
+                    ChangedKeys.Add(Key);
+                }
+            }
+            for (const auto& Pair : BaselineProperties->Values)
+            {
+                const FString Key = UmgMcpJsonCompat::KeyToString(Pair.Key);
+                if (!LiveProperties->HasField(Key))
+                {
+                    ChangedKeys.Add(Key);
+                }
+            }
+
+            ChangedKeys.Sort();
+            TArray<TSharedPtr<FJsonValue>> Result;
+            Result.Reserve(ChangedKeys.Num());
+            for (const FString& Key : ChangedKeys)
+            {
+                Result.Add(MakeShared<FJsonValueString>(Key));
+            }
+            return Result;
+        }
+
+        void CompareChildren(const TSharedPtr<FJsonObject>& Baseline, int32 LiveIndex, const FString& Path)
+        {
+            const FWidgetSnapshot& Live = Snapshot.GetWidget(LiveIndex);
+            TMap<FString, int32> LiveChildren;
+            LiveChildren.Reserve(Live.Children.Num());
+            for (const int32 Child : Live.Children)
+            {
+                LiveChildren.Add(Snapshot.GetWidget(Child).Name, Child);
+            }
+
+            TArray<TPair<TSharedPtr<FJsonObject>, int32>> Matched;
+            TSet<FString> BaselineNames;
+            const TArray<TSharedPtr<FJsonValue>>* BaselineChildren = nullptr;
+            if (Baseline->TryGetArrayField(TEXT("children"), BaselineChildren))
+            {
+                for (const TSharedPtr<FJsonValue>& ChildValue : *BaselineChildren)
+                {
+                    const TSharedPtr<FJsonObject>* ChildObject = nullptr;
+                    FString ChildName;
+                    if (!ChildValue.IsValid() || !ChildValue->TryGetObject(ChildObject) || !(*ChildObject)->TryGetStringField(TEXT("widget_name"), ChildName))
+                    {
+                        continue;
+                    }
+                    BaselineNames.Add(ChildName);
+
+                    const FString ChildPath = Path / ChildName;
+                    if (const int32* LiveChild = LiveChildren.Find(ChildName))
+                    {
+                        Matched.Emplace(*ChildObject, *LiveChild);
+                        continue;
+                    }
+                    FRemovedNode& Removed = RemovedNodes.Add(ChildName);
+                    Removed.Path = ChildPath;
+                    (*ChildObject)->TryGetStringField(TEXT("widget_class"), Removed.ClassPath);
+                    Removed.Node = *ChildObject;
+                }
+            }
+
+            TArray<int32> LiveOrder;
+            for (const int32 Child : Live.Children)
+            {
+                const FString& ChildName = Snapshot.GetWidget(Child).Name;
+                if (BaselineNames.Contains(ChildName))
+                {
+                    LiveOrder.Add(Child);
+                    continue;
+                }
+                FAddedNode& Added = AddedNodes.Add(ChildName);
+                Added.Path = Path / ChildName;
+                Added.Index = Child;
+            }
+
+            // Matched is in baseline order and LiveOrder in live order over the same widgets.
+            for (int32 Position = 0; Position < Matched.Num(); ++Position)
+            {
+                if (Matched[Position].Value != LiveOrder[Position])
+                {
+                    TSharedRef<FJsonObject> Change = AddChange(TEXT("reordered"), Live.Name, Path);
+                    TArray<TSharedPtr<FJsonValue>> Order;
+                    for (const int32 Child : Live.Children)
+                    {
+                        Order.Add(MakeShared<FJsonValueString>(Snapshot.GetWidget(Child).Name));
+                    }
+                    Change->SetArrayField(TEXT("children"), Order);
+                    break;
+                }
+            }
+
+            for (const TPair<TSharedPtr<FJsonObject>, int32>& Pair : Matched)
+            {
+                CompareNode(Pair.Key, Pair.Value, Path / Snapshot.GetWidget(Pair.Value).Name);
+            }
+        }
+
+        const FExportSnapshot& Snapshot;
+        TMap<FString, FRemovedNode> RemovedNodes;
+        TMap<FString, FAddedNode> AddedNodes;
+    };
+}
+
+FString UUmgFileTransformation::ExportUmgAssetToJsonString(const FString& AssetPath, const FString& TargetWidgetName, bool bIncludeHashes)
+{
+    if (!IsInGameThread())
+    {
+        return ExportUmgAssetToJsonStringAsync(AssetPath, TargetWidgetName, bIncludeHashes).Get();
+    }
+
+    TSharedPtr<FExportSnapshot> Snapshot = CaptureExportSnapshot(AssetPath, TargetWidgetName);
+    if (!Snapshot.IsValid())
+    {
+        return FString();
+    }
+
+    // Subtrees are serialized on the task graph; the game thread only waits for the slowest one.
+    if (bIncludeHashes)
+    {
+        Snapshot->ComputeHashes();
+    }
+    FString JsonString = Snapshot->Serialize();
+    UE_LOG(LogUmgMcp, Log, TEXT("Successfully exported UMG asset '%s' (Target: %s) to JSON."), *AssetPath, *Snapshot->GetRootName());
+    return JsonString;
+}
+
+TFuture<FString> UUmgFileTransformation::ExportUmgAssetToJsonStringAsync(const FString& AssetPath, const FString& TargetWidgetName, bool bIncludeHashes)
+{
+    TSharedRef<TPromise<FString>> Promise = MakeShared<TPromise<FString>>();
+    TFuture<FString> Future = Promise->GetFuture();
+
+    auto CaptureAndSerialize = [AssetPath, TargetWidgetName, bIncludeHashes, Promise]()
+    {
+        TSharedPtr<FExportSnapshot> Snapshot = CaptureExportSnapshot(AssetPath, TargetWidgetName);
+        if (!Snapshot.IsValid())
+        {
+            Promise->SetValue(FString());
+            return;
+        }
+
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [AssetPath, bIncludeHashes, Snapshot, Promise]()
+        {
+            if (bIncludeHashes)
+            {
+                Snapshot->ComputeHashes();
+            }
+            FString JsonString = Snapshot->Serialize();
+            UE_LOG(LogUmgMcp, Log, TEXT("Successfully exported UMG asset '%s' (Target: %s) to JSON."), *AssetPath, *Snapshot->GetRootName());
+            Promise->SetValue(MoveTemp(JsonString));
+        });
+    };
+
+    if (IsInGameThread())
+    {
+        CaptureAndSerialize();
+    }
+    else
+    {
+        AsyncTask(ENamedThreads::GameThread, MoveTemp(CaptureAndSerialize));
+    }
+    return Future;
+}
+
+TSharedPtr<FJsonObject> UUmgFileTransformation::DiffUmgAssetAgainstJson(const FString& AssetPath, const TSharedPtr<FJsonObject>& Baseline, const FString& TargetWidgetName)
+{
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    FString BaselineRootHash;
+    if (!Baseline.IsValid() || !Baseline->TryGetStringField(TEXT("hash"), BaselineRootHash))
+    {
+        ResultJson->SetStringField(TEXT("error_code"), TEXT("missing_hashes"));
+        ResultJson->SetStringField(TEXT("error"), TEXT("Baseline has no 'hash' fields. Export it with include_hashes=true."));
+        ResultJson->SetBoolField(TEXT("success"), false);
+        return ResultJson;
+    }
+
+    // With no target given, the baseline root names the widget it was exported from. If that widget was the asset's
+    // root and has since been renamed, diff against the current root so the rename is reported instead of failing the
+    // lookup. A subtree export whose root is gone stays widget_not_found: the whole tree is not a stand-in for it.
+    FString EffectiveTarget = TargetWidgetName;
+    const bool bTargetFromBaseline = EffectiveTarget.IsEmpty();
+    bool bBaselineAssetRoot = false;
+    if (bTargetFromBaseline)
+    {
+        Baseline->TryGetStringField(TEXT("widget_name"), EffectiveTarget);
+        Baseline->TryGetBoolField(TEXT("asset_root"), bBaselineAssetRoot);
+    }
+
+    FString ErrorCode;
+    TSharedPtr<FExportSnapshot> Snapshot = CaptureExportSnapshot(AssetPath, EffectiveTarget, &ErrorCode);
+    if (!Snapshot.IsValid() && bTargetFromBaseline && bBaselineAssetRoot && ErrorCode == TEXT("widget_not_found") && !EffectiveTarget.IsEmpty())
+    {
+        EffectiveTarget.Reset();
+        Snapshot = CaptureExportSnapshot(AssetPath, EffectiveTarget, &ErrorCode);
+    }
+    if (!Snapshot.IsValid())
+    {
+        ResultJson->SetStringField(TEXT("error_code"), ErrorCode);
+        ResultJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to read widget '%s' of '%s'."), *EffectiveTarget, *AssetPath));
+        ResultJson->SetBoolField(TEXT("success"), false);
+        return ResultJson;
+    }
+
+    Snapshot->ComputeHashes();
+    FHashTreeDiff Diff(*Snapshot);
+    Diff.Run(Baseline);
+
+    ResultJson->SetBoolField(TEXT("success"), true);
+    ResultJson->SetStringField(TEXT("asset_path"), AssetPath);
+    ResultJson->SetStringField(TEXT("target_widget"), Snapshot->GetRootName());
+    ResultJson->SetStringField(TEXT("hash"), HashToString(Snapshot->GetSubtreeHash(0)));
+    ResultJson->SetBoolField(TEXT("unchanged"), Diff.Changes.Num() == 0);
+    ResultJson->SetArrayField(TEXT("changes"), Diff.Changes);
+    ResultJson->SetNumberField(TEXT("nodes_compared"), Diff.NodesCompared);
+    ResultJson->SetNumberField(TEXT("widget_count"), Snapshot->Num());
+    return ResultJson;
+}
+
+TSharedPtr<FJsonObject> FUmgApplyJsonResult::ToJson() const
+{
+    TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+    Json->SetBoolField(TEXT("success"), bSuccess);
+    if (!AssetPath.IsEmpty())
+    {
+        Json->SetStringField(TEXT("asset_path"), AssetPath);
+    }
+    if (!bSuccess)
+    {
+        Json->SetStringField(TEXT("error_code"), ErrorCode);
+        Json->SetStringField(TEXT("error"), Error);
+        return Json;
+    }
+
+    if (!TargetWidget.IsEmpty())
+    {
+        Json->SetStringField(TEXT("target_widget"), TargetWidget);
+    }
+    Json->SetNumberField(TEXT("widget_count"), WidgetCount);
+    Json->SetStringField(TEXT("mode"), bReconciled ? TEXT("reconciled") : (bMerged ? TEXT("merged") : TEXT("created")));
+    Json->SetBoolField(TEXT("created_asset"), bCreatedAsset);
+    if (bReconciled)
+    {
+        TSharedPtr<FJsonObject> Changes = MakeShared<FJsonObject>();
+        Changes->SetNumberField(TEXT("created"), WidgetsCreated);
+        Changes->SetNumberField(TEXT("removed"), WidgetsRemoved);
+        Changes->SetNumberField(TEXT("moved"), WidgetsMoved);
+        Changes->SetNumberField(TEXT("properties_written"), PropertiesWritten);
+        Changes->SetNumberField(TEXT("widgets_touched"), WidgetsTouched);
+        Json->SetObjectField(TEXT("changes"), Changes);
+        if (WidgetsTouched > 0)
+        {
+            Json->SetStringField(TEXT("modification_path"), LexToString(bStructuralChange ? EUmgModificationPath::Structural : EUmgModificationPath::Property));
+        }
+    }
+    return Json;
+}
+
+// CollectJsonWidgetInfos over the token stream: the same checks, without building the payload into a DOM.
+// Returns false when the payload needs the DOM path after all (see FUmgLayoutJsonStream::NeedsDocument).
+static bool ScanStreamedWidgetInfos(FUmgPreparedLayout& Layout)
+{
+    FUmgLayoutJsonStream Stream(*Layout.SourceText, false);
+    FUmgStreamedWidget Node;
+    while (Stream.Next(Node))
+    {
+        if (Node.Depth == 0)
+        {
+            Layout.RootName = Node.Name;
+            Layout.RootClassPath = Node.ClassPath;
+        }
+        else if (Node.Name.IsEmpty() || Node.ClassPath.IsEmpty())
+        {
+            Layout.ErrorCode = TEXT("invalid_node");
+            Layout.Error = FString::Printf(TEXT("A child of '%s' is missing widget_name or widget_class."), Node.ParentName.IsEmpty() ? TEXT("the target widget") : *Node.ParentName);
+            return true;
+        }
+
+        if (!Node.Name.IsEmpty())
+        {
+            if (Layout.Widgets.Contains(Node.Name))
+            {
+                Layout.ErrorCode = TEXT("duplicate_name");
+                Layout.Error = FString::Printf(TEXT("Widget name '%s' appears more than once in the layout."), *Node.Name);
+                return true;
+            }
+            FUmgJsonWidgetInfo& Info = Layout.Widgets.Add(Node.Name);
+            Info.Name = Node.Name;
+            Info.ClassPath = Node.ClassPath;
+            Info.ParentName = MoveTemp(Node.ParentName);
+        }
+        if (!Node.ClassPath.IsEmpty())
+        {
+            Layout.ClassPaths.AddUnique(Node.ClassPath);
+        }
+    }
+
+    if (Stream.NeedsDocument())
+    {
+        return false;
+    }
+    if (Stream.HasError())
+    {
+        Layout.ErrorCode = Stream.GetErrorCode();
+        Layout.Error = Stream.GetError();
+    }
+    return true;
+}
+
+TSharedRef<FUmgPreparedLayout> UUmgFileTransformation::PrepareLayoutJson(FString JsonData)
+{
+    if (JsonData.Len() >= FUmgPreparedLayout::StreamingThreshold)
+    {
+        TSharedRef<FUmgPreparedLayout> Layout = MakeShared<FUmgPreparedLayout>();
+        Layout->SourceText = MakeShared<const FString>(MoveTemp(JsonData));
+        if (ScanStreamedWidgetInfos(*Layout))
+        {
+            return Layout;
+        }
+        UE_LOG(LogUmgMcp, Log, TEXT("PrepareLayoutJson: Node fields follow their children; parsing the %d-character payload as a document."), Layout->SourceText->Len());
+        JsonData = *Layout->SourceText;
+    }
+
+    TSharedPtr<FJsonObject> RootJsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::CreateFromView(JsonData);
+    if (!FJsonSerializer::Deserialize(Reader, RootJsonObject) || !RootJsonObject.IsValid())
+    {
+        TSharedRef<FUmgPreparedLayout> Layout = MakeShared<FUmgPreparedLayout>();
+        Layout->ErrorCode = TEXT("invalid_json");
+        Layout->Error = FString::Printf(TEXT("Layout JSON could not be parsed as an object: %s"), *Reader->GetErrorMessage());
+        return Layout;
+    }
+    return PrepareLayoutJson(RootJsonObject);
+}
+
+TSharedRef<FUmgPreparedLayout> UUmgFileTransformation::PrepareLayoutJson(const TSharedPtr<FJsonObject>& Root)
+{
+    TSharedRef<FUmgPreparedLayout> Layout = MakeShared<FUmgPreparedLayout>();
+    if (!Root.IsValid())
+    {
+        Layout->ErrorCode = TEXT("invalid_json");
+        Layout->Error = TEXT("Layout JSON is empty.");
+        return Layout;
+    }
+
+    Layout->Root = Root;
+    Root->TryGetStringField(TEXT("widget_name"), Layout->RootName);
+    Root->TryGetStringField(TEXT("widget_class"), Layout->RootClassPath);
+    CollectJsonWidgetInfos(Root, FString(), true, *Layout);
+    return Layout;
+}
+
+bool UUmgFileTransformation::ApplyJsonStringToUmgAsset(const FString& AssetPath, const FString& JsonData, const FString& TargetWidgetName)
+{
+    if (IsInGameThread())
+    {
+        return ApplyPreparedLayout(AssetPath, *PrepareLayoutJson(JsonData), TargetWidgetName).bSuccess;
+    }
+
+    // Off the game thread the caller can simply wait; the mutation itself is marshalled to the game thread.
+    return ApplyJsonStringToUmgAssetAsync(AssetPath, JsonData, TargetWidgetName).Get().bSuccess;
+}
+
+TFuture<FUmgApplyJsonResult> UUmgFileTransformation::ApplyJsonStringToUmgAssetAsync(const FString& AssetPath, const FString& JsonData, const FString& TargetWidgetName)
+{
+    TSharedRef<TPromise<FUmgApplyJsonResult>> Promise = MakeShared<TPromise<FUmgApplyJsonResult>>();
+    TFuture<FUmgApplyJsonResult> Future = Promise->GetFuture();
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [AssetPath, JsonData, TargetWidgetName, Promise]() mutable
+    {
+        TSharedRef<FUmgPreparedLayout> Layout = PrepareLayoutJson(MoveTemp(JsonData));
+        if (!Layout->IsValid())
+        {
+            FUmgApplyJsonResult Result;
+            Result.ErrorCode = Layout->ErrorCode;
+            Result.Error = Layout->Error;
+            Promise->SetValue(MoveTemp(Result));
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [AssetPath, TargetWidgetName, Layout, Promise]()
+        {
+            Promise->SetValue(ApplyPreparedLayout(AssetPath, *Layout, TargetWidgetName));
+        });
+    });
+
+    return Future;
+}
+
+namespace
+{
+    struct FReconciledWrites
+    {
+        TArray<FProperty*, TInlineAllocator<8>> WidgetProperties;
+        TArray<FProperty*, TInlineAllocator<8>> SlotProperties;
+    };
+
+    struct FLayoutReconcileContext
+    {
+        FLayoutReconcileContext(UWidgetBlueprint* InWidgetBlueprint, const FUmgPreparedLayout& InLayout, FUmgApplyJsonResult& InResult)
+            : WidgetBlueprint(InWidgetBlueprint)
+            , Layout(InLayout)
+            , Result(InResult)
+        {
+        }
+
+        UWidgetBlueprint* WidgetBlueprint;
+        const FUmgPreparedLayout& Layout;
+        FUmgApplyJsonResult& Result;
+
+        /** The target subtree as it was before the apply. Widgets detached mid-pass stay reachable here until re-added. */
+        TMap<FString, UWidget*> LiveWidgets;
+
+        TSet<UObject*> ModifiedObjects;
+        TSet<UWidget*> TouchedWidgets;
+        TSet<UWidget*> MovedWidgets;
+
+        /** Property writes per widget, replayed onto the designer preview when nothing structural changed. */
+        TMap<UWidget*, FReconciledWrites> Writes;
+
+        FString ErrorCode;
+        FString Error;
+    };
+
+    static void BuildLiveWidgetMap(UWidget* Widget, TMap<FString, UWidget*>& OutWidgets)
+    {
+        OutWidgets.Add(Widget->GetName(), Widget);
+        if (UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
+        {
+            for (int32 Index = 0; Index < Panel->GetChildrenCount(); ++Index)
+            {
+                if (UWidget* Child = Panel->GetChildAt(Index))
+                {
+                    BuildLiveWidgetMap(Child, OutWidgets);
+                }
+            }
+        }
+    }
+
+    // The blueprint and each object enter the undo buffer once, and only when something about them actually changes.
+    static void MarkModified(FLayoutReconcileContext& Context, UObject* Object)
+    {
+        if (!Object)
+        {
+            return;
+        }
+
+        bool bAlreadyModified = false;
+        Context.ModifiedObjects.Add(Object, &bAlreadyModified);
+        if (bAlreadyModified)
+        {
+            return;
+        }
+
+        if (Object != Context.WidgetBlueprint && !Context.ModifiedObjects.Contains(Context.WidgetBlueprint))
+        {
+            Context.ModifiedObjects.Add(Context.WidgetBlueprint);
+            Context.WidgetBlueprint->Modify();
+        }
+        Object->Modify();
+    }
+
+    static bool HasInstancedValue(const FProperty* Property)
+    {
+        return Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference | CPF_PersistentInstance);
+    }
+
+    static void NoteWrite(FLayoutReconcileContext& Context, UWidget* Widget, UObject* Object, FProperty* Property)
+    {
+        static const FName IsVariableName(TEXT("bIsVariable"));
+
+        ++Context.Result.PropertiesWritten;
+        Context.TouchedWidgets.Add(Widget);
+        FReconciledWrites& Writes = Context.Writes.FindOrAdd(Widget);
+        if (Object == Widget)
+        {
+            Writes.WidgetProperties.AddUnique(Property);
+
+            // Toggling bIsVariable adds or removes a member variable on the generated class.
+            Context.Result.bStructuralChange |= Property->GetFName() == IsVariableName;
+        }
+        else
+        {
+            Writes.SlotProperties.AddUnique(Property);
+        }
+    }
+
+    static void WritePropertyIfChanged(FLayoutReconcileContext& Context, UWidget* Widget, UObject* Object, FProperty* Property, const TSharedPtr<FJsonValue>& JsonValue)
+    {
+        void* LiveValue = Property->ContainerPtrToValuePtr<void>(Object);
+
+        if (HasInstancedValue(Property))
+        {
+            // Decoding into a scratch value would construct subobjects, so instanced values are compared in JSON form.
+            const TSharedPtr<FJsonValue> LiveJson = FJsonObjectConverter::UPropertyToJsonValue(Property, LiveValue);
+            if (LiveJson.IsValid() && FJsonValue::CompareEqual(*LiveJson, *JsonValue))
+            {
+                return;
+            }
+
+            MarkModified(Context, Object);
+            if (FJsonObjectConverter::JsonValueToUProperty(JsonValue, Property, LiveValue, 0, 0))
+            {
+                NoteWrite(Context, Widget, Object, Property);
+            }
+            else
+            {
+                UE_LOG(LogUmgMcp, Warning, TEXT("ReconcileLayout: Failed to apply '%s' to '%s'."), *Property->GetName(), *Object->GetName());
+            }
+            return;
+        }
+
+        // Decode over a copy of the live value so struct fields the JSON omits keep their current values.
+        void* Scratch = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+        Property->InitializeValue(Scratch);
+        Property->CopyCompleteValue(Scratch, LiveValue);
+
+        if (!FJsonObjectConverter::JsonValueToUProperty(JsonValue, Property, Scratch, 0, 0))
+        {
+            UE_LOG(LogUmgMcp, Warning, TEXT("ReconcileLayout: Failed to apply '%s' to '%s'."), *Property->GetName(), *Object->GetName());
+        }
+        else if (!Property->Identical(LiveValue, Scratch))
+        {
+            MarkModified(Context, Object);
+            Property->CopyCompleteValue(LiveValue, Scratch);
+            NoteWrite(Context, Widget, Object, Property);
+        }
+
+        Property->DestroyValue(Scratch);
+        FMemory::Free(Scratch);
+    }
+
+    static void ReconcileObjectProperties(FLayoutReconcileContext& Context, UWidget* Widget, UObject* Object, const TSharedPtr<FJsonObject>& JsonProperties, TConstArrayView<FName> IgnoredNames)
+    {
+        UClass* Class = Object->GetClass();
+        TSet<FProperty*> Listed;
+
+        if (JsonProperties.IsValid())
+        {
+            for (const auto& Pair : JsonProperties->Values)
+            {
+                const FStringView Key = UmgMcpJsonCompat::KeyToView(Pair.Key);
+                const TSharedRef<const FUmgResolvedPropertyKey> Resolved = FUmgPropertyPathCache::Get().ResolveKey(Class, Key);
+                FProperty* Property = Resolved->SegmentCount == 1 ? Resolved->GetLeafProperty() : nullptr;
+                if (!Property)
+                {
+                    UE_LOG(LogUmgMcp, Warning, TEXT("ReconcileLayout: '%.*s' is not a property of %s; skipped for '%s'."), Key.Len(), Key.GetData(), *Class->GetName(), *Widget->GetName());
+                    continue;
+                }
+                if (IgnoredNames.Contains(Property->GetFName()))
+                {
+                    continue;
+                }
+
+                Listed.Add(Property);
+                WritePropertyIfChanged(Context, Widget, Object, Property, Pair.Value);
+            }
+        }
+
+        // Unlisted properties the export would write go back to the class default, so re-applying an export is an exact round trip.
+        for (const FUmgExportProperty& Entry : FUmgExportPlanCache::Get().GetPlan(Class)->Properties)
+        {
+            FProperty* Property = Entry.Property;
+            if (Entry.bIsSlot || Listed.Contains(Property) || HasInstancedValue(Property) || IgnoredNames.Contains(Property->GetFName()))
+            {
+                continue;
+            }
+
+            void* LiveValue = Property->ContainerPtrToValuePtr<void>(Object);
+            if (!Property->Identical(LiveValue, Entry.DefaultValue))
+            {
+                MarkModified(Context, Object);
+                Property->CopyCompleteValue(LiveValue, Entry.DefaultValue);
+                NoteWrite(Context, Widget, Object, Property);
+            }
+        }
+    }
+
+    static void ReconcileWidgetProperties(FLayoutReconcileContext& Context, const TSharedPtr<FJsonObject>& NodeJson, UWidget* Widget)
+    {
+        static const FName SlotName(TEXT("Slot"));
+        static const FName ContentName(TEXT("Content"));
+        static const FName ParentName(TEXT("Parent"));
+
+        TSharedPtr<FJsonObject> WidgetProperties;
+        TSharedPtr<FJsonObject> SlotProperties;
+        const TSharedPtr<FJsonObject>* PropertiesObject = nullptr;
+        if (NodeJson->TryGetObjectField(TEXT("properties"), PropertiesObject))
+        {
+            WidgetProperties = *PropertiesObject;
+            const TSharedPtr<FJsonObject>* SlotObject = nullptr;
+            if (WidgetProperties->TryGetObjectField(TEXT("Slot"), SlotObject))
+            {
+                SlotProperties = *SlotObject;
+            }
+        }
+
+        ReconcileObjectProperties(Context, Widget, Widget, WidgetProperties, MakeArrayView(&SlotName, 1));
+        if (Widget->Slot)
+        {
+            const FName SlotIgnoredNames[] = { ContentName, ParentName };
+            ReconcileObjectProperties(Context, Widget, Widget->Slot, SlotProperties, SlotIgnoredNames);
+        }
+    }
+
+    static UWidget* CreateReconciledWidget(FLayoutReconcileContext& Context, const TSharedPtr<FJsonObject>& NodeJson, UPanelWidget* Parent)
+    {
+        // Children are reconciled afterwards: a new container may adopt widgets that already exist in the subtree.
+        TSharedPtr<FJsonObject> NodeOnly = MakeShared<FJsonObject>();
+        NodeOnly->Values = NodeJson->Values;
+        NodeOnly->RemoveField(TEXT("children"));
+
+        UWidget* NewWidget = CreateWidgetFromJson(NodeOnly, Context.WidgetBlueprint->WidgetTree, Parent);
+        if (NewWidget && NewWidget->GetParent() == Parent)
+        {
+            ++Context.Result.WidgetsCreated;
+            Context.TouchedWidgets.Add(NewWidget);
+            return NewWidget;
+        }
+        return nullptr;
+    }
+
+    static bool ReconcileNode(FLayoutReconcileContext& Context, const TSharedPtr<FJsonObject>& NodeJson, UWidget* Widget, bool bCreated)
+    {
+        // A freshly created widget already carries the node's properties; an unnamed payload root only anchors children.
+        if (!bCreated && NodeJson->HasField(TEXT("widget_name")))
+        {
+            ReconcileWidgetProperties(Context, NodeJson, Widget);
+        }
+
+        UPanelWidget* Panel = Cast<UPanelWidget>(Widget);
+        if (!Panel)
+        {
+            return true;
+        }
+
+        TArray<TSharedPtr<FJsonObject>> ChildNodes;
+        TSet<FString> ChildNames;
+        const TArray<TSharedPtr<FJsonValue>>* ChildrenArray = nullptr;
+        if (NodeJson->TryGetArrayField(TEXT("children"), ChildrenArray))
+        {
+            for (const TSharedPtr<FJsonValue>& ChildValue : *ChildrenArray)
+            {
+                const TSharedPtr<FJsonObject>* ChildObject = nullptr;
+                if (ChildValue->TryGetObject(ChildObject))
+                {
+                    ChildNodes.Add(*ChildObject);
+                    ChildNames.Add((*ChildObject)->GetStringField(TEXT("widget_name")));
+                }
+            }
+        }
+
+        // 1. Children not listed here are destroyed, or detached when the payload places them under a later parent.
+        for (int32 Index = Panel->GetChildrenCount() - 1; Index >= 0; --Index)
+        {
+            UWidget* Child = Panel->GetChildAt(Index);
+            if (!Child || ChildNames.Contains(Child->GetName()))
+            {
+                continue;
+            }
+
+            MarkModified(Context, Panel);
+            MarkModified(Context, Child);
+            if (Context.Layout.Widgets.Contains(Child->GetName()))
+            {
+                Panel->RemoveChild(Child);
+            }
+            else
+            {
+                Context.WidgetBlueprint->WidgetTree->RemoveWidget(Child);
+            }
+        }
 
-        if (Property->HasAnyPropertyFlags(CPF_Edit) && !Property->HasAnyPropertyFlags(CPF_Transient) && !bIsEditorOnly)
+        // 2. Listed children are moved in from wherever they sit, or created without their children.
+        TArray<UWidget*> Children;
+        TBitArray<> CreatedChildren;
+        Children.Reserve(ChildNodes.Num());
+        for (const TSharedPtr<FJsonObject>& ChildNode : ChildNodes)
         {
-            void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Widget);
-            void* DefaultValuePtr = Property->ContainerPtrToValuePtr<void>(DefaultWidget);
+            const FString ChildName = ChildNode->GetStringField(TEXT("widget_name"));
+            UWidget* const* Existing = Context.LiveWidgets.Find(ChildName);
+            UWidget* Child = Existing ? *Existing : nullptr;
 
-            if (!Property->Identical(ValuePtr, DefaultValuePtr))
+            if (Child && Child->GetParent() != Panel)
             {
-                if (Property->GetFName() == TEXT("Slot"))
+                MarkModified(Context, Panel);
+                MarkModified(Context, Child);
+                if (UPanelWidget* OldParent = Child->GetParent())
                 {
-                    if (UPanelSlot* SlotObject = Cast<UPanelSlot>(CastField<FObjectProperty>(Property)->GetObjectPropertyValue_InContainer(Widget)))
-                    {
-                        TSharedPtr<FJsonObject> SlotPropertiesJson = MakeShared<FJsonObject>();
-                        UObject* DefaultSlotObject = SlotObject->GetClass()->GetDefaultObject();
-
-                        for (TFieldIterator<FProperty> SlotPropIt(SlotObject->GetClass()); SlotPropIt; ++SlotPropIt)
-                        {
-                            FProperty* SlotProperty = *SlotPropIt;
-                            FName SlotPropertyName = SlotProperty->GetFName();
-
-                            if (SlotPropertyName == TEXT("Content") || SlotPropertyName == TEXT("Parent"))
-                            {
-                                continue;
-                            }
-
-                            if (SlotProperty->HasAnyPropertyFlags(CPF_Edit) && !SlotProperty->HasAnyPropertyFlags(CPF_Transient))
-                            {
-                                void* SlotValuePtr = SlotProperty->ContainerPtrToValuePtr<void>(SlotObject);
-                                void* DefaultSlotValuePtr = SlotProperty->ContainerPtrToValuePtr<void>(DefaultSlotObject);
-
-                                if (!SlotProperty->Identical(SlotValuePtr, DefaultSlotValuePtr))
-                                {
-                                    TSharedPtr<FJsonValue> SlotPropertyJsonValue = FJsonObjectConverter::UPropertyToJsonValue(SlotProperty, SlotValuePtr);
-                                    if (SlotPropertyJsonValue.IsValid())
-                                    {
-                                        SlotPropertiesJson->SetField(SlotProperty->GetName(), SlotPropertyJsonValue);
-                                    }
-                                }
-                            }
-                        }
-                        
-                        if(SlotPropertiesJson->Values.Num() > 0)
-                        {
-                           PropertiesJson->SetObjectField(TEXT("Slot"), SlotPropertiesJson);
-                        }
-                    }
+                    MarkModified(Context, OldParent);
+                    OldParent->RemoveChild(Child);
                 }
-                else
+                if (!Panel->AddChild(Child))
                 {
-                    TSharedPtr<FJsonValue> PropertyJsonValue = FJsonObjectConverter::UPropertyToJsonValue(Property, ValuePtr);
-                    if (PropertyJsonValue.IsValid())
-                    {
-                        PropertiesJson->SetField(Property->GetName(), PropertyJsonValue);
-                    }
+                    Context.ErrorCode = TEXT("apply_failed");
+                    Context.Error = FString::Printf(TEXT("Widget '%s' could not be moved under '%s'."), *ChildName, *Panel->GetName());
+                    return false;
+                }
+                Context.MovedWidgets.Add(Child);
+            }
+            else if (!Child)
+            {
+                MarkModified(Context, Panel);
+                Child = CreateReconciledWidget(Context, ChildNode, Panel);
+                if (!Child)
+                {
+                    Context.ErrorCode = TEXT("apply_failed");
+                    Context.Error = FString::Printf(TEXT("Widget '%s' could not be created under '%s'."), *ChildName, *Panel->GetName());
+                    return false;
                 }
             }
+
+            Children.Add(Child);
+            CreatedChildren.Add(!Existing);
         }
-    }
-    
-    if (PropertiesJson->Values.Num() > 0)
-    {
-        WidgetJson->SetObjectField(TEXT("properties"), PropertiesJson);
-    }
 
-    TArray<TSharedPtr<FJsonValue>> ChildrenJsonArray;
-    if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
-    {
-        for (int32 i = 0; i < PanelWidget->GetChildrenCount(); ++i)
+        // 3. The panel now holds exactly the listed children; keep the longest run already in payload order.
+        FUmgOrderPlanner::ApplyOrder(Panel, Children, [&Context, Panel, &CreatedChildren](UWidget* Child, int32 Position)
         {
-            if (UWidget* ChildWidget = PanelWidget->GetChildAt(i))
+            MarkModified(Context, Panel);
+            MarkModified(Context, Child);
+            MarkModified(Context, Child->Slot);
+            if (!CreatedChildren[Position])
             {
-                TSharedPtr<FJsonObject> ChildJson = ExportWidgetToJson(ChildWidget);
-                if (ChildJson.IsValid())
-                {
-                    ChildrenJsonArray.Add(MakeShared<FJsonValueObject>(ChildJson));
-                }
+                Context.MovedWidgets.Add(Child);
+            }
+        });
+
+        // 4. Recurse.
+        for (int32 Index = 0; Index < Children.Num(); ++Index)
+        {
+            if (!ReconcileNode(Context, ChildNodes[Index], Children[Index], CreatedChildren[Index]))
+            {
+                return false;
             }
         }
+        return true;
     }
-    
-    if (ChildrenJsonArray.Num() > 0)
+
+    // Checks a node's child count against the panel type that will hold them (live widget or the class to be created).
+    static bool ValidateChildCapacity(FLayoutReconcileContext& Context, const TSharedPtr<FJsonObject>& NodeJson, UClass* NodeClass, const FString& NodeName)
     {
-        WidgetJson->SetArrayField(TEXT("children"), ChildrenJsonArray);
-    }
+        const TArray<TSharedPtr<FJsonValue>>* ChildrenArray = nullptr;
+        if (!NodeJson->TryGetArrayField(TEXT("children"), ChildrenArray) || ChildrenArray->Num() == 0)
+        {
+            return true;
+        }
 
-    return WidgetJson;
-}
+        const UPanelWidget* PanelDefaults = NodeClass ? Cast<UPanelWidget>(NodeClass->GetDefaultObject()) : nullptr;
+        if (!PanelDefaults || (!PanelDefaults->CanHaveMultipleChildren() && ChildrenArray->Num() > 1))
+        {
+            Context.ErrorCode = TEXT("invalid_node");
+            Context.Error = PanelDefaults
+                ? FString::Printf(TEXT("Widget '%s' holds a single child but the layout gives it %d."), *NodeName, ChildrenArray->Num())
+                : FString::Printf(TEXT("Widget '%s' is not a panel and cannot have children."), *NodeName);
+            return false;
+        }
 
-FString UUmgFileTransformation::ExportUmgAssetToJsonString(const FString& AssetPath, const FString& TargetWidgetName)
-{
-    FString PackageName = FPackageName::ObjectPathToPackageName(AssetPath);
-    
-    UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(StaticLoadObject(UWidgetBlueprint::StaticClass(), nullptr, *PackageName));
+        for (const TSharedPtr<FJsonValue>& ChildValue : *ChildrenArray)
+        {
+            const TSharedPtr<FJsonObject>* ChildObject = nullptr;
+            if (!ChildValue->TryGetObject(ChildObject))
+            {
+                continue;
+            }
 
-    if (!WidgetBlueprint)
-    {
-        UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: Failed to load UWidgetBlueprint from path '%s'."), *AssetPath);
-        return FString();
-    }
-    
-    if (!WidgetBlueprint->WidgetTree)
-    {
-        UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: WidgetTree is null in UWidgetBlueprint '%s'."), *AssetPath);
-        return FString();
+            const FString ChildName = (*ChildObject)->GetStringField(TEXT("widget_name"));
+            UWidget* const* Existing = Context.LiveWidgets.Find(ChildName);
+            UClass* ChildClass = Existing ? (*Existing)->GetClass() : FUmgWidgetClassResolver::Get().Resolve((*ChildObject)->GetStringField(TEXT("widget_class")));
+            if (!ValidateChildCapacity(Context, *ChildObject, ChildClass, ChildName))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
-    UWidget* TargetWidget = nullptr;
-    if (TargetWidgetName.IsEmpty() || TargetWidgetName.Equals(TEXT("Root"), ESearchCase::IgnoreCase))
+    // Runs before anything is modified. Named widgets may move, but only within the target's subtree.
+    static bool ValidateReconcile(FLayoutReconcileContext& Context, UWidget* TargetWidget)
     {
-        TargetWidget = WidgetBlueprint->WidgetTree->RootWidget;
-        if (!TargetWidget)
+        const TSharedPtr<FJsonObject>& RootJson = Context.Layout.Root;
+        FString RootName;
+        FString RootClassPath;
+        RootJson->TryGetStringField(TEXT("widget_name"), RootName);
+        RootJson->TryGetStringField(TEXT("widget_class"), RootClassPath);
+
+        if (!RootName.IsEmpty() && RootName != TargetWidget->GetName())
         {
-            UE_LOG(LogUmgMcp, Warning, TEXT("ExportUmgAssetToJsonString: Root widget not found in UWidgetBlueprint '%s'. This may be an empty UI."), *AssetPath);
-            return FString();
+            Context.ErrorCode = TEXT("root_mismatch");
+            Context.Error = FString::Printf(TEXT("The layout root '%s' does not match the target widget '%s'; reconcile diffs the target against the root."), *RootName, *TargetWidget->GetName());
+            return false;
         }
-    }
-    else
-    {
-        TargetWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*TargetWidgetName));
-        if (!TargetWidget)
+        if (RootName.IsEmpty() && Context.Layout.Widgets.Contains(TargetWidget->GetName()))
+        {
+            Context.ErrorCode = TEXT("parent_mismatch");
+            Context.Error = FString::Printf(TEXT("The target widget '%s' cannot appear inside its own layout."), *TargetWidget->GetName());
+            return false;
+        }
+        if (!RootClassPath.IsEmpty() && !RootClassPath.Equals(TargetWidget->GetClass()->GetPathName(), ESearchCase::IgnoreCase))
         {
-             UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: Target widget '%s' not found in '%s'."), *TargetWidgetName, *AssetPath);
-             return FString();
+            Context.ErrorCode = TEXT("class_mismatch");
+            Context.Error = FString::Printf(TEXT("Class mismatch for widget '%s' (JSON: %s, Existing: %s)."), *TargetWidget->GetName(), *RootClassPath, *TargetWidget->GetClass()->GetPathName());
+            return false;
         }
-    }
 
-    TSharedPtr<FJsonObject> RootJsonObject = ExportWidgetToJson(TargetWidget);
+        for (const auto& Pair : Context.Layout.Widgets)
+        {
+            UWidget* ExistingWidget = FUmgWidgetIndexCache::Get().FindWidget(Context.WidgetBlueprint, Pair.Key);
+            if (!ExistingWidget)
+            {
+                continue;
+            }
 
-    if (!RootJsonObject.IsValid())
-    {
-        UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: Failed to convert widget '%s' of '%s' to FJsonObject."), *TargetWidget->GetName(), *AssetPath);
-        return FString();
-    }
+            UWidget* const* LiveWidget = Context.LiveWidgets.Find(Pair.Key);
+            if (!LiveWidget || *LiveWidget != ExistingWidget)
+            {
+                Context.ErrorCode = TEXT("parent_mismatch");
+                Context.Error = FString::Printf(TEXT("Widget '%s' exists outside the reconciled subtree of '%s'."), *Pair.Key, *TargetWidget->GetName());
+                return false;
+            }
 
-    FString JsonString;
-    TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
-    
-    if (FJsonSerializer::Serialize(RootJsonObject.ToSharedRef(), JsonWriter))
-    {
-        JsonWriter->Close();
-        UE_LOG(LogUmgMcp, Log, TEXT("Successfully exported UMG asset '%s' (Target: %s) to JSON."), *AssetPath, *TargetWidget->GetName());
-        return JsonString;
+            const FString ExistingClassPath = ExistingWidget->GetClass()->GetPathName();
+            if (!Pair.Value.ClassPath.IsEmpty() && !Pair.Value.ClassPath.Equals(ExistingClassPath, ESearchCase::IgnoreCase))
+            {
+                Context.ErrorCode = TEXT("class_mismatch");
+                Context.Error = FString::Printf(TEXT("Class mismatch for widget '%s' (JSON: %s, Existing: %s)."), *Pair.Key, *Pair.Value.ClassPath, *ExistingClassPath);
+                return false;
+            }
+        }
+
+        return ValidateChildCapacity(Context, RootJson, TargetWidget->GetClass(), TargetWidget->GetName());
     }
-    else
+
+    // Tallies the pass and commits it the cheapest way the changes allow; an unchanged layout leaves the asset clean.
+    static void CommitReconciledLayout(FLayoutReconcileContext& Context, UWidget* TargetWidget)
     {
-        JsonWriter->Close();
-        UE_LOG(LogUmgMcp, Error, TEXT("ExportUmgAssetToJsonString: Failed to serialize FJsonObject to string for asset '%s'."), *AssetPath);
-        return FString();
+        FUmgApplyJsonResult& Result = Context.Result;
+        for (const auto& Pair : Context.LiveWidgets)
+        {
+            if (Pair.Value != TargetWidget && !Context.Layout.Widgets.Contains(Pair.Key))
+            {
+                ++Result.WidgetsRemoved;
+                Context.TouchedWidgets.Add(Pair.Value);
+#if WITH_EDITORONLY_DATA
+                // Removing a widget already put the blueprint in the undo buffer; drop its variable guid with it.
+                Context.WidgetBlueprint->WidgetVariableNameToGuidMap.Remove(Pair.Value->GetFName());
+#endif
+            }
+        }
+        Context.TouchedWidgets.Append(Context.MovedWidgets);
+
+        Result.bReconciled = true;
+        Result.WidgetsMoved = Context.MovedWidgets.Num();
+        Result.WidgetsTouched = Context.TouchedWidgets.Num();
+        Result.bStructuralChange |= Result.WidgetsCreated > 0 || Result.WidgetsRemoved > 0 || Result.WidgetsMoved > 0;
+
+        if (Result.WidgetsTouched == 0)
+        {
+            return;
+        }
+
+        UWidgetBlueprint* WidgetBlueprint = Context.WidgetBlueprint;
+        WidgetBlueprint->GetOutermost()->MarkPackageDirty();
+        if (Result.bStructuralChange)
+        {
+            FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+            return;
+        }
+
+        // Values only: the generated class is unchanged, so skip skeleton regeneration and patch the open preview.
+        FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBlueprint);
+        for (const auto& Pair : Context.Writes)
+        {
+            UUmgSetSubsystem::SyncDesignerPreview(WidgetBlueprint, Pair.Key, Pair.Value.WidgetProperties, Pair.Value.SlotProperties);
+        }
     }
 }
 
-bool UUmgFileTransformation::ApplyJsonStringToUmgAsset(const FString& AssetPath, const FString& JsonData, const FString& TargetWidgetName)
+FUmgApplyJsonResult UUmgFileTransformation::ApplyPreparedLayout(const FString& AssetPath, const FUmgPreparedLayout& Layout, const FString& TargetWidgetName, EUmgLayoutApplyMode Mode)
 {
-    // Dispatch the task to the game thread asynchronously ("fire and forget").
-    // The original implementation used a blocking wait which could cause the editor to freeze or deadlock.
-    // We capture parameters by value to ensure they are valid when the task eventually executes.
-    FFunctionGraphTask::CreateAndDispatchWhenReady([AssetPath, JsonData, TargetWidgetName]()
-    {
-        ApplyJsonToUmgAsset_GameThread(AssetPath, JsonData, TargetWidgetName);
-    }, TStatId(), nullptr, ENamedThreads::GameThread);
+    check(IsInGameThread());
 
-    // Return true to indicate the task was successfully dispatched.
-    // The operation itself runs in the background and the result will be visible in the editor.
-    return true;
-}
+    FUmgApplyJsonResult Result;
+    auto Fail = [&Result](const TCHAR* Code, const FString& Message)
+    {
+        UE_LOG(LogUmgMcp, Error, TEXT("ApplyPreparedLayout: %s"), *Message);
+        Result.bSuccess = false;
+        Result.ErrorCode = Code;
+        Result.Error = Message;
+        return Result;
+    };
+
+    if (!Layout.IsValid())
+    {
+        return Fail(Layout.ErrorCode.IsEmpty() ? TEXT("invalid_json") : *Layout.ErrorCode, Layout.Error.IsEmpty() ? FString(TEXT("Layout JSON is empty.")) : Layout.Error);
+    }
+    TSharedPtr<FJsonObject> RootJsonObject = Layout.Root;
 
+    // Reconcile and merge walk the payload against the live tree, which needs it as a document. Only reached before
+    // anything is mutated, so the parsed layout simply takes over the whole apply.
+    auto ApplyAsDocument = [&](const FString& ResolvedAssetPath)
+    {
+        UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Parsing the streamed %d-character payload as a document for %s."),
+            Layout.SourceText->Len(), Mode == EUmgLayoutApplyMode::Reconcile ? TEXT("reconcile") : TEXT("merge"));
+        TSharedPtr<FJsonObject> Document;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::CreateFromView(*Layout.SourceText);
+        if (!FJsonSerializer::Deserialize(Reader, Document) || !Document.IsValid())
+        {
+            return Fail(TEXT("invalid_json"), FString::Printf(TEXT("Layout JSON could not be parsed as an object: %s"), *Reader->GetErrorMessage()));
+        }
+        return ApplyPreparedLayout(ResolvedAssetPath, *PrepareLayoutJson(Document), TargetWidgetName, Mode);
+    };
 
-// This function is executed on the game thread to ensure thread safety when dealing with UObjects.
-bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& JsonData, const FString& TargetWidgetName)
-{
     // 0. Handle default workspace: if AssetPath is empty, try to get target from attention subsystem
     FString FinalAssetPath = AssetPath;
     if (FinalAssetPath.IsEmpty() || FinalAssetPath.TrimStartAndEnd().IsEmpty())
@@ -350,50 +1741,55 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
         if (FinalAssetPath.IsEmpty() || FinalAssetPath.TrimStartAndEnd().IsEmpty())
         {
             FinalAssetPath = TEXT("/Game/UnrealMotionGraphicsMCP.UnrealMotionGraphicsMCP");
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: No asset path provided or active target found. Using default workspace: '%s'."), *FinalAssetPath);
+            UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: No asset path provided or active target found. Using default workspace: '%s'."), *FinalAssetPath);
         }
         else
         {
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: No asset path provided. Using active target asset: '%s'."), *FinalAssetPath);
+            UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: No asset path provided. Using active target asset: '%s'."), *FinalAssetPath);
         }
     }
-    
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Starting for asset '%s'."), *FinalAssetPath);
+    Result.AssetPath = FinalAssetPath;
+    Result.WidgetCount = Layout.Widgets.Num();
 
-    // 1. Parse the incoming JSON data.
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Parsing JSON data."));
-    TSharedPtr<FJsonObject> RootJsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonData);
-    if (!FJsonSerializer::Deserialize(Reader, RootJsonObject) || !RootJsonObject.IsValid())
+    UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Starting for asset '%s'."), *FinalAssetPath);
+
+    // 1. Resolve every widget class up front so an unknown class fails before the asset is created or touched.
+    for (const FString& ClassPath : Layout.ClassPaths)
     {
-        UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Failed to parse JSON data."));
-        return false;
+        UClass* WidgetClass = FUmgWidgetClassResolver::Get().Resolve(ClassPath);
+        if (!WidgetClass || !WidgetClass->IsChildOf(UWidget::StaticClass()))
+        {
+            return Fail(TEXT("unknown_class"), FString::Printf(TEXT("Widget class '%s' could not be resolved."), *ClassPath));
+        }
     }
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: JSON data parsed successfully."));
 
     // 2. Load or create the target Widget Blueprint asset.
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Loading Widget Blueprint from '%s'."), *FinalAssetPath);
+    UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Loading Widget Blueprint from '%s'."), *FinalAssetPath);
     UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(StaticLoadObject(UWidgetBlueprint::StaticClass(), nullptr, *FinalAssetPath));
     
     bool bIsNewlyCreated = false;  // Track if this is a newly created blueprint
     
     if (!WidgetBlueprint)
     {
-        UE_LOG(LogUmgMcp, Warning, TEXT("ApplyJsonToUmgAsset_GameThread: Widget Blueprint at '%s' not found. Attempting to create new asset."), *FinalAssetPath);
+        UE_LOG(LogUmgMcp, Warning, TEXT("ApplyPreparedLayout: Widget Blueprint at '%s' not found. Attempting to create new asset."), *FinalAssetPath);
+
+        if (Layout.RootName.IsEmpty() || Layout.RootClassPath.IsEmpty())
+        {
+            return Fail(TEXT("invalid_node"), TEXT("The layout root needs widget_name and widget_class to create a new asset."));
+        }
         
         // Extract package path and asset name from FinalAssetPath
         // FinalAssetPath format: /Game/FolderName/AssetName.AssetName
         FString PackagePath, AssetName;
         if (FinalAssetPath.Split(TEXT("."), &PackagePath, &AssetName, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
         {
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Package: '%s', Asset: '%s'"), *PackagePath, *AssetName);
+            UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Package: '%s', Asset: '%s'"), *PackagePath, *AssetName);
             
             // Create a new package
             UPackage* Package = CreatePackage(*PackagePath);
             if (!Package)
             {
-                UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Failed to create package at '%s'."), *PackagePath);
-                return false;
+                return Fail(TEXT("asset_unavailable"), FString::Printf(TEXT("Failed to create package at '%s'."), *PackagePath));
             }
             
             // Create the Widget Blueprint using the factory
@@ -409,8 +1805,7 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
             
             if (!WidgetBlueprint)
             {
-                UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Failed to create new Widget Blueprint at '%s'."), *FinalAssetPath);
-                return false;
+                return Fail(TEXT("asset_unavailable"), FString::Printf(TEXT("Failed to create new Widget Blueprint at '%s'."), *FinalAssetPath));
             }
             
             bIsNewlyCreated = true;  // Mark as newly created
@@ -419,34 +1814,27 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
             Package->MarkPackageDirty();
             FAssetRegistryModule::AssetCreated(WidgetBlueprint);
             
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: New Widget Blueprint created at '%s'."), *FinalAssetPath);
+            UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: New Widget Blueprint created at '%s'."), *FinalAssetPath);
         }
         else
         {
-            UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Invalid asset path format '%s'."), *FinalAssetPath);
-            return false;
+            return Fail(TEXT("asset_unavailable"), FString::Printf(TEXT("Invalid asset path format '%s'."), *FinalAssetPath));
         }
     }
     else
     {
-        UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Widget Blueprint loaded."));
+        UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Widget Blueprint loaded."));
     }
+    Result.bCreatedAsset = bIsNewlyCreated;
 
     // 3. Ensure the WidgetTree is valid.
     if (!WidgetBlueprint->WidgetTree)
     {
-        UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: WidgetTree is null in UWidgetBlueprint '%s'."), *FinalAssetPath);
-        return false;
+        return Fail(TEXT("asset_unavailable"), FString::Printf(TEXT("WidgetTree is null in UWidgetBlueprint '%s'."), *FinalAssetPath));
     }
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: WidgetTree is valid."));
-
-    // 4. Mark the blueprint as modified so the editor knows to save it.
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Marking blueprint as modified."));
-    WidgetBlueprint->Modify();
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Blueprint marked as modified."));
 
-    // 5. Clear the existing widget tree OR find target widget
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Preparing to apply JSON. Target: %s"), *TargetWidgetName);
+    // 4. Find the target widget
+    UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Preparing to apply JSON. Target: %s"), *TargetWidgetName);
 
     UWidget* TargetWidget = nullptr;
     FString ResolvedTargetName = TargetWidgetName;
@@ -464,25 +1852,52 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
 
     if (!ResolvedTargetName.IsEmpty() && !ResolvedTargetName.Equals(TEXT("Root"), ESearchCase::IgnoreCase) && !ResolvedTargetName.Equals(TEXT("None"), ESearchCase::IgnoreCase))
     {
-        TargetWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*ResolvedTargetName));
+        TargetWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, ResolvedTargetName);
     }
 
     if (!TargetWidget)
     {
         TargetWidget = WidgetBlueprint->WidgetTree->RootWidget;
     }
+    const FString TargetParentName = TargetWidget ? TargetWidget->GetName() : TEXT("Root");
+
+    // Reconcile diffs the existing subtree; on an empty tree there is nothing to diff and the layout is created below.
+    if (Mode == EUmgLayoutApplyMode::Reconcile && TargetWidget)
+    {
+        if (Layout.IsStreamed())
+        {
+            return ApplyAsDocument(FinalAssetPath);
+        }
+
+        FLayoutReconcileContext Context(WidgetBlueprint, Layout, Result);
+        BuildLiveWidgetMap(TargetWidget, Context.LiveWidgets);
+        if (!ValidateReconcile(Context, TargetWidget))
+        {
+            return Fail(*Context.ErrorCode, Context.Error);
+        }
 
-    // Collect JSON widgets and validate structure consistency
-    TMap<FString, FJsonWidgetInfo> JsonWidgets;
-    CollectJsonWidgetInfos(RootJsonObject, TargetWidget ? TargetWidget->GetName() : TEXT("Root"), JsonWidgets);
+        if (!ReconcileNode(Context, RootJsonObject, TargetWidget, false))
+        {
+            FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
+            return Fail(*Context.ErrorCode, Context.Error);
+        }
+        CommitReconciledLayout(Context, TargetWidget);
+
+        UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Reconciled '%s' under '%s': %d created, %d removed, %d moved, %d properties written."),
+            *FinalAssetPath, *TargetWidget->GetName(), Result.WidgetsCreated, Result.WidgetsRemoved, Result.WidgetsMoved, Result.PropertiesWritten);
+        Result.TargetWidget = TargetWidget->GetName();
+        Result.bSuccess = true;
+        return Result;
+    }
 
+    // 5. Validate the payload against the existing tree before anything is modified.
     bool bHasOverlap = false;
-    for (const auto& Pair : JsonWidgets)
+    for (const auto& Pair : Layout.Widgets)
     {
         const FString& WidgetName = Pair.Key;
-        const FJsonWidgetInfo& JsonInfo = Pair.Value;
+        const FUmgJsonWidgetInfo& JsonInfo = Pair.Value;
 
-        UWidget* ExistingWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName));
+        UWidget* ExistingWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, WidgetName);
         if (ExistingWidget)
         {
             bHasOverlap = true;
@@ -491,15 +1906,14 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
             FString ExistingClassPath = ExistingWidget->GetClass()->GetPathName();
             if (!JsonInfo.ClassPath.IsEmpty() && !JsonInfo.ClassPath.Equals(ExistingClassPath, ESearchCase::IgnoreCase))
             {
-                UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Class mismatch for widget '%s' (JSON: %s, Existing: %s)."),
-                    *WidgetName, *JsonInfo.ClassPath, *ExistingClassPath);
-                return false;
+                return Fail(TEXT("class_mismatch"), FString::Printf(TEXT("Class mismatch for widget '%s' (JSON: %s, Existing: %s)."),
+                    *WidgetName, *JsonInfo.ClassPath, *ExistingClassPath));
             }
 
             // Parent matching check
             UWidget* ExistingParent = ExistingWidget->GetParent();
             FString ExistingParentName = ExistingParent ? ExistingParent->GetName() : TEXT("Root");
-            FString ExpectedParentName = JsonInfo.ParentName;
+            FString ExpectedParentName = JsonInfo.ParentName.IsEmpty() ? TargetParentName : JsonInfo.ParentName;
 
             bool bParentMatches = false;
             if (ExpectedParentName.Equals(ExistingParentName, ESearchCase::IgnoreCase))
@@ -517,35 +1931,49 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
 
             if (!bParentMatches)
             {
-                UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Parent mismatch for widget '%s' (JSON parent: %s, UE tree parent: %s)."),
-                    *WidgetName, *ExpectedParentName, *ExistingParentName);
-                return false;
+                return Fail(TEXT("parent_mismatch"), FString::Printf(TEXT("Parent mismatch for widget '%s' (JSON parent: %s, UE tree parent: %s)."),
+                    *WidgetName, *ExpectedParentName, *ExistingParentName));
             }
         }
     }
 
+    if (!bHasOverlap && (Layout.RootName.IsEmpty() || Layout.RootClassPath.IsEmpty()))
+    {
+        return Fail(TEXT("invalid_node"), TEXT("The layout root names no existing widget, so it needs widget_name and widget_class to be created."));
+    }
+    if (bHasOverlap && Layout.IsStreamed())
+    {
+        return ApplyAsDocument(FinalAssetPath);
+    }
+
+    // 6. The payload is valid; mutate.
+    WidgetBlueprint->Modify();
+
     if (!bHasOverlap)
     {
         // Unique names: apply_layout occurs on TargetWidget (which defaults to RootWidget)
         if (!TargetWidget)
         {
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Unique names and no root. Creating root widget."));
-            UWidget* NewRootWidget = CreateWidgetFromJson(RootJsonObject, WidgetBlueprint->WidgetTree, nullptr);
+            UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Unique names and no root. Creating root widget."));
+            UWidget* NewRootWidget = Layout.IsStreamed()
+                ? CreateWidgetsFromStream(Layout, WidgetBlueprint->WidgetTree, nullptr)
+                : CreateWidgetFromJson(RootJsonObject, WidgetBlueprint->WidgetTree, nullptr);
             if (!NewRootWidget)
             {
-                UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Failed to create root widget."));
-                return false;
+                return Fail(TEXT("apply_failed"), TEXT("Failed to create root widget."));
             }
             WidgetBlueprint->WidgetTree->RootWidget = NewRootWidget;
         }
         else
         {
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Unique names. Creating subtree under TargetWidget '%s'."), *TargetWidget->GetName());
-            UWidget* NewSubtree = CreateWidgetFromJson(RootJsonObject, WidgetBlueprint->WidgetTree, TargetWidget);
+            UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: Unique names. Creating subtree under TargetWidget '%s'."), *TargetWidget->GetName());
+            UWidget* NewSubtree = Layout.IsStreamed()
+                ? CreateWidgetsFromStream(Layout, WidgetBlueprint->WidgetTree, TargetWidget)
+                : CreateWidgetFromJson(RootJsonObject, WidgetBlueprint->WidgetTree, TargetWidget);
             if (!NewSubtree)
             {
-                UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Failed to create subtree under TargetWidget '%s'."), *TargetWidget->GetName());
-                return false;
+                FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
+                return Fail(TEXT("apply_failed"), FString::Printf(TEXT("Failed to create subtree under TargetWidget '%s'."), *TargetWidget->GetName()));
             }
         }
     }
@@ -560,44 +1988,33 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
         {
             // Fallback for empty tree (should not happen since we have overlap)
             UWidget* NewRootWidget = CreateWidgetFromJson(RootJsonObject, WidgetBlueprint->WidgetTree, nullptr);
-            if (!NewRootWidget) return false;
+            if (!NewRootWidget)
+            {
+                return Fail(TEXT("apply_failed"), TEXT("Failed to create root widget."));
+            }
             WidgetBlueprint->WidgetTree->RootWidget = NewRootWidget;
         }
     }
+    Result.bMerged = bHasOverlap;
+    Result.TargetWidget = TargetWidget ? TargetWidget->GetName() : FString();
+
+    // The tree was rebuilt or merged in place; name lookups must not see the pre-apply index.
+    FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
 
-    // 7.5. Verify widget tree integrity before marking as modified
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Verifying widget tree integrity."));
+    // 7. Verify widget tree integrity before marking as modified
     if (!WidgetBlueprint->WidgetTree->RootWidget)
     {
-        UE_LOG(LogUmgMcp, Error, TEXT("ApplyJsonToUmgAsset_GameThread: Root widget became null after assignment!"));
-        return false;
+        return Fail(TEXT("apply_failed"), TEXT("Root widget became null after assignment."));
     }
-    
-    // Ensure all widgets are properly owned by the WidgetTree
-    TArray<UWidget*> AllWidgets;
-    WidgetBlueprint->WidgetTree->GetAllWidgets(AllWidgets);
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Widget tree contains %d widgets."), AllWidgets.Num());
-
-    // 8. Save the blueprint by marking package as dirty
-    // Note: We don't call MarkBlueprintAsStructurallyModified because it causes crashes
-    // in async context, even for existing blueprints. Instead, we just mark dirty and let
-    // the user save manually or the editor will prompt on project close.
-    UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Marking package as dirty."));
-    
+
+    // 8. Save the blueprint by marking package as dirty; the user saves manually or is prompted on close.
     UPackage* Package = WidgetBlueprint->GetOutermost();
     if (Package)
     {
         Package->MarkPackageDirty();
-        FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
-        UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Package marked dirty: %s"), *PackageFileName);
-        
         if (bIsNewlyCreated)
         {
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: New asset created. Please save manually (Ctrl+S) or it will be saved on project close."));
-        }
-        else
-        {
-            UE_LOG(LogUmgMcp, Log, TEXT("ApplyJsonToUmgAsset_GameThread: Existing asset modified. Changes applied. If editor is open, close and reopen the asset to see changes, or press Compile."));
+            UE_LOG(LogUmgMcp, Log, TEXT("ApplyPreparedLayout: New asset created. Please save manually (Ctrl+S) or it will be saved on project close."));
         }
     }
     
@@ -607,7 +2024,8 @@ bool ApplyJsonToUmgAsset_GameThread(const FString& AssetPath, const FString& Jso
     
     UE_LOG(LogUmgMcp, Log, TEXT("Successfully applied JSON to UMG asset '%s'."), *FinalAssetPath);
 
-    return true;
+    Result.bSuccess = true;
+    return Result;
 }
 
 static void ApplyPropertiesToExistingWidget(const TSharedPtr<FJsonObject>& WidgetJson, UWidget* TargetWidget)
@@ -654,8 +2072,8 @@ static void ApplyPropertiesToExistingWidget(const TSharedPtr<FJsonObject>& Widge
     if (SlotProps.IsValid() && TargetWidget->Slot)
     {
         TargetWidget->Slot->Modify();
-        TSharedPtr<FJsonObject> NormalizedSlotProps = UUmgFileTransformation::NormalizeJsonKeysToPascalCase(SlotProps);
-        if (!FJsonObjectConverter::JsonObjectToUStruct(NormalizedSlotProps.ToSharedRef(), TargetWidget->Slot->GetClass(), TargetWidget->Slot, 0, 0))
+        UUmgFileTransformation::NormalizeJsonKeysInPlace(SlotProps, TargetWidget->Slot->GetClass());
+        if (!FJsonObjectConverter::JsonObjectToUStruct(SlotProps.ToSharedRef(), TargetWidget->Slot->GetClass(), TargetWidget->Slot, 0, 0))
         {
             UE_LOG(LogUmgMcp, Warning, TEXT("ApplyPropertiesToExistingWidget: Failed to apply Slot properties to '%s'."), *TargetWidget->GetName());
         }
@@ -750,35 +2168,22 @@ static void UpsertWidgetFromJsonAppendOnly(const TSharedPtr<FJsonObject>& Widget
     MergeChildrenAppendOnly(WidgetJson, WidgetTree, TargetWidget);
 }
 
-static UWidget* CreateWidgetFromJson(const TSharedPtr<FJsonObject>& WidgetJson, UWidgetTree* WidgetTree, UWidget* ParentWidget)
+// Creates one widget under ParentWidget and applies its properties and slot properties; children are up to the caller.
+static UWidget* CreateSingleWidget(const FString& WidgetName, const FString& WidgetClassPath, const TSharedPtr<FJsonObject>& Properties, UWidgetTree* WidgetTree, UWidget* ParentWidget)
 {
     FString ParentName = ParentWidget ? ParentWidget->GetName() : TEXT("None");
-    // UE_LOG(LogUmgMcp, Log, TEXT("CreateWidgetFromJson: Starting for Parent: %s"), *ParentName);
-
-    if (!WidgetJson.IsValid() || !WidgetTree)
-    {
-        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetFromJson: Invalid WidgetJson or WidgetTree."));
-        return nullptr;
-    }
 
-    FString WidgetClassPath, WidgetName;
-    if (!WidgetJson->TryGetStringField(TEXT("widget_class"), WidgetClassPath) || !WidgetJson->TryGetStringField(TEXT("widget_name"), WidgetName))
-    {
-        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetFromJson: JSON is missing widget_class or widget_name."));
-        return nullptr;
-    }
-
-    UClass* WidgetClass = StaticLoadClass(UWidget::StaticClass(), nullptr, *WidgetClassPath);
-    if (!WidgetClass)
+    UClass* WidgetClass = FUmgWidgetClassResolver::Get().Resolve(WidgetClassPath);
+    if (!WidgetClass || !WidgetClass->IsChildOf(UWidget::StaticClass()))
     {
-        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetFromJson: Failed to find widget class '%s'."), *WidgetClassPath);
+        UE_LOG(LogUmgMcp, Error, TEXT("CreateSingleWidget: Failed to find widget class '%s'."), *WidgetClassPath);
         return nullptr;
     }
 
     UWidget* NewWidget = NewObject<UWidget>(WidgetTree, WidgetClass, FName(*WidgetName));
     if (!NewWidget)
     {
-        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetFromJson: Failed to create widget of class '%s'."), *WidgetClassPath);
+        UE_LOG(LogUmgMcp, Error, TEXT("CreateSingleWidget: Failed to create widget of class '%s'."), *WidgetClassPath);
         return nullptr;
     }
 
@@ -792,40 +2197,34 @@ static UWidget* CreateWidgetFromJson(const TSharedPtr<FJsonObject>& WidgetJson,
             NewSlot = ParentPanel->AddChild(NewWidget);
             if (!NewSlot)
             {
-                UE_LOG(LogUmgMcp, Warning, TEXT("CreateWidgetFromJson: AddChild returned null slot for '%s' in '%s'."), *WidgetName, *ParentName);
+                UE_LOG(LogUmgMcp, Warning, TEXT("CreateSingleWidget: AddChild returned null slot for '%s' in '%s'."), *WidgetName, *ParentName);
             }
         }
         else
         {
-            UE_LOG(LogUmgMcp, Warning, TEXT("CreateWidgetFromJson: Parent '%s' is not a UPanelWidget, cannot add child '%s'."), *ParentName, *WidgetName);
+            UE_LOG(LogUmgMcp, Warning, TEXT("CreateSingleWidget: Parent '%s' is not a UPanelWidget, cannot add child '%s'."), *ParentName, *WidgetName);
         }
     }
 
     // 2. Prepare Property JSONs
-    const TSharedPtr<FJsonObject>* PropertiesJsonObjPtr;
     TSharedPtr<FJsonObject> WidgetProps = MakeShared<FJsonObject>();
     TSharedPtr<FJsonObject> SlotProps = nullptr;
 
-    if (WidgetJson->TryGetObjectField(TEXT("properties"), PropertiesJsonObjPtr))
+    if (Properties.IsValid())
     {
         // Copy properties to a new object so we can remove 'Slot' without modifying source
-        TSharedPtr<FJsonObject> SourceProps = *PropertiesJsonObjPtr;
-        for (auto& Pair : SourceProps->Values)
+        WidgetProps->Values = Properties->Values;
+
+        // Same key rules as the streaming reader (aliases, casing, nested struct fields), so a layout applies the
+        // same way whichever path its size selects. Streamed keys are already normalized and pass through unchanged.
+        UUmgFileTransformation::NormalizeJsonKeysInPlace(WidgetProps, NewWidget->GetClass());
+
+        const TSharedPtr<FJsonObject>* SlotObjPtr;
+        if (WidgetProps->TryGetObjectField(TEXT("Slot"), SlotObjPtr))
         {
-            const FString PropertyName = UmgMcpJsonCompat::KeyToString(Pair.Key);
-            if (PropertyName == TEXT("Slot"))
-            {
-                const TSharedPtr<FJsonObject>* SlotObjPtr;
-                if (Pair.Value->TryGetObject(SlotObjPtr))
-                {
-                    SlotProps = *SlotObjPtr;
-                }
-            }
-            else
-            {
-                WidgetProps->SetField(PropertyName, Pair.Value);
-            }
+            SlotProps = *SlotObjPtr;
         }
+        WidgetProps->RemoveField(TEXT("Slot"));
     }
 
     // 3. Apply Widget Properties using JsonObjectToUStruct (Safe & Robust)
@@ -833,7 +2232,7 @@ static UWidget* CreateWidgetFromJson(const TSharedPtr<FJsonObject>& WidgetJson,
     {
         if (!FJsonObjectConverter::JsonObjectToUStruct(WidgetProps.ToSharedRef(), NewWidget->GetClass(), NewWidget, 0, 0))
         {
-             UE_LOG(LogUmgMcp, Warning, TEXT("CreateWidgetFromJson: Issues applying properties to '%s'."), *WidgetName);
+             UE_LOG(LogUmgMcp, Warning, TEXT("CreateSingleWidget: Issues applying properties to '%s'."), *WidgetName);
         }
     }
 
@@ -841,48 +2240,80 @@ static UWidget* CreateWidgetFromJson(const TSharedPtr<FJsonObject>& WidgetJson,
     if (SlotProps.IsValid())
     {
         // Normalize JSON keys from camelCase to PascalCase to match C++ UPROPERTY names
-        UE_LOG(LogUmgMcp, Log, TEXT("CreateWidgetFromJson: Processing Slot properties for widget '%s'"), *WidgetName);
-        TSharedPtr<FJsonObject> NormalizedSlotProps = UUmgFileTransformation::NormalizeJsonKeysToPascalCase(SlotProps);
+        // The source tree is owned by this apply pass, so keys are rewritten in place against the real slot class.
+        UE_LOG(LogUmgMcp, Verbose, TEXT("CreateSingleWidget: Processing Slot properties for widget '%s'"), *WidgetName);
+        UPanelSlot* SlotForKeys = NewSlot ? NewSlot : NewWidget->Slot.Get();
+        UUmgFileTransformation::NormalizeJsonKeysInPlace(SlotProps, SlotForKeys ? SlotForKeys->GetClass() : nullptr);
+        TSharedPtr<FJsonObject> NormalizedSlotProps = SlotProps;
         
-        // Log the normalized Slot JSON for debugging
-        FString SlotPropsString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&SlotPropsString);
-        FJsonSerializer::Serialize(NormalizedSlotProps.ToSharedRef(), Writer);
-        UE_LOG(LogUmgMcp, Log, TEXT("CreateWidgetFromJson: Normalized Slot JSON for '%s': %s"), *WidgetName, *SlotPropsString);
+        // Serializing the slot JSON per widget is expensive on large layouts; only do it when verbose logging is on.
+        if (UE_LOG_ACTIVE(LogUmgMcp, Verbose))
+        {
+            FString SlotPropsString;
+            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&SlotPropsString);
+            FJsonSerializer::Serialize(NormalizedSlotProps.ToSharedRef(), Writer);
+            UE_LOG(LogUmgMcp, Verbose, TEXT("CreateSingleWidget: Normalized Slot JSON for '%s': %s"), *WidgetName, *SlotPropsString);
+        }
         
         if (NewSlot)
         {
-            UE_LOG(LogUmgMcp, Log, TEXT("CreateWidgetFromJson: Applying Slot properties to NewSlot (class: %s)"), *NewSlot->GetClass()->GetName());
+            UE_LOG(LogUmgMcp, Log, TEXT("CreateSingleWidget: Applying Slot properties to NewSlot (class: %s)"), *NewSlot->GetClass()->GetName());
             
             if (!FJsonObjectConverter::JsonObjectToUStruct(NormalizedSlotProps.ToSharedRef(), NewSlot->GetClass(), NewSlot, 0, 0))
             {
-                UE_LOG(LogUmgMcp, Warning, TEXT("CreateWidgetFromJson: Issues applying Slot properties to '%s'."), *WidgetName);
+                UE_LOG(LogUmgMcp, Warning, TEXT("CreateSingleWidget: Issues applying Slot properties to '%s'."), *WidgetName);
             }
             else
             {
-                UE_LOG(LogUmgMcp, Log, TEXT("CreateWidgetFromJson: Successfully applied Slot properties to '%s'"), *WidgetName);
+                UE_LOG(LogUmgMcp, Log, TEXT("CreateSingleWidget: Successfully applied Slot properties to '%s'"), *WidgetName);
             }
         }
         else if (NewWidget->Slot)
         {
              // Fallback to NewWidget->Slot if AddChild didn't return one but it exists (e.g. RootWidget might not have slot, but this branch is for children)
-             UE_LOG(LogUmgMcp, Log, TEXT("CreateWidgetFromJson: Applying Slot properties to NewWidget->Slot (class: %s)"), *NewWidget->Slot->GetClass()->GetName());
+             UE_LOG(LogUmgMcp, Log, TEXT("CreateSingleWidget: Applying Slot properties to NewWidget->Slot (class: %s)"), *NewWidget->Slot->GetClass()->GetName());
              
              if (!FJsonObjectConverter::JsonObjectToUStruct(NormalizedSlotProps.ToSharedRef(), NewWidget->Slot->GetClass(), NewWidget->Slot, 0, 0))
              {
-                 UE_LOG(LogUmgMcp, Warning, TEXT("CreateWidgetFromJson: Issues applying Slot properties to '%s' (fallback)."), *WidgetName);
+                 UE_LOG(LogUmgMcp, Warning, TEXT("CreateSingleWidget: Issues applying Slot properties to '%s' (fallback)."), *WidgetName);
              }
              else
              {
-                 UE_LOG(LogUmgMcp, Log, TEXT("CreateWidgetFromJson: Successfully applied Slot properties to '%s' (fallback)"), *WidgetName);
+                 UE_LOG(LogUmgMcp, Log, TEXT("CreateSingleWidget: Successfully applied Slot properties to '%s' (fallback)"), *WidgetName);
              }
         }
         else
         {
-            UE_LOG(LogUmgMcp, Warning, TEXT("CreateWidgetFromJson: Slot properties specified but no valid Slot found for '%s'."), *WidgetName);
+            UE_LOG(LogUmgMcp, Warning, TEXT("CreateSingleWidget: Slot properties specified but no valid Slot found for '%s'."), *WidgetName);
         }
     }
 
+    return NewWidget;
+}
+
+static UWidget* CreateWidgetFromJson(const TSharedPtr<FJsonObject>& WidgetJson, UWidgetTree* WidgetTree, UWidget* ParentWidget)
+{
+    if (!WidgetJson.IsValid() || !WidgetTree)
+    {
+        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetFromJson: Invalid WidgetJson or WidgetTree."));
+        return nullptr;
+    }
+
+    FString WidgetClassPath, WidgetName;
+    if (!WidgetJson->TryGetStringField(TEXT("widget_class"), WidgetClassPath) || !WidgetJson->TryGetStringField(TEXT("widget_name"), WidgetName))
+    {
+        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetFromJson: JSON is missing widget_class or widget_name."));
+        return nullptr;
+    }
+
+    const TSharedPtr<FJsonObject>* PropertiesJsonObjPtr = nullptr;
+    WidgetJson->TryGetObjectField(TEXT("properties"), PropertiesJsonObjPtr);
+    UWidget* NewWidget = CreateSingleWidget(WidgetName, WidgetClassPath, PropertiesJsonObjPtr ? *PropertiesJsonObjPtr : nullptr, WidgetTree, ParentWidget);
+    if (!NewWidget)
+    {
+        return nullptr;
+    }
+
     // 5. Process Children
     const TArray<TSharedPtr<FJsonValue>>* ChildrenJsonArray;
     if (WidgetJson->TryGetArrayField(TEXT("children"), ChildrenJsonArray))
@@ -899,3 +2330,50 @@ static UWidget* CreateWidgetFromJson(const TSharedPtr<FJsonObject>& WidgetJson,
 
     return NewWidget;
 }
+
+// CreateWidgetFromJson for a streamed layout: nodes arrive in pre-order with their depth, so the last widget created
+// at each depth is the parent of the next deeper one. Only one node's properties are alive at a time.
+static UWidget* CreateWidgetsFromStream(const FUmgPreparedLayout& Layout, UWidgetTree* WidgetTree, UWidget* ParentWidget)
+{
+    if (!Layout.SourceText.IsValid() || !WidgetTree)
+    {
+        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetsFromStream: Invalid layout or WidgetTree."));
+        return nullptr;
+    }
+
+    // Resolved classes are reused for key normalization; the resolver caches them, so this costs a map lookup per node.
+    FUmgLayoutJsonStream Stream(*Layout.SourceText, true, [](const FString& ClassPath) -> const UStruct*
+    {
+        return FUmgWidgetClassResolver::Get().Resolve(ClassPath);
+    });
+
+    TArray<UWidget*, TInlineAllocator<32>> Parents;
+    FUmgStreamedWidget Node;
+    while (Stream.Next(Node))
+    {
+        // A node whose parent failed is dropped with its subtree, as the recursive path does.
+        UWidget* Parent = ParentWidget;
+        if (Node.Depth > 0)
+        {
+            Parent = Parents.IsValidIndex(Node.Depth - 1) ? Parents[Node.Depth - 1] : nullptr;
+        }
+
+        UWidget* NewWidget = nullptr;
+        if (Node.Depth == 0 || Parent)
+        {
+            NewWidget = CreateSingleWidget(Node.Name, Node.ClassPath, Node.Properties, WidgetTree, Parent);
+        }
+        Node.Properties.Reset();
+
+        Parents.SetNum(Node.Depth + 1, EAllowShrinking::No);
+        Parents[Node.Depth] = NewWidget;
+    }
+
+    if (Stream.HasError() || Stream.NeedsDocument())
+    {
+        // PrepareLayoutJson already scanned this text, so this only happens if it changed underneath the layout.
+        UE_LOG(LogUmgMcp, Error, TEXT("CreateWidgetsFromStream: %s"), Stream.HasError() ? *Stream.GetError() : TEXT("Layout no longer streams."));
+        return nullptr;
+    }
+    return Parents.Num() > 0 ? Parents[0] : nullptr;
+}
@@ -0,0 +1,258 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "FileManage/UmgLayoutJsonStream.h"
+#include "Widget/UmgPropertyPathCache.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+FUmgLayoutJsonStream::FUmgLayoutJsonStream(FStringView InText, bool bInReadProperties, FClassResolver InResolveClass)
+    : Reader(TJsonReaderFactory<TCHAR>::CreateFromView(InText))
+    , ResolveClass(MoveTemp(InResolveClass))
+    , bReadProperties(bInReadProperties)
+{
+}
+
+bool FUmgLayoutJsonStream::Next(FUmgStreamedWidget& OutWidget)
+{
+    if (bFinished || bNeedsDocument || HasError())
+    {
+        return false;
+    }
+
+    EJsonNotation Notation;
+    if (!bStarted)
+    {
+        bStarted = true;
+        if (!ReadNotation(Notation))
+        {
+            return false;
+        }
+        if (Notation != EJsonNotation::ObjectStart)
+        {
+            return Fail(TEXT("invalid_json"), TEXT("Layout JSON could not be parsed as an object."));
+        }
+        Stack.AddDefaulted();
+    }
+
+    while (Stack.Num() > 0)
+    {
+        if (!ReadNotation(Notation))
+        {
+            return false;
+        }
+
+        if (Stack.Last().bInChildren)
+        {
+            if (Notation == EJsonNotation::ArrayEnd)
+            {
+                Stack.Last().bInChildren = false;
+            }
+            else if (Notation == EJsonNotation::ObjectStart)
+            {
+                const FString ParentName = Stack.Last().Widget.Name;
+                const int32 Depth = Stack.Last().Widget.Depth + 1;
+                FFrame& Child = Stack.AddDefaulted_GetRef();
+                Child.Widget.ParentName = ParentName;
+                Child.Widget.Depth = Depth;
+            }
+            else if (!SkipValue(Notation))
+            {
+                // Non-object entries in a children array are ignored, as the DOM appliers do.
+                return false;
+            }
+            continue;
+        }
+
+        FFrame& Frame = Stack.Last();
+        if (Notation == EJsonNotation::ObjectEnd)
+        {
+            const bool bEmitNow = !Frame.bEmitted;
+            if (bEmitNow)
+            {
+                Emit(Frame, OutWidget);
+            }
+            Stack.Pop();
+            bFinished = Stack.Num() == 0;
+            if (bEmitNow)
+            {
+                return true;
+            }
+            continue;
+        }
+
+        const FString& Identifier = Reader->GetIdentifier();
+        if (Notation == EJsonNotation::ArrayStart && Identifier == TEXT("children"))
+        {
+            Frame.bInChildren = true;
+            if (!Frame.bEmitted)
+            {
+                Emit(Frame, OutWidget);
+                return true;
+            }
+            continue;
+        }
+
+        const bool bNameField = Notation == EJsonNotation::String && Identifier == TEXT("widget_name");
+        const bool bClassField = Notation == EJsonNotation::String && Identifier == TEXT("widget_class");
+        const bool bPropertiesField = Notation == EJsonNotation::ObjectStart && Identifier == TEXT("properties");
+        if ((bNameField || bClassField || bPropertiesField) && Frame.bEmitted)
+        {
+            bNeedsDocument = true;
+            return false;
+        }
+
+        if (bNameField)
+        {
+            Frame.Widget.Name = Reader->GetValueAsString();
+        }
+        else if (bClassField)
+        {
+            Frame.Widget.ClassPath = Reader->GetValueAsString();
+        }
+        else if (bPropertiesField && bReadProperties)
+        {
+            const UStruct* Owner = ResolveClass && !Frame.Widget.ClassPath.IsEmpty() ? ResolveClass(Frame.Widget.ClassPath) : nullptr;
+            TSharedPtr<FJsonObject> Properties = ReadObject(Owner);
+            if (!Properties.IsValid())
+            {
+                return false;
+            }
+            Frame.Widget.Properties = MoveTemp(Properties);
+        }
+        else if (!SkipValue(Notation))
+        {
+            return false;
+        }
+    }
+
+    bFinished = true;
+    return false;
+}
+
+void FUmgLayoutJsonStream::Emit(FFrame& Frame, FUmgStreamedWidget& OutWidget)
+{
+    OutWidget.Name = Frame.Widget.Name;
+    OutWidget.ClassPath = Frame.Widget.ClassPath;
+    OutWidget.ParentName = Frame.Widget.ParentName;
+    OutWidget.Depth = Frame.Widget.Depth;
+    OutWidget.Properties = MoveTemp(Frame.Widget.Properties);
+    Frame.bEmitted = true;
+}
+
+bool FUmgLayoutJsonStream::Fail(const TCHAR* Code, const FString& Message)
+{
+    ErrorCode = Code;
+    Error = Message;
+    return false;
+}
+
+bool FUmgLayoutJsonStream::ReadNotation(EJsonNotation& OutNotation)
+{
+    if (!Reader->ReadNext(OutNotation) || OutNotation == EJsonNotation::Error)
+    {
+        const FString& ReaderError = Reader->GetErrorMessage();
+        return Fail(TEXT("invalid_json"), FString::Printf(TEXT("Layout JSON could not be parsed as an object: %s"),
+            ReaderError.IsEmpty() ? TEXT("unexpected end of input") : *ReaderError));
+    }
+    return true;
+}
+
+bool FUmgLayoutJsonStream::SkipValue(EJsonNotation Notation)
+{
+    if (Notation != EJsonNotation::ObjectStart && Notation != EJsonNotation::ArrayStart)
+    {
+        return true;
+    }
+
+    int32 Depth = 1;
+    while (Depth > 0)
+    {
+        if (!ReadNotation(Notation))
+        {
+            return false;
+        }
+        if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+        {
+            ++Depth;
+        }
+        else if (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
+        {
+            --Depth;
+        }
+    }
+    return true;
+}
+
+TSharedPtr<FJsonValue> FUmgLayoutJsonStream::ReadValue(EJsonNotation Notation, const UStruct* Owner)
+{
+    switch (Notation)
+    {
+    case EJsonNotation::String:
+        return MakeShared<FJsonValueString>(Reader->GetValueAsString());
+    case EJsonNotation::Number:
+        // Kept as text, as FJsonSerializer does, so 64-bit integers survive until the property writer parses them.
+        return MakeShared<FJsonValueNumberString>(Reader->GetValueAsNumberString());
+    case EJsonNotation::Boolean:
+        return MakeShared<FJsonValueBoolean>(Reader->GetValueAsBoolean());
+    case EJsonNotation::Null:
+        return MakeShared<FJsonValueNull>();
+    case EJsonNotation::ObjectStart:
+    {
+        TSharedPtr<FJsonObject> Object = ReadObject(Owner);
+        return Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : nullptr;
+    }
+    case EJsonNotation::ArrayStart:
+    {
+        TArray<TSharedPtr<FJsonValue>> Items;
+        while (ReadNotation(Notation))
+        {
+            if (Notation == EJsonNotation::ArrayEnd)
+            {
+                return MakeShared<FJsonValueArray>(MoveTemp(Items));
+            }
+            TSharedPtr<FJsonValue> Item = ReadValue(Notation, Owner);
+            if (!Item.IsValid())
+            {
+                return nullptr;
+            }
+            Items.Add(MoveTemp(Item));
+        }
+        return nullptr;
+    }
+    default:
+        Fail(TEXT("invalid_json"), TEXT("Layout JSON contains an unexpected token."));
+        return nullptr;
+    }
+}
+
+TSharedPtr<FJsonObject> FUmgLayoutJsonStream::ReadObject(const UStruct* Owner)
+{
+    TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+    EJsonNotation Notation;
+    while (ReadNotation(Notation))
+    {
+        if (Notation == EJsonNotation::ObjectEnd)
+        {
+            return Object;
+        }
+
+        FString Key = Reader->GetIdentifier();
+        const UStruct* ValueOwner = nullptr;
+        if (Owner)
+        {
+            const TSharedRef<const FUmgResolvedPropertyKey> Resolved = FUmgPropertyPathCache::Get().ResolveKey(Owner, Key);
+            if (Resolved->IsFullyResolved())
+            {
+                Key = Resolved->NormalizedKey;
+                ValueOwner = Resolved->ValueOwner;
+            }
+        }
+
+        TSharedPtr<FJsonValue> Value = ReadValue(Notation, ValueOwner);
+        if (!Value.IsValid())
+        {
+            return nullptr;
+        }
+        Object->SetField(Key, MoveTemp(Value));
+    }
+    return nullptr;
+}
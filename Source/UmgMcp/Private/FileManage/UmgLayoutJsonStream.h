@@ -0,0 +1,87 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/JsonReader.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/** One widget node of a layout payload, without its children. */
+struct FUmgStreamedWidget
+{
+    FString Name;
+    FString ClassPath;
+
+    /** Name of the enclosing node; empty for the payload root. */
+    FString ParentName;
+
+    /** 0 for the payload root. */
+    int32 Depth = 0;
+
+    /**
+     * The node's own "properties". Keys that resolve against the widget class (see FUmgLayoutJsonStream) are
+     * rewritten to the reflected property names as they are read. Null when absent or not requested.
+     */
+    TSharedPtr<FJsonObject> Properties;
+};
+
+/**
+ * Pull reader that walks layout JSON token by token and hands out widget nodes in pre-order.
+ *
+ * Only the node being read is materialized: its name, class and (optionally) its properties object. Children arrays
+ * and unknown fields are never built into a DOM, so memory stays proportional to one widget however large the
+ * payload is. A node is handed out as soon as its "children" array starts (or it ends), which requires
+ * widget_name, widget_class and properties to precede children -- the order export_umg_to_json writes. A payload
+ * that puts them after children reports NeedsDocument(), and callers fall back to the DOM path.
+ *
+ * When a class resolver is given, property keys are normalized on the fly against the class named by widget_class:
+ * keys that resolve to a reflected property take its exact name, nested objects follow the property's struct, and
+ * anything unresolved is kept verbatim for the appliers' own normalization (e.g. slot keys against the real slot).
+ *
+ * The text is referenced, not copied, and must outlive the stream. Safe on any thread without a resolver; the
+ * resolver decides where it may run.
+ */
+class FUmgLayoutJsonStream
+{
+public:
+    using FClassResolver = TFunction<const UStruct*(const FString& ClassPath)>;
+
+    /** bInReadProperties = false skips property values entirely (name / class / structure scans). */
+    FUmgLayoutJsonStream(FStringView InText, bool bInReadProperties, FClassResolver InResolveClass = nullptr);
+
+    /** Next node in pre-order. Returns false at the end of the payload or on an error. */
+    bool Next(FUmgStreamedWidget& OutWidget);
+
+    bool HasError() const { return !ErrorCode.IsEmpty(); }
+    const FString& GetErrorCode() const { return ErrorCode; }
+    const FString& GetError() const { return Error; }
+
+    /** A node field followed its children array; the payload has to be read as a document instead. */
+    bool NeedsDocument() const { return bNeedsDocument; }
+
+private:
+    struct FFrame
+    {
+        FUmgStreamedWidget Widget;
+        bool bEmitted = false;
+        bool bInChildren = false;
+    };
+
+    bool Fail(const TCHAR* Code, const FString& Message);
+    bool ReadNotation(EJsonNotation& OutNotation);
+    bool SkipValue(EJsonNotation Notation);
+    TSharedPtr<FJsonValue> ReadValue(EJsonNotation Notation, const UStruct* Owner);
+    TSharedPtr<FJsonObject> ReadObject(const UStruct* Owner);
+    void Emit(FFrame& Frame, FUmgStreamedWidget& OutWidget);
+
+    TSharedRef<TJsonReader<TCHAR>> Reader;
+    FClassResolver ResolveClass;
+    TArray<FFrame> Stack;
+    bool bReadProperties = false;
+    bool bStarted = false;
+    bool bFinished = false;
+    bool bNeedsDocument = false;
+    FString ErrorCode;
+    FString Error;
+};
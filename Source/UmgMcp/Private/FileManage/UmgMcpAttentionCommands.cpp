@@ -60,6 +60,20 @@ TSharedPtr<FJsonObject> FUmgMcpAttentionCommands::HandleCommand(const FString& C
         FString AssetPath = AttentionSubsystem->GetTargetUmgAsset();
         Response->SetBoolField(TEXT("success"), true);
         Response->SetStringField(TEXT("asset_path"), AssetPath);
+
+        const FUmgPrefetchProgress Prefetch = AttentionSubsystem->GetPrefetchProgress();
+        TSharedPtr<FJsonObject> PrefetchJson = MakeShared<FJsonObject>();
+        PrefetchJson->SetStringField(TEXT("package"), Prefetch.PackageName);
+        PrefetchJson->SetNumberField(TEXT("requested_packages"), Prefetch.RequestedPackages);
+        PrefetchJson->SetNumberField(TEXT("requested_assets"), Prefetch.RequestedAssets);
+        PrefetchJson->SetNumberField(TEXT("loaded_assets"), Prefetch.LoadedAssets);
+        PrefetchJson->SetNumberField(TEXT("resident_packages"), Prefetch.ResidentPackages);
+        PrefetchJson->SetNumberField(TEXT("skipped_over_budget"), Prefetch.SkippedOverBudget);
+        PrefetchJson->SetNumberField(TEXT("estimated_bytes"), static_cast<double>(Prefetch.EstimatedBytes));
+        PrefetchJson->SetNumberField(TEXT("budget_bytes"), static_cast<double>(Prefetch.BudgetBytes));
+        PrefetchJson->SetBoolField(TEXT("walking"), Prefetch.bWalking);
+        PrefetchJson->SetBoolField(TEXT("complete"), Prefetch.bComplete);
+        Response->SetObjectField(TEXT("prefetch"), PrefetchJson);
 	}
 	else if (Command == TEXT("get_last_edited_umg_asset"))
 	{
@@ -0,0 +1,417 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "FileManage/UmgMcpBatchCommandlet.h"
+#include "FileManage/UmgFileTransformation.h"
+#include "UmgMcp.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Blueprint/WidgetTree.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
+
+namespace
+{
+    enum class EBatchMode : uint8
+    {
+        Export,
+        Apply,
+        Verify
+    };
+
+    struct FBatchOptions
+    {
+        EBatchMode Mode = EBatchMode::Export;
+        FString PackagePath;
+        FString JsonDir;
+        FString SummaryFile;
+        int32 BatchSize = 32;
+        uint64 MemoryLimitBytes = 0;
+        bool bIncludeHashes = true;
+    };
+
+    /** Outcome of one asset: exported, applied, unchanged, changed, empty, skipped or failed. */
+    struct FAssetOutcome
+    {
+        FString Status;
+        FString Error;
+        int32 ChangeCount = 0;
+    };
+
+    static bool ParseOptions(const FString& Params, FBatchOptions& OutOptions)
+    {
+        FString ModeName;
+        FParse::Value(*Params, TEXT("Mode="), ModeName);
+        if (ModeName.IsEmpty() || ModeName.Equals(TEXT("export"), ESearchCase::IgnoreCase))
+        {
+            OutOptions.Mode = EBatchMode::Export;
+        }
+        else if (ModeName.Equals(TEXT("apply"), ESearchCase::IgnoreCase))
+        {
+            OutOptions.Mode = EBatchMode::Apply;
+        }
+        else if (ModeName.Equals(TEXT("verify"), ESearchCase::IgnoreCase))
+        {
+            OutOptions.Mode = EBatchMode::Verify;
+        }
+        else
+        {
+            UE_LOG(LogUmgMcp, Error, TEXT("UmgMcpBatch: Unknown mode '%s'. Use export, apply or verify."), *ModeName);
+            return false;
+        }
+
+        if (!FParse::Value(*Params, TEXT("Path="), OutOptions.PackagePath))
+        {
+            OutOptions.PackagePath = TEXT("/Game");
+        }
+        OutOptions.PackagePath.RemoveFromEnd(TEXT("/"));
+        if (!FPackageName::IsValidLongPackageName(OutOptions.PackagePath, true))
+        {
+            UE_LOG(LogUmgMcp, Error, TEXT("UmgMcpBatch: '%s' is not a package path (e.g. /Game/UI)."), *OutOptions.PackagePath);
+            return false;
+        }
+
+        if (!FParse::Value(*Params, TEXT("Dir="), OutOptions.JsonDir))
+        {
+            OutOptions.JsonDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UmgMcp"), TEXT("Json"));
+        }
+        OutOptions.JsonDir = FPaths::ConvertRelativePathToFull(OutOptions.JsonDir);
+
+        if (!FParse::Value(*Params, TEXT("Summary="), OutOptions.SummaryFile))
+        {
+            OutOptions.SummaryFile = FPaths::Combine(OutOptions.JsonDir, TEXT("UmgMcpBatchSummary.json"));
+        }
+
+        FParse::Value(*Params, TEXT("BatchSize="), OutOptions.BatchSize);
+        OutOptions.BatchSize = FMath::Max(1, OutOptions.BatchSize);
+
+        int32 MemoryLimitMB = 0;
+        FParse::Value(*Params, TEXT("MemoryLimitMB="), MemoryLimitMB);
+        OutOptions.MemoryLimitBytes = static_cast<uint64>(FMath::Max(0, MemoryLimitMB)) * 1024 * 1024;
+
+        OutOptions.bIncludeHashes = !FParse::Param(*Params, TEXT("NoHashes"));
+        return true;
+    }
+
+    static const TCHAR* ModeToString(EBatchMode Mode)
+    {
+        switch (Mode)
+        {
+        case EBatchMode::Apply:
+            return TEXT("apply");
+        case EBatchMode::Verify:
+            return TEXT("verify");
+        default:
+            return TEXT("export");
+        }
+    }
+
+    // "/Game/UI/WBP_Main" -> "<Dir>/Game/UI/WBP_Main.json", mirroring the content tree.
+    static FString GetJsonFilePath(const FBatchOptions& Options, const FString& PackageName)
+    {
+        return FPaths::Combine(Options.JsonDir, PackageName.RightChop(1) + TEXT(".json"));
+    }
+
+    // Files are kept with LF line endings whatever platform wrote them, so agents and workstations compare equal.
+    static FString NormalizeLineEndings(FString Text)
+    {
+        Text.ReplaceInline(TEXT("\r\n"), TEXT("\n"), ESearchCase::CaseSensitive);
+        return Text;
+    }
+
+    static bool LoadJsonFile(const FString& JsonFile, FString& OutText)
+    {
+        if (!FFileHelper::LoadFileToString(OutText, *JsonFile))
+        {
+            return false;
+        }
+        OutText = NormalizeLineEndings(MoveTemp(OutText));
+        return true;
+    }
+
+    static bool IsEmptyWidgetTree(const FString& ObjectPath)
+    {
+        const UWidgetBlueprint* WidgetBlueprint = FindObject<UWidgetBlueprint>(nullptr, *ObjectPath);
+        return WidgetBlueprint && WidgetBlueprint->WidgetTree && !WidgetBlueprint->WidgetTree->RootWidget;
+    }
+
+    static bool SaveWidgetBlueprint(UWidgetBlueprint* WidgetBlueprint)
+    {
+        // The reconciler only regenerates the skeleton class; compile so the saved generated class matches the tree.
+        FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+
+        UPackage* Package = WidgetBlueprint->GetOutermost();
+        const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+        SaveArgs.SaveFlags = SAVE_NoError;
+        return UPackage::SavePackage(Package, WidgetBlueprint, *Filename, SaveArgs);
+    }
+
+    static FAssetOutcome ExportAsset(const FBatchOptions& Options, const FString& ObjectPath, const FString& JsonFile)
+    {
+        FAssetOutcome Outcome;
+        const FString JsonText = NormalizeLineEndings(UUmgFileTransformation::ExportUmgAssetToJsonString(ObjectPath, FString(), Options.bIncludeHashes));
+        if (JsonText.IsEmpty())
+        {
+            Outcome.Status = IsEmptyWidgetTree(ObjectPath) ? TEXT("empty") : TEXT("failed");
+            Outcome.Error = Outcome.Status == TEXT("failed") ? FString(TEXT("Export produced no JSON.")) : FString();
+            return Outcome;
+        }
+
+        // Leave identical files alone so build agents do not touch timestamps of layouts that did not change.
+        FString Existing;
+        if (LoadJsonFile(JsonFile, Existing) && Existing == JsonText)
+        {
+            Outcome.Status = TEXT("unchanged");
+            return Outcome;
+        }
+
+        IFileManager::Get().MakeDirectory(*FPaths::GetPath(JsonFile), true);
+        if (!FFileHelper::SaveStringToFile(JsonText, *JsonFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            Outcome.Status = TEXT("failed");
+            Outcome.Error = FString::Printf(TEXT("Could not write '%s'."), *JsonFile);
+            return Outcome;
+        }
+        Outcome.Status = TEXT("exported");
+        return Outcome;
+    }
+
+    static FAssetOutcome ApplyAsset(const FString& ObjectPath, const FString& JsonFile)
+    {
+        FAssetOutcome Outcome;
+        FString JsonText;
+        if (!LoadJsonFile(JsonFile, JsonText))
+        {
+            Outcome.Status = TEXT("skipped");
+            Outcome.Error = FString::Printf(TEXT("No JSON file at '%s'."), *JsonFile);
+            return Outcome;
+        }
+
+        TSharedRef<FUmgPreparedLayout> Layout = UUmgFileTransformation::PrepareLayoutJson(MoveTemp(JsonText));
+        if (!Layout->IsValid())
+        {
+            Outcome.Status = TEXT("failed");
+            Outcome.Error = FString::Printf(TEXT("%s: %s"), *Layout->ErrorCode, *Layout->Error);
+            return Outcome;
+        }
+
+        // The file describes the whole tree, so widgets it no longer lists are removed rather than kept.
+        const FUmgApplyJsonResult Result = UUmgFileTransformation::ApplyPreparedLayout(ObjectPath, *Layout, FString(), EUmgLayoutApplyMode::Reconcile);
+        if (!Result.bSuccess)
+        {
+            Outcome.Status = TEXT("failed");
+            Outcome.Error = FString::Printf(TEXT("%s: %s"), *Result.ErrorCode, *Result.Error);
+            return Outcome;
+        }
+
+        UWidgetBlueprint* WidgetBlueprint = FindObject<UWidgetBlueprint>(nullptr, *ObjectPath);
+        if (!WidgetBlueprint || !WidgetBlueprint->GetOutermost()->IsDirty())
+        {
+            Outcome.Status = TEXT("unchanged");
+            return Outcome;
+        }
+
+        Outcome.ChangeCount = Result.WidgetsCreated + Result.WidgetsRemoved + Result.WidgetsMoved + Result.PropertiesWritten;
+        if (!SaveWidgetBlueprint(WidgetBlueprint))
+        {
+            Outcome.Status = TEXT("failed");
+            Outcome.Error = TEXT("Applied, but the package could not be saved.");
+            return Outcome;
+        }
+        Outcome.Status = TEXT("applied");
+        return Outcome;
+    }
+
+    static FAssetOutcome VerifyAsset(const FString& ObjectPath, const FString& JsonFile)
+    {
+        FAssetOutcome Outcome;
+        FString JsonText;
+        if (!LoadJsonFile(JsonFile, JsonText))
+        {
+            Outcome.Status = TEXT("failed");
+            Outcome.Error = FString::Printf(TEXT("No JSON file at '%s'."), *JsonFile);
+            return Outcome;
+        }
+
+        TSharedPtr<FJsonObject> Baseline;
+        if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonText), Baseline) || !Baseline.IsValid())
+        {
+            Outcome.Status = TEXT("failed");
+            Outcome.Error = FString::Printf(TEXT("'%s' is not valid JSON."), *JsonFile);
+            return Outcome;
+        }
+
+        // Files written without hashes can only be compared as text.
+        if (!Baseline->HasField(TEXT("hash")))
+        {
+            const FString Current = NormalizeLineEndings(UUmgFileTransformation::ExportUmgAssetToJsonString(ObjectPath));
+            Outcome.Status = Current == JsonText ? TEXT("unchanged") : TEXT("changed");
+            Outcome.ChangeCount = Current == JsonText ? 0 : 1;
+            return Outcome;
+        }
+
+        const TSharedPtr<FJsonObject> Diff = UUmgFileTransformation::DiffUmgAssetAgainstJson(ObjectPath, Baseline);
+        if (!Diff->GetBoolField(TEXT("success")))
+        {
+            Outcome.Status = TEXT("failed");
+            Outcome.Error = Diff->GetStringField(TEXT("error"));
+            return Outcome;
+        }
+
+        Outcome.ChangeCount = Diff->GetArrayField(TEXT("changes")).Num();
+        Outcome.Status = Outcome.ChangeCount == 0 ? TEXT("unchanged") : TEXT("changed");
+        return Outcome;
+    }
+}
+
+UUmgMcpBatchCommandlet::UUmgMcpBatchCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UUmgMcpBatchCommandlet::Main(const FString& Params)
+{
+    FBatchOptions Options;
+    if (!ParseOptions(Params, Options))
+    {
+        return 1;
+    }
+
+    // Only the registry is consulted to find the assets; nothing is loaded until its turn comes.
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    AssetRegistry.ScanPathsSynchronous({ Options.PackagePath }, true);
+
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*Options.PackagePath));
+    Filter.bRecursivePaths = true;
+    Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(Filter, Assets);
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName.LexicalLess(B.PackageName);
+    });
+
+    UE_LOG(LogUmgMcp, Display, TEXT("UmgMcpBatch: %s %d widget blueprint(s) under '%s' (JSON: %s)."),
+        ModeToString(Options.Mode), Assets.Num(), *Options.PackagePath, *Options.JsonDir);
+
+    TArray<TSharedPtr<FJsonValue>> AssetEntries;
+    AssetEntries.Reserve(Assets.Num());
+    TMap<FString, int32> StatusCounts;
+    const double StartTime = FPlatformTime::Seconds();
+    int32 InBatch = 0;
+
+    for (const FAssetData& AssetData : Assets)
+    {
+        const FString ObjectPath = AssetData.GetObjectPathString();
+        const FString JsonFile = GetJsonFilePath(Options, AssetData.PackageName.ToString());
+
+        const double AssetStart = FPlatformTime::Seconds();
+        FAssetOutcome Outcome;
+        switch (Options.Mode)
+        {
+        case EBatchMode::Apply:
+            Outcome = ApplyAsset(ObjectPath, JsonFile);
+            break;
+        case EBatchMode::Verify:
+            Outcome = VerifyAsset(ObjectPath, JsonFile);
+            break;
+        default:
+            Outcome = ExportAsset(Options, ObjectPath, JsonFile);
+            break;
+        }
+        const double Seconds = FPlatformTime::Seconds() - AssetStart;
+
+        StatusCounts.FindOrAdd(Outcome.Status)++;
+        if (Outcome.Status == TEXT("failed"))
+        {
+            UE_LOG(LogUmgMcp, Error, TEXT("UmgMcpBatch: %s failed: %s"), *ObjectPath, *Outcome.Error);
+        }
+        else if (Outcome.Status == TEXT("changed"))
+        {
+            UE_LOG(LogUmgMcp, Warning, TEXT("UmgMcpBatch: %s differs from %s (%d change(s))."), *ObjectPath, *JsonFile, Outcome.ChangeCount);
+        }
+        else
+        {
+            UE_LOG(LogUmgMcp, Display, TEXT("UmgMcpBatch: %s %s in %.3f s."), *ObjectPath, *Outcome.Status, Seconds);
+        }
+
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("asset_path"), ObjectPath);
+        Entry->SetStringField(TEXT("json_file"), JsonFile);
+        Entry->SetStringField(TEXT("status"), Outcome.Status);
+        Entry->SetNumberField(TEXT("seconds"), Seconds);
+        if (Outcome.ChangeCount > 0)
+        {
+            Entry->SetNumberField(TEXT("changes"), Outcome.ChangeCount);
+        }
+        if (!Outcome.Error.IsEmpty())
+        {
+            Entry->SetStringField(TEXT("error"), Outcome.Error);
+        }
+        AssetEntries.Add(MakeShared<FJsonValueObject>(Entry));
+
+        // Loaded widget blueprints pull in their textures, fonts and materials; release them batch by batch.
+        const bool bOverMemoryLimit = Options.MemoryLimitBytes > 0 && FPlatformMemory::GetStats().UsedPhysical > Options.MemoryLimitBytes;
+        if (++InBatch >= Options.BatchSize || bOverMemoryLimit)
+        {
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+            InBatch = 0;
+        }
+    }
+
+    const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+    const int32 Failed = StatusCounts.FindRef(TEXT("failed"));
+    const int32 Changed = StatusCounts.FindRef(TEXT("changed"));
+
+    TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+    Summary->SetStringField(TEXT("mode"), ModeToString(Options.Mode));
+    Summary->SetStringField(TEXT("path"), Options.PackagePath);
+    Summary->SetStringField(TEXT("json_dir"), Options.JsonDir);
+    Summary->SetNumberField(TEXT("asset_count"), Assets.Num());
+    Summary->SetNumberField(TEXT("seconds"), TotalSeconds);
+    TSharedRef<FJsonObject> Counts = MakeShared<FJsonObject>();
+    for (const TPair<FString, int32>& Pair : StatusCounts)
+    {
+        Counts->SetNumberField(Pair.Key, Pair.Value);
+    }
+    Summary->SetObjectField(TEXT("counts"), Counts);
+    Summary->SetArrayField(TEXT("assets"), AssetEntries);
+
+    FString SummaryText;
+    FJsonSerializer::Serialize(Summary, TJsonWriterFactory<>::Create(&SummaryText));
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(Options.SummaryFile), true);
+    if (!FFileHelper::SaveStringToFile(SummaryText, *Options.SummaryFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogUmgMcp, Error, TEXT("UmgMcpBatch: Could not write summary to '%s'."), *Options.SummaryFile);
+        return 1;
+    }
+
+    UE_LOG(LogUmgMcp, Display, TEXT("UmgMcpBatch: %d asset(s) in %.2f s, %d failed, %d changed. Summary: %s"),
+        Assets.Num(), TotalSeconds, Failed, Changed, *Options.SummaryFile);
+
+    // Verify is the CI gate: a stored layout that no longer matches its asset fails the run.
+    return Failed > 0 || (Options.Mode == EBatchMode::Verify && Changed > 0) ? 1 : 0;
+}
@@ -2,10 +2,45 @@
 // UmgMcpFileTransformationCommands.cpp
 #include "FileManage/UmgMcpFileTransformationCommands.h"
 #include "FileManage/UmgFileTransformation.h" // Our utility class
+#include "FileManage/UmgBinarySnapshot.h"
 #include "Serialization/JsonSerializer.h" // For FJsonSerializer
 #include "Serialization/JsonWriter.h" // For FJsonWriter
+#include "Serialization/JsonReader.h" // For FJsonReader
 
-TSharedPtr<FJsonObject> FUmgMcpFileTransformationCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+static bool TryGetLayoutString(const TSharedPtr<FJsonObject>& Params, FString& OutJsonData)
+{
+    return Params->TryGetStringField(TEXT("json_data"), OutJsonData) ||
+        Params->TryGetStringField(TEXT("layout_json"), OutJsonData) ||
+        Params->TryGetStringField(TEXT("layout_content"), OutJsonData);
+}
+
+TSharedPtr<FJsonObject> FUmgMcpFileTransformationCommands::PrepareCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    TSharedPtr<FUmgPreparedLayout>& OutLayout)
+{
+    FString JsonData;
+    if ((CommandType != TEXT("apply_json_to_umg") && CommandType != TEXT("apply_layout")) || !Params.IsValid() || !TryGetLayoutString(Params, JsonData))
+    {
+        return nullptr;
+    }
+
+    TSharedRef<FUmgPreparedLayout> Layout = UUmgFileTransformation::PrepareLayoutJson(MoveTemp(JsonData));
+    if (!Layout->IsValid())
+    {
+        FUmgApplyJsonResult Result;
+        Result.ErrorCode = Layout->ErrorCode;
+        Result.Error = Layout->Error;
+        return Result.ToJson();
+    }
+
+    Params->RemoveField(TEXT("json_data"));
+    Params->RemoveField(TEXT("layout_json"));
+    Params->RemoveField(TEXT("layout_content"));
+    OutLayout = Layout;
+    return nullptr;
+}
+
+TSharedPtr<FJsonObject> FUmgMcpFileTransformationCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    const TSharedPtr<FUmgPreparedLayout>& PreparedLayout)
 {
     TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
 
@@ -16,8 +51,10 @@ TSharedPtr<FJsonObject> FUmgMcpFileTransformationCommands::HandleCommand(const F
         {
             FString TargetWidgetName;
             Params->TryGetStringField(TEXT("widget_name"), TargetWidgetName); // Optional
+            bool bIncludeHashes = false;
+            Params->TryGetBoolField(TEXT("include_hashes"), bIncludeHashes); // Optional
 
-            FString JsonOutput = UUmgFileTransformation::ExportUmgAssetToJsonString(AssetPath, TargetWidgetName);
+            FString JsonOutput = UUmgFileTransformation::ExportUmgAssetToJsonString(AssetPath, TargetWidgetName, bIncludeHashes);
             if (!JsonOutput.IsEmpty())
             {
                 ResultJson->SetStringField(TEXT("output"), JsonOutput);
@@ -35,15 +72,99 @@ TSharedPtr<FJsonObject> FUmgMcpFileTransformationCommands::HandleCommand(const F
             ResultJson->SetBoolField(TEXT("success"), false);
         }
     }
+    else if (CommandType == TEXT("diff_umg"))
+    {
+        FString AssetPath;
+        if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+        {
+            ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'asset_path' parameter for diff_umg."));
+            ResultJson->SetBoolField(TEXT("success"), false);
+            return ResultJson;
+        }
+
+        // The baseline is a stored export_umg_to_json output, either as its JSON text or already parsed.
+        TSharedPtr<FJsonObject> Baseline;
+        const TSharedPtr<FJsonObject>* BaselineObject = nullptr;
+        FString BaselineText;
+        if (Params->TryGetObjectField(TEXT("baseline"), BaselineObject))
+        {
+            Baseline = *BaselineObject;
+        }
+        else if (Params->TryGetStringField(TEXT("baseline"), BaselineText))
+        {
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineText);
+            if (!FJsonSerializer::Deserialize(Reader, Baseline) || !Baseline.IsValid())
+            {
+                ResultJson->SetStringField(TEXT("error_code"), TEXT("invalid_json"));
+                ResultJson->SetStringField(TEXT("error"), TEXT("'baseline' is not valid JSON."));
+                ResultJson->SetBoolField(TEXT("success"), false);
+                return ResultJson;
+            }
+        }
+        else
+        {
+            ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'baseline' parameter for diff_umg."));
+            ResultJson->SetBoolField(TEXT("success"), false);
+            return ResultJson;
+        }
+
+        FString TargetWidgetName;
+        Params->TryGetStringField(TEXT("widget_name"), TargetWidgetName); // Optional
+
+        ResultJson = UUmgFileTransformation::DiffUmgAssetAgainstJson(AssetPath, Baseline, TargetWidgetName);
+    }
+    else if (CommandType == TEXT("export_umg_snapshot"))
+    {
+        FString AssetPath;
+        if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+        {
+            ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'asset_path' parameter for export_umg_snapshot."));
+            ResultJson->SetBoolField(TEXT("success"), false);
+            return ResultJson;
+        }
+
+        FString TargetWidgetName;
+        Params->TryGetStringField(TEXT("widget_name"), TargetWidgetName); // Optional
+        FString FilePath;
+        Params->TryGetStringField(TEXT("file_path"), FilePath); // Optional, defaults under Saved/UmgMcp/Snapshots
+
+        ResultJson = FUmgBinarySnapshot::ExportToFile(AssetPath, TargetWidgetName, FilePath);
+    }
+    else if (CommandType == TEXT("apply_umg_snapshot"))
+    {
+        FString FilePath;
+        if (!Params->TryGetStringField(TEXT("file_path"), FilePath))
+        {
+            ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'file_path' parameter for apply_umg_snapshot."));
+            ResultJson->SetBoolField(TEXT("success"), false);
+            return ResultJson;
+        }
+
+        FString AssetPath;
+        Params->TryGetStringField(TEXT("asset_path"), AssetPath); // Optional, can fall back to target asset
+        FString TargetWidgetName;
+        Params->TryGetStringField(TEXT("widget_name"), TargetWidgetName); // Optional
+
+        ResultJson = FUmgBinarySnapshot::ApplyFromFile(FilePath, AssetPath, TargetWidgetName);
+    }
     else if (CommandType == TEXT("apply_json_to_umg") || CommandType == TEXT("apply_layout"))
     {
         FString AssetPath;
         Params->TryGetStringField(TEXT("asset_path"), AssetPath); // Optional, can fall back to target asset
 
+        // The bridge parses and validates the payload on the connection thread; only direct game-thread calls
+        // still carry the layout string.
+        TSharedPtr<FUmgPreparedLayout> Layout = PreparedLayout;
         FString JsonData;
-        if (Params->TryGetStringField(TEXT("json_data"), JsonData) ||
-            Params->TryGetStringField(TEXT("layout_json"), JsonData) ||
-            Params->TryGetStringField(TEXT("layout_content"), JsonData))
+        if (!Layout.IsValid() && TryGetLayoutString(Params, JsonData))
+        {
+            Params->RemoveField(TEXT("json_data"));
+            Params->RemoveField(TEXT("layout_json"));
+            Params->RemoveField(TEXT("layout_content"));
+            Layout = UUmgFileTransformation::PrepareLayoutJson(MoveTemp(JsonData));
+        }
+
+        if (Layout.IsValid())
         {
             FString TargetWidgetName;
             if (!Params->TryGetStringField(TEXT("widget_name"), TargetWidgetName))
@@ -51,21 +172,21 @@ TSharedPtr<FJsonObject> FUmgMcpFileTransformationCommands::HandleCommand(const F
                 Params->TryGetStringField(TEXT("target_widget_name"), TargetWidgetName);
             }
 
-            bool bSuccess = UUmgFileTransformation::ApplyJsonStringToUmgAsset(AssetPath, JsonData, TargetWidgetName);
-            if (bSuccess)
+            FString ModeName;
+            Params->TryGetStringField(TEXT("mode"), ModeName);
+            EUmgLayoutApplyMode Mode = EUmgLayoutApplyMode::Merge;
+            if (ModeName.Equals(TEXT("reconcile"), ESearchCase::IgnoreCase))
             {
-                ResultJson->SetStringField(TEXT("asset_path"), AssetPath);
-                if (!TargetWidgetName.IsEmpty())
-                {
-                    ResultJson->SetStringField(TEXT("target_widget"), TargetWidgetName);
-                }
-                ResultJson->SetBoolField(TEXT("success"), true);
+                Mode = EUmgLayoutApplyMode::Reconcile;
             }
-            else
+            else if (!ModeName.IsEmpty() && !ModeName.Equals(TEXT("merge"), ESearchCase::IgnoreCase))
             {
-                ResultJson->SetStringField(TEXT("error"), TEXT("Failed to apply JSON data to UMG asset."));
+                ResultJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown apply mode '%s'. Use 'merge' or 'reconcile'."), *ModeName));
                 ResultJson->SetBoolField(TEXT("success"), false);
+                return ResultJson;
             }
+
+            ResultJson = UUmgFileTransformation::ApplyPreparedLayout(AssetPath, *Layout, TargetWidgetName, Mode).ToJson();
         }
         else
         {
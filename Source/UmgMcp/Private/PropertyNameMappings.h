@@ -4,7 +4,7 @@
 //
 // 使用说明：
 // 1. 当发现某个属性在camelCase格式下无法正确应用时，添加到此映射表
-// 2. NormalizeJsonKeysToPascalCase会自动使用此映射表进行转换
+// 2. NormalizeJsonKeysInPlace会自动使用此映射表进行转换
 // 3. 格式：{"camelCase属性名", "PascalCase C++属性名"}
 
 #pragma once
@@ -113,3 +113,29 @@ static FString NormalizePropertyName(const FString& Key)
     
     return NormalizedKey;
 }
+
+/**
+ * 与NormalizePropertyName规则相同，但直接追加到StringBuilder，避免为每个键段分配临时FString
+ * 
+ * @param Out 输出缓冲区
+ * @param Key 原始属性名片段（不含'.'）
+ */
+static void AppendNormalizedPropertyName(FStringBuilderBase& Out, FStringView Key)
+{
+    const TMap<FString, FString>& Mappings = GetPropertyNameMappings();
+    
+    if (const FString* MappedName = Mappings.FindByHash(GetTypeHash(Key), Key))
+    {
+        Out << *MappedName;
+        return;
+    }
+    
+    if (Key.Len() > 0 && FChar::IsLower(Key[0]))
+    {
+        Out.AppendChar(FChar::ToUpper(Key[0]));
+        Out << Key.RightChop(1);
+        return;
+    }
+    
+    Out << Key;
+}
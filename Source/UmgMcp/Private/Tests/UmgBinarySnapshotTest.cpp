@@ -0,0 +1,163 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "FileManage/UmgBinarySnapshot.h"
+#include "Widget/UmgWidgetIndex.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/Image.h"
+#include "Components/TextBlock.h"
+#include "Components/VerticalBox.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "WidgetBlueprint.h"
+#include "WidgetBlueprintGeneratedClass.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The snapshot API addresses assets by path, so each test blueprint gets its own package named after it.
+	UWidgetBlueprint* CreateTestWidgetBlueprint(const TCHAR* Prefix, FString& OutAssetPath)
+	{
+		const FString AssetName = FString::Printf(TEXT("%s_%s"), Prefix, *FGuid::NewGuid().ToString());
+		OutAssetPath = FString::Printf(TEXT("/Temp/%s"), *AssetName);
+		UPackage* Package = CreatePackage(*OutAssetPath);
+		Package->SetFlags(RF_Transient);
+		return Cast<UWidgetBlueprint>(FKismetEditorUtilities::CreateBlueprint(
+			UUserWidget::StaticClass(),
+			Package,
+			FName(*AssetName),
+			BPTYPE_Normal,
+			UWidgetBlueprint::StaticClass(),
+			UWidgetBlueprintGeneratedClass::StaticClass()));
+	}
+
+	void DiscardTestWidgetBlueprint(UWidgetBlueprint* WidgetBlueprint)
+	{
+		if (WidgetBlueprint)
+		{
+			WidgetBlueprint->ClearFlags(RF_Public | RF_Standalone);
+			WidgetBlueprint->MarkAsGarbage();
+		}
+	}
+
+	int32 CountWidgets(UWidgetBlueprint* WidgetBlueprint)
+	{
+		TArray<UWidget*> Widgets;
+		WidgetBlueprint->WidgetTree->GetAllWidgets(Widgets);
+		return Widgets.Num();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUmgBinarySnapshotRoundTripTest,
+	"UmgMcp.FileManage.BinarySnapshot.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUmgBinarySnapshotRoundTripTest::RunTest(const FString& Parameters)
+{
+	FString SourcePath;
+	FString TargetPath;
+	UWidgetBlueprint* Source = CreateTestWidgetBlueprint(TEXT("UmgMcpSnapshotSource"), SourcePath);
+	UWidgetBlueprint* Target = CreateTestWidgetBlueprint(TEXT("UmgMcpSnapshotTarget"), TargetPath);
+	if (!TestNotNull(TEXT("source blueprint"), Source) || !TestNotNull(TEXT("target blueprint"), Target))
+	{
+		DiscardTestWidgetBlueprint(Source);
+		DiscardTestWidgetBlueprint(Target);
+		return false;
+	}
+
+	UWidgetTree* SourceTree = Source->WidgetTree;
+	UCanvasPanel* Canvas = SourceTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("Panel"));
+	SourceTree->RootWidget = Canvas;
+	UTextBlock* Label = SourceTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("Label"));
+	Label->SetText(FText::FromString(TEXT("Stamped")));
+	Cast<UCanvasPanelSlot>(Canvas->AddChild(Label))->SetPosition(FVector2D(40.0, 20.0));
+	UVerticalBox* Box = SourceTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("Box"));
+	Canvas->AddChild(Box);
+	UImage* Icon = SourceTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Icon"));
+	Icon->SetColorAndOpacity(FLinearColor(0.25f, 0.5f, 0.75f, 1.0f));
+	Box->AddChild(Icon);
+	FUmgWidgetIndexCache::Get().Invalidate(Source);
+
+	const FString SnapshotPath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("UmgMcpSnapshotTest.umgsnap"));
+	const FString CorruptPath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("UmgMcpSnapshotTestCorrupt.umgsnap"));
+
+	const TSharedPtr<FJsonObject> Exported = FUmgBinarySnapshot::ExportToFile(SourcePath, FString(), SnapshotPath);
+	TestTrue(TEXT("export succeeds"), Exported->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("exported widgets"), Exported->GetIntegerField(TEXT("widget_count")), 4);
+
+	// Into an empty tree: the snapshot root becomes the root.
+	const TSharedPtr<FJsonObject> Applied = FUmgBinarySnapshot::ApplyFromFile(SnapshotPath, TargetPath, FString());
+	TestTrue(TEXT("apply succeeds"), Applied->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("widgets created"), Applied->GetIntegerField(TEXT("widgets_created")), 4);
+	TestFalse(TEXT("no renames in an empty tree"), Applied->HasField(TEXT("renamed")));
+
+	UTextBlock* StampedLabel = Cast<UTextBlock>(FUmgWidgetIndexCache::Get().FindWidget(Target, FString(TEXT("Label"))));
+	UImage* StampedIcon = Cast<UImage>(FUmgWidgetIndexCache::Get().FindWidget(Target, FString(TEXT("Icon"))));
+	if (TestNotNull(TEXT("label stamped"), StampedLabel))
+	{
+		TestEqual(TEXT("label text"), StampedLabel->GetText().ToString(), FString(TEXT("Stamped")));
+		const UCanvasPanelSlot* StampedSlot = Cast<UCanvasPanelSlot>(StampedLabel->Slot);
+		TestTrue(TEXT("label slot position"), StampedSlot && StampedSlot->GetPosition().Equals(FVector2D(40.0, 20.0)));
+	}
+	if (TestNotNull(TEXT("icon stamped"), StampedIcon))
+	{
+		TestTrue(TEXT("icon color"), StampedIcon->GetColorAndOpacity().Equals(FLinearColor(0.25f, 0.5f, 0.75f, 1.0f)));
+		TestTrue(TEXT("icon keeps its parent"), StampedIcon->GetParent() && StampedIcon->GetParent()->GetFName() == TEXT("Box"));
+	}
+	for (const TCHAR* StampedName : { TEXT("Panel"), TEXT("Label"), TEXT("Box"), TEXT("Icon") })
+	{
+		const FGuid* VariableGuid = Target->WidgetVariableNameToGuidMap.Find(FName(StampedName));
+		TestTrue(FString::Printf(TEXT("%s has a variable guid"), StampedName), VariableGuid && VariableGuid->IsValid());
+	}
+
+	// Again, under the stamped box: every name is taken now.
+	const TSharedPtr<FJsonObject> Stacked = FUmgBinarySnapshot::ApplyFromFile(SnapshotPath, TargetPath, TEXT("Box"));
+	TestTrue(TEXT("second apply succeeds"), Stacked->GetBoolField(TEXT("success")));
+	const TSharedPtr<FJsonObject>* Renamed = nullptr;
+	TestTrue(TEXT("colliding names are renamed"), Stacked->TryGetObjectField(TEXT("renamed"), Renamed) && (*Renamed)->HasField(TEXT("Label")));
+
+	// A value record one byte short must be rejected before anything is created.
+	TArray<uint8> Bytes;
+	TestTrue(TEXT("snapshot readable"), FFileHelper::LoadFileToArray(Bytes, *SnapshotPath));
+	const int32 NumPropertiesOffset = 20;
+	const int32 PropertiesOffsetOffset = 56;
+	int32 NumProperties = 0;
+	uint64 PropertiesOffset = 0;
+	if (Bytes.Num() > PropertiesOffsetOffset + static_cast<int32>(sizeof(uint64)))
+	{
+		FMemory::Memcpy(&NumProperties, Bytes.GetData() + NumPropertiesOffset, sizeof(int32));
+		FMemory::Memcpy(&PropertiesOffset, Bytes.GetData() + PropertiesOffsetOffset, sizeof(uint64));
+	}
+	if (TestTrue(TEXT("snapshot has property records"), NumProperties > 0 && PropertiesOffset + 8 <= static_cast<uint64>(Bytes.Num())))
+	{
+		int32 BlobSize = 0;
+		uint8* BlobSizePtr = Bytes.GetData() + PropertiesOffset + sizeof(int32);
+		FMemory::Memcpy(&BlobSize, BlobSizePtr, sizeof(int32));
+		BlobSize -= 1;
+		FMemory::Memcpy(BlobSizePtr, &BlobSize, sizeof(int32));
+		FFileHelper::SaveArrayToFile(Bytes, *CorruptPath);
+
+		const int32 WidgetsBefore = CountWidgets(Target);
+		const TSharedPtr<FJsonObject> Rejected = FUmgBinarySnapshot::ApplyFromFile(CorruptPath, TargetPath, TEXT("Box"));
+		TestFalse(TEXT("corrupt snapshot rejected"), Rejected->GetBoolField(TEXT("success")));
+		TestEqual(TEXT("corrupt snapshot error"), Rejected->GetStringField(TEXT("error_code")), FString(TEXT("invalid_snapshot")));
+		TestEqual(TEXT("asset untouched"), CountWidgets(Target), WidgetsBefore);
+	}
+
+	IFileManager::Get().Delete(*SnapshotPath);
+	IFileManager::Get().Delete(*CorruptPath);
+	DiscardTestWidgetBlueprint(Source);
+	DiscardTestWidgetBlueprint(Target);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
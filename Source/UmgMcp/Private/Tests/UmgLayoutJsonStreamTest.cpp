@@ -0,0 +1,90 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "FileManage/UmgLayoutJsonStream.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUmgLayoutJsonStreamPreOrderTest,
+	"UmgMcp.FileManage.LayoutJsonStream.PreOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUmgLayoutJsonStreamPreOrderTest::RunTest(const FString& Parameters)
+{
+	const FString Layout = TEXT(R"({
+		"widget_name": "Root", "widget_class": "/Script/UMG.CanvasPanel", "extra": [1, {"a": 2}],
+		"properties": {"Visibility": "Visible"},
+		"children": [
+			{"widget_name": "Box", "widget_class": "/Script/UMG.VerticalBox", "children": [
+				{"widget_name": "Label", "widget_class": "/Script/UMG.TextBlock", "properties": {"Text": "Hi", "Size": [1, 2.5]}}
+			]},
+			"ignored",
+			{"widget_name": "Image", "widget_class": "/Script/UMG.Image"}
+		]
+	})");
+
+	FUmgLayoutJsonStream Stream(Layout, true);
+	TArray<FUmgStreamedWidget> Nodes;
+	FUmgStreamedWidget Node;
+	while (Stream.Next(Node))
+	{
+		Nodes.Add(Node);
+	}
+
+	TestFalse(TEXT("no error"), Stream.HasError());
+	TestFalse(TEXT("streams without a document"), Stream.NeedsDocument());
+	if (!TestEqual(TEXT("node count"), Nodes.Num(), 4))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("root first"), Nodes[0].Name, FString(TEXT("Root")));
+	TestEqual(TEXT("root depth"), Nodes[0].Depth, 0);
+	TestTrue(TEXT("root properties read"), Nodes[0].Properties.IsValid() && Nodes[0].Properties->HasField(TEXT("Visibility")));
+	TestEqual(TEXT("pre-order: Box"), Nodes[1].Name, FString(TEXT("Box")));
+	TestEqual(TEXT("Box parent"), Nodes[1].ParentName, FString(TEXT("Root")));
+	TestEqual(TEXT("pre-order: Label"), Nodes[2].Name, FString(TEXT("Label")));
+	TestEqual(TEXT("Label parent"), Nodes[2].ParentName, FString(TEXT("Box")));
+	TestEqual(TEXT("Label depth"), Nodes[2].Depth, 2);
+	TestEqual(TEXT("Label class"), Nodes[2].ClassPath, FString(TEXT("/Script/UMG.TextBlock")));
+	TestTrue(TEXT("Label array property"), Nodes[2].Properties.IsValid() && Nodes[2].Properties->GetArrayField(TEXT("Size")).Num() == 2);
+	TestEqual(TEXT("pre-order: Image"), Nodes[3].Name, FString(TEXT("Image")));
+	TestEqual(TEXT("Image parent"), Nodes[3].ParentName, FString(TEXT("Root")));
+	TestFalse(TEXT("absent properties stay null"), Nodes[3].Properties.IsValid());
+
+	FUmgLayoutJsonStream Scan(Layout, false);
+	TestTrue(TEXT("scan emits the root"), Scan.Next(Node));
+	TestFalse(TEXT("scan skips properties"), Node.Properties.IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUmgLayoutJsonStreamFallbackTest,
+	"UmgMcp.FileManage.LayoutJsonStream.FallbackAndErrors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUmgLayoutJsonStreamFallbackTest::RunTest(const FString& Parameters)
+{
+	FUmgStreamedWidget Node;
+
+	// Node fields after the children array cannot be streamed.
+	FUmgLayoutJsonStream Late(TEXT(R"({"widget_name": "Root", "children": [], "widget_class": "/Script/UMG.CanvasPanel"})"), true);
+	TestTrue(TEXT("root emitted when children start"), Late.Next(Node));
+	TestFalse(TEXT("late field stops the stream"), Late.Next(Node));
+	TestTrue(TEXT("late field asks for a document"), Late.NeedsDocument());
+	TestFalse(TEXT("late field is not an error"), Late.HasError());
+
+	FUmgLayoutJsonStream Truncated(TEXT(R"({"widget_name": "Root", "children": [{"widget_name": "A")"), false);
+	while (Truncated.Next(Node))
+	{
+	}
+	TestEqual(TEXT("truncated payload"), Truncated.GetErrorCode(), FString(TEXT("invalid_json")));
+
+	FUmgLayoutJsonStream NotObject(TEXT("[1, 2]"), false);
+	TestFalse(TEXT("array payload"), NotObject.Next(Node));
+	TestEqual(TEXT("array payload error"), NotObject.GetErrorCode(), FString(TEXT("invalid_json")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
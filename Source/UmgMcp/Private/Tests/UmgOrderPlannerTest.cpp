@@ -0,0 +1,73 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgOrderPlanner.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUmgOrderPlannerMinimalMovesTest,
+	"UmgMcp.Widget.OrderPlanner.MinimalMoves",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUmgOrderPlannerMinimalMovesTest::RunTest(const FString& Parameters)
+{
+	// Replays a plan the way FUmgOrderPlanner::ApplyOrder does with UPanelWidget::ShiftChild and returns the resulting order.
+	auto ApplyPlan = [](const TArray<int32>& FinalOrder, const TArray<int32>& MovedPositions)
+	{
+		TArray<int32> Panel;
+		for (int32 Element = 0; Element < FinalOrder.Num(); ++Element)
+		{
+			Panel.Add(Element);
+		}
+
+		for (const int32 Position : MovedPositions)
+		{
+			const int32 Element = FinalOrder[Position];
+			const int32 CurrentIndex = Panel.IndexOfByKey(Element);
+			int32 TargetIndex = Panel.Num() - 1;
+			if (FinalOrder.IsValidIndex(Position + 1))
+			{
+				const int32 AnchorIndex = Panel.IndexOfByKey(FinalOrder[Position + 1]);
+				TargetIndex = CurrentIndex < AnchorIndex ? AnchorIndex - 1 : AnchorIndex;
+			}
+			Panel.RemoveAt(CurrentIndex);
+			Panel.Insert(Element, TargetIndex);
+		}
+		return Panel;
+	};
+
+	// Elements are named by their current index, so FinalOrder doubles as the CurrentIndices input.
+	TArray<int32> MovedPositions;
+
+	const TArray<int32> Unchanged = { 0, 1, 2, 3, 4 };
+	FUmgOrderPlanner::PlanMoves(Unchanged, MovedPositions);
+	TestEqual(TEXT("identity order needs no moves"), MovedPositions.Num(), 0);
+
+	const TArray<int32> Reversed = { 4, 3, 2, 1, 0 };
+	FUmgOrderPlanner::PlanMoves(Reversed, MovedPositions);
+	TestEqual(TEXT("reversal keeps exactly one element"), MovedPositions.Num(), 4);
+	TestTrue(TEXT("reversal reaches the requested order"), ApplyPlan(Reversed, MovedPositions) == Reversed);
+
+	// A 500-item list where two items swapped places and one item moved to the front.
+	TArray<int32> Large;
+	for (int32 Element = 0; Element < 500; ++Element)
+	{
+		Large.Add(Element);
+	}
+	Large.Swap(100, 200);
+	Large.RemoveAt(Large.IndexOfByKey(499));
+	Large.Insert(499, 0);
+
+	FUmgOrderPlanner::PlanMoves(Large, MovedPositions);
+	TestEqual(TEXT("large list only moves the changed items"), MovedPositions.Num(), 3);
+	TestTrue(TEXT("large list reaches the requested order"), ApplyPlan(Large, MovedPositions) == Large);
+
+	TBitArray<> InSequence;
+	const TArray<int32> Values = { 3, 1, 4, 1, 5, 9, 2, 6 };
+	FUmgOrderPlanner::MarkLongestIncreasingSubsequence(Values, InSequence);
+	TestEqual(TEXT("longest increasing subsequence length"), InSequence.CountSetBits(), 4);
+
+	return true;
+}
+
+#endif
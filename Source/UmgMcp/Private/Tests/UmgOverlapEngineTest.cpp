@@ -0,0 +1,70 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgOverlapEngine.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUmgOverlapEngineSweepTest,
+	"UmgMcp.Widget.OverlapEngine.SweepAndPrune",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUmgOverlapEngineSweepTest::RunTest(const FString& Parameters)
+{
+	auto MakeItem = [](float Left, float Top, float Right, float Bottom, int32 Enter, int32 Exit)
+	{
+		FUmgOverlapItem Item;
+		Item.Rect = FSlateRect(Left, Top, Right, Bottom);
+		Item.TreeEnter = Enter;
+		Item.TreeExit = Exit;
+		return Item;
+	};
+
+	const TArray<FUmgOverlapItem> Items = {
+		MakeItem(0.f, 0.f, 100.f, 100.f, 0, 4),     // 0: panel containing 1..3
+		MakeItem(10.f, 10.f, 50.f, 50.f, 1, 1),     // 1
+		MakeItem(40.f, 40.f, 60.f, 60.f, 2, 2),     // 2: overlaps 1 by 10x10
+		MakeItem(50.f, 0.f, 70.f, 10.f, 3, 3),      // 3: touches 1 only at a corner
+		MakeItem(90.f, 90.f, 120.f, 120.f, 5, 5),   // 4: sibling of 0, overlaps it by 10x10
+		MakeItem(200.f, 200.f, 200.f, 260.f, 6, 6)  // 5: empty rect
+	};
+
+	TArray<FUmgOverlapPair> Pairs;
+	FUmgOverlapEngine::FindOverlaps(Items, Pairs);
+
+	TestEqual(TEXT("only sibling overlaps are reported"), Pairs.Num(), 2);
+	TestTrue(TEXT("ancestor containment is ignored"), FUmgOverlapEngine::AreTreeRelated(Items[0], Items[2]));
+	TestFalse(TEXT("siblings are not tree related"), FUmgOverlapEngine::AreTreeRelated(Items[1], Items[2]));
+
+	const bool bHasInnerPair = Pairs.ContainsByPredicate([](const FUmgOverlapPair& Pair)
+	{
+		return Pair.A == 1 && Pair.B == 2 && FMath::IsNearlyEqual(Pair.Area, 100.0);
+	});
+	const bool bHasOuterPair = Pairs.ContainsByPredicate([](const FUmgOverlapPair& Pair)
+	{
+		return Pair.A == 0 && Pair.B == 4 && FMath::IsNearlyEqual(Pair.Area, 100.0);
+	});
+	TestTrue(TEXT("overlapping siblings reported with area"), bHasInnerPair);
+	TestTrue(TEXT("overlap with a non-descendant panel reported"), bHasOuterPair);
+
+	// A dense grid exercises active-list pruning: each cell overlaps only its right and bottom neighbours.
+	TArray<FUmgOverlapItem> Grid;
+	const int32 GridSize = 40;
+	for (int32 Row = 0; Row < GridSize; ++Row)
+	{
+		for (int32 Column = 0; Column < GridSize; ++Column)
+		{
+			const int32 Id = Row * GridSize + Column;
+			Grid.Add(MakeItem(Column * 10.f, Row * 10.f, Column * 10.f + 12.f, Row * 10.f + 12.f, Id, Id));
+		}
+	}
+
+	FUmgOverlapEngine::FindOverlaps(Grid, Pairs);
+	const int32 AxisPairs = 2 * GridSize * (GridSize - 1);
+	const int32 DiagonalPairs = 2 * (GridSize - 1) * (GridSize - 1);
+	TestEqual(TEXT("grid pair count"), Pairs.Num(), AxisPairs + DiagonalPairs);
+	TestTrue(TEXT("largest intersection first"), Pairs.Num() > 1 && Pairs[0].Area >= Pairs.Last().Area);
+	return true;
+}
+
+#endif
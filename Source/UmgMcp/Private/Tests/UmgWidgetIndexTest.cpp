@@ -0,0 +1,60 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgWidgetIndex.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanel.h"
+#include "Components/TextBlock.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/AutomationTest.h"
+#include "WidgetBlueprint.h"
+#include "WidgetBlueprintGeneratedClass.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUmgWidgetIndexUnnotifiedEditTest,
+	"UmgMcp.Widget.WidgetIndex.UnnotifiedEditBumpsRevision",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUmgWidgetIndexUnnotifiedEditTest::RunTest(const FString& Parameters)
+{
+	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(FKismetEditorUtilities::CreateBlueprint(
+		UUserWidget::StaticClass(),
+		GetTransientPackage(),
+		MakeUniqueObjectName(GetTransientPackage(), UWidgetBlueprint::StaticClass(), TEXT("WidgetIndexTest")),
+		BPTYPE_Normal,
+		UWidgetBlueprint::StaticClass(),
+		UWidgetBlueprintGeneratedClass::StaticClass()));
+	if (!TestNotNull(TEXT("widget blueprint"), WidgetBlueprint))
+	{
+		return false;
+	}
+
+	UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+	UCanvasPanel* Canvas = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("Panel"));
+	WidgetTree->RootWidget = Canvas;
+	UTextBlock* Label = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("Label"));
+	Canvas->AddChild(Label);
+
+	FUmgWidgetIndexCache& Cache = FUmgWidgetIndexCache::Get();
+	Cache.Invalidate(WidgetBlueprint);
+	TestTrue(TEXT("label indexed"), Cache.FindWidget(WidgetBlueprint, FName(TEXT("Label"))) == Label);
+	const int64 InitialRevision = Cache.GetRevision(WidgetBlueprint);
+
+	// Added behind the cache's back: the miss is confirmed against the tree and the rebuild is a new revision.
+	UTextBlock* Late = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("Late"));
+	Canvas->AddChild(Late);
+	TestTrue(TEXT("unnotified widget found"), Cache.FindWidget(WidgetBlueprint, FName(TEXT("Late"))) == Late);
+	const int64 AfterAddRevision = Cache.GetRevision(WidgetBlueprint);
+	TestTrue(TEXT("revision advances after a confirmed miss"), AfterAddRevision > InitialRevision);
+
+	// Renamed behind the cache's back: the stale hit is rejected and the rebuild is a new revision.
+	Label->Rename(TEXT("Caption"), WidgetTree);
+	TestNull(TEXT("old name no longer resolves"), Cache.FindWidget(WidgetBlueprint, FName(TEXT("Label"))));
+	TestTrue(TEXT("revision advances after a stale hit"), Cache.GetRevision(WidgetBlueprint) > AfterAddRevision);
+	TestTrue(TEXT("new name resolves"), Cache.FindWidget(WidgetBlueprint, FName(TEXT("Caption"))) == Label);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,266 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgAssetPreloader.h"
+#include "Widget/UmgSetSubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    static void AddObjectPath(FStringView Candidate, TArray<FSoftObjectPath>& OutPaths)
+    {
+        Candidate.TrimStartAndEndInline();
+        if (Candidate.Len() < 3 || Candidate.Len() > FName::StringBufferSize || Candidate[0] != TEXT('/') || Candidate.StartsWith(TEXT("/Script/")))
+        {
+            return;
+        }
+
+        int32 DotIndex = INDEX_NONE;
+        Candidate.FindChar(TEXT('.'), DotIndex);
+        const FString PackageName(DotIndex == INDEX_NONE ? Candidate : Candidate.Left(DotIndex));
+        if (!FPackageName::IsValidLongPackageName(PackageName))
+        {
+            return;
+        }
+
+        FString ObjectPath(Candidate);
+        if (DotIndex == INDEX_NONE)
+        {
+            ObjectPath = FString::Printf(TEXT("%s.%s"), *PackageName, *FPackageName::GetShortName(PackageName));
+        }
+        OutPaths.AddUnique(FSoftObjectPath(ObjectPath));
+    }
+
+    // Layout commands carry their widget tree as a JSON string; pick quoted paths out of it without a second parse.
+    static void ScanEmbeddedJson(const FString& Text, TArray<FSoftObjectPath>& OutPaths)
+    {
+        int32 Index = 0;
+        while ((Index = Text.Find(TEXT("\"/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index)) != INDEX_NONE)
+        {
+            const int32 Start = Index + 1;
+            const int32 End = Text.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+            if (End == INDEX_NONE)
+            {
+                return;
+            }
+            AddObjectPath(FStringView(*Text + Start, End - Start), OutPaths);
+            Index = End + 1;
+        }
+    }
+}
+
+FUmgAssetPreloader& FUmgAssetPreloader::Get()
+{
+    static FUmgAssetPreloader Instance;
+    return Instance;
+}
+
+void FUmgAssetPreloader::CollectObjectPaths(const TSharedPtr<FJsonValue>& Value, TArray<FSoftObjectPath>& OutPaths)
+{
+    if (!Value.IsValid())
+    {
+        return;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::String:
+    {
+        const FString& Text = Value->AsString();
+        if (Text.StartsWith(TEXT("/")))
+        {
+            AddObjectPath(Text, OutPaths);
+        }
+        else if (Text.StartsWith(TEXT("{")) || Text.StartsWith(TEXT("[")))
+        {
+            ScanEmbeddedJson(Text, OutPaths);
+        }
+        break;
+    }
+    case EJson::Array:
+        for (const TSharedPtr<FJsonValue>& Item : Value->AsArray())
+        {
+            CollectObjectPaths(Item, OutPaths);
+        }
+        break;
+    case EJson::Object:
+        if (const TSharedPtr<FJsonObject>& Object = Value->AsObject())
+        {
+            for (const auto& Pair : Object->Values)
+            {
+                CollectObjectPaths(Pair.Value, OutPaths);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+bool FUmgAssetPreloader::PreloadCommandAssets(const TSharedPtr<FJsonObject>& Params, TFunction<void()>&& OnReady)
+{
+    check(IsInGameThread());
+    if (!Params.IsValid() || !UAssetManager::IsInitialized())
+    {
+        return false;
+    }
+
+    // The queue runs one command at a time, so handles from earlier commands are no longer needed once they completed.
+    PendingHandles.RemoveAll([](const TSharedPtr<FStreamableHandle>& Handle)
+    {
+        return !Handle.IsValid() || Handle->HasLoadCompleted() || Handle->WasCanceled();
+    });
+
+    TArray<FSoftObjectPath> Paths;
+    CollectObjectPaths(MakeShared<FJsonValueObject>(Params), Paths);
+    if (Paths.Num() == 0)
+    {
+        return false;
+    }
+
+    FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    TArray<FSoftObjectPath> ToLoad;
+    for (const FSoftObjectPath& Path : Paths)
+    {
+        if (const TWeakObjectPtr<UObject>* Cached = ResolvedPaths.Find(Path); Cached && Cached->IsValid())
+        {
+            continue;
+        }
+        if (UObject* Loaded = Path.ResolveObject())
+        {
+            CacheResolved(Path, Loaded);
+            continue;
+        }
+
+        // Only stream assets the registry knows about; misspelled paths are reported by the property writers as before.
+        if (AssetRegistryModule && AssetRegistryModule->Get().GetAssetByObjectPath(Path).IsValid())
+        {
+            ToLoad.Add(Path);
+        }
+    }
+
+    if (ToLoad.Num() == 0)
+    {
+        return false;
+    }
+
+    // Completion and cancellation share one callback, so the waiting command runs exactly once either way; after a
+    // cancel the property writers fall back to synchronous loads for whatever did not arrive.
+    TSharedRef<bool> bNotified = MakeShared<bool>(false);
+    TFunction<void()> NotifyReady = [this, Requested = ToLoad, OnReady = MoveTemp(OnReady), bNotified]()
+    {
+        if (*bNotified)
+        {
+            return;
+        }
+        *bNotified = true;
+
+        for (const FSoftObjectPath& Path : Requested)
+        {
+            if (UObject* Loaded = Path.ResolveObject())
+            {
+                CacheResolved(Path, Loaded);
+            }
+        }
+        OnReady();
+    };
+    TSharedRef<TFunction<void()>> SharedNotify = MakeShared<TFunction<void()>>(MoveTemp(NotifyReady));
+
+    TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        MoveTemp(ToLoad),
+        FStreamableDelegate::CreateLambda([SharedNotify]() { (*SharedNotify)(); }),
+        FStreamableManager::AsyncLoadHighPriority);
+
+    if (!Handle.IsValid())
+    {
+        UE_LOG(LogUmgSet, Warning, TEXT("FUmgAssetPreloader: Async load request failed; assets will be loaded synchronously."));
+        return false;
+    }
+
+    // The delegate can fire inside RequestAsyncLoad when every package is already in flight or resident.
+    if (!Handle->HasLoadCompleted())
+    {
+        Handle->BindCancelDelegate(FStreamableDelegate::CreateLambda([SharedNotify]() { (*SharedNotify)(); }));
+        PendingHandles.Add(Handle);
+
+        // A load that never finishes would hold the command queue forever; give up on it and let the command run.
+        TWeakPtr<FStreamableHandle> WeakHandle = Handle;
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakHandle](float DeltaTime)
+        {
+            const TSharedPtr<FStreamableHandle> PendingHandle = WeakHandle.Pin();
+            if (PendingHandle.IsValid() && PendingHandle->IsLoadingInProgress())
+            {
+                UE_LOG(LogUmgSet, Warning, TEXT("FUmgAssetPreloader: Preload timed out after %.0f s; the command runs with synchronous loads."), PreloadTimeoutSeconds);
+                PendingHandle->CancelHandle();
+            }
+            return false;
+        }), PreloadTimeoutSeconds);
+    }
+    return true;
+}
+
+UObject* FUmgAssetPreloader::ResolveObjectPath(const FString& ObjectPath)
+{
+    if (!IsInGameThread() || !ObjectPath.StartsWith(TEXT("/")))
+    {
+        return LoadObject<UObject>(nullptr, *ObjectPath);
+    }
+
+    // Bare package paths are cached under Package.AssetName, the form the preload pass requests.
+    FString FullPath = ObjectPath;
+    if (!FPackageName::GetShortName(FullPath).Contains(TEXT(".")))
+    {
+        FullPath = FString::Printf(TEXT("%s.%s"), *ObjectPath, *FPackageName::GetShortName(ObjectPath));
+    }
+
+    const FSoftObjectPath Path(FullPath);
+    if (const TWeakObjectPtr<UObject>* Cached = ResolvedPaths.Find(Path))
+    {
+        if (UObject* Object = Cached->Get())
+        {
+            return Object;
+        }
+    }
+
+    UObject* Resolved = Path.ResolveObject();
+    if (!Resolved)
+    {
+        Resolved = LoadObject<UObject>(nullptr, *ObjectPath);
+    }
+    if (Resolved)
+    {
+        CacheResolved(Path, Resolved);
+    }
+    return Resolved;
+}
+
+void FUmgAssetPreloader::CacheResolved(const FSoftObjectPath& Path, UObject* Object)
+{
+    if (ResolvedPaths.Num() >= MaxCachedPaths && !ResolvedPaths.Contains(Path))
+    {
+        ResolvedPaths.Reset();
+    }
+    ResolvedPaths.Add(Path, Object);
+}
+
+void FUmgAssetPreloader::Reset()
+{
+    // Canceling fires each handle's cancel delegate, so a command still waiting on a load runs (or is dropped by a
+    // stopped bridge) instead of hanging.
+    TArray<TSharedPtr<FStreamableHandle>> Handles = MoveTemp(PendingHandles);
+    for (const TSharedPtr<FStreamableHandle>& Handle : Handles)
+    {
+        if (Handle.IsValid() && Handle->IsLoadingInProgress())
+        {
+            Handle->CancelHandle();
+        }
+    }
+    ResolvedPaths.Reset();
+}
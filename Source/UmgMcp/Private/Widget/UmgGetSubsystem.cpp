@@ -11,6 +11,12 @@
 #include "Components/PanelSlot.h"
 #include "Components/CanvasPanelSlot.h"
 #include "FileManage/UmgFileTransformation.h"
+#include "Widget/UmgPropertyPathCache.h"
+#include "Widget/UmgWidgetIndex.h"
+#include "Widget/UmgOverlapEngine.h"
+#include "Widget/UmgOrderPlanner.h"
+#include "Widget/UmgHeadlessLayout.h"
+#include "Widget/UmgWidgetSchemaIndex.h"
 #include "JsonObjectConverter.h"
 #include "Serialization/JsonWriter.h"
 #include "Dom/JsonObject.h"
@@ -178,6 +184,11 @@ namespace
 
         return false;
     }
+
+    // Revisions an agent can still diff against with since_revision.
+    static constexpr int32 MaxRetainedTreeSnapshots = 8;
+    // Distinct (start widget, options) trees kept per blueprint revision.
+    static constexpr int32 MaxCachedTreesPerBlueprint = 16;
 }
 
 // --- Helper function for recursive JSON export ---
@@ -288,42 +299,76 @@ static TSharedPtr<FJsonObject> ExportWidgetToJson(UWidget* Widget)
 void UUmgGetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	FUmgWidgetSchemaIndex::Get().Start();
 	UE_LOG(LogUmgGet, Warning, TEXT("UmgGetSubsystem Initialized."));
 }
 
 void UUmgGetSubsystem::Deinitialize()
 {
+	TreeCaches.Reset();
+	FUmgWidgetSchemaIndex::Get().Stop();
 	UE_LOG(LogUmgGet, Log, TEXT("UmgGetSubsystem Deinitialized."));
 	Super::Deinitialize();
 }
 
-static void BuildBStyleWidgetTree(UWidget* Widget, int32 Depth, FString& OutTreeString)
+// Appends one page of the compact tree view. Traversal is pre-order; Offset nodes are walked but not printed so a
+// cursor can resume exactly where the previous page stopped.
+static void BuildBStyleWidgetTree(UWidget* StartWidget, const FUmgWidgetTreeReadOptions& Options, int32 Offset, FStringBuilderBase& OutTree, FUmgWidgetTreePage& OutPage, int32& OutStopOffset)
 {
-    if (!Widget)
-    {
-        return;
-    }
+    OutStopOffset = INDEX_NONE;
 
-    FString WidgetName = Widget->GetName();
-    FString WidgetClass = Widget->GetClass()->GetName();
+    TArray<TPair<UWidget*, int32>, TInlineAllocator<64>> Stack;
+    Stack.Emplace(StartWidget, 1);
+    int32 Visited = 0;
 
-    if (Depth == 1)
-    {
-        OutTreeString += FString::Printf(TEXT("  %s [%s]\n"), *WidgetName, *WidgetClass);
-    }
-    else if (Depth >= 2)
+    while (Stack.Num() > 0)
     {
-        FString Indent = FString::ChrN(Depth * 2, ' ');
-        OutTreeString += FString::Printf(TEXT("%s- %s [%s]\n"), *Indent, *WidgetName, *WidgetClass);
-    }
+        const TPair<UWidget*, int32> Entry = Stack.Pop(EAllowShrinking::No);
+        UWidget* Widget = Entry.Key;
+        const int32 Depth = Entry.Value;
 
-    if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
-    {
-        for (int32 i = 0; i < PanelWidget->GetChildrenCount(); ++i)
+        if (Visited >= Offset && Options.MaxNodes > 0 && OutPage.NodeCount >= Options.MaxNodes)
         {
-            if (UWidget* ChildWidget = PanelWidget->GetChildAt(i))
+            OutStopOffset = Visited;
+            return;
+        }
+
+        UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget);
+        const int32 ChildCount = PanelWidget ? PanelWidget->GetChildrenCount() : 0;
+        const bool bCollapsed = Options.MaxDepth > 0 && Depth >= Options.MaxDepth && ChildCount > 0;
+
+        if (Visited >= Offset)
+        {
+            for (int32 Indent = 0; Indent < Depth * 2; ++Indent)
             {
-                BuildBStyleWidgetTree(ChildWidget, Depth + 1, OutTreeString);
+                OutTree.AppendChar(TEXT(' '));
+            }
+            if (Depth >= 2)
+            {
+                OutTree << TEXT("- ");
+            }
+            Widget->GetFName().AppendString(OutTree);
+            OutTree << TEXT(" [");
+            Widget->GetClass()->GetFName().AppendString(OutTree);
+            OutTree << TEXT("]");
+            if (bCollapsed)
+            {
+                OutTree.Appendf(TEXT(" (+%d children)"), ChildCount);
+                ++OutPage.CollapsedSubtrees;
+            }
+            OutTree << TEXT("\n");
+            ++OutPage.NodeCount;
+        }
+        ++Visited;
+
+        if (!bCollapsed)
+        {
+            for (int32 ChildIndex = ChildCount - 1; ChildIndex >= 0; --ChildIndex)
+            {
+                if (UWidget* ChildWidget = PanelWidget->GetChildAt(ChildIndex))
+                {
+                    Stack.Emplace(ChildWidget, Depth + 1);
+                }
             }
         }
     }
@@ -331,32 +376,43 @@ static void BuildBStyleWidgetTree(UWidget* Widget, int32 Depth, FString& OutTree
 
 FString UUmgGetSubsystem::GetWidgetTree(UWidgetBlueprint* WidgetBlueprint, const FString& StartWidgetName)
 {
+    FUmgWidgetTreePage Page;
+    FString Error;
+    GetWidgetTreePage(WidgetBlueprint, StartWidgetName, FUmgWidgetTreeReadOptions(), Page, Error);
+    return Page.Tree;
+}
+
+bool UUmgGetSubsystem::GetWidgetTreePage(UWidgetBlueprint* WidgetBlueprint, const FString& StartWidgetName, const FUmgWidgetTreeReadOptions& Options, FUmgWidgetTreePage& OutPage, FString& OutError)
+{
+    OutPage = FUmgWidgetTreePage();
+    OutError.Reset();
+
     if (!WidgetBlueprint)
     {
         UE_LOG(LogUmgGet, Error, TEXT("GetWidgetTree: Received a null WidgetBlueprint."));
-        return FString();
+        OutError = TEXT("Received a null WidgetBlueprint.");
+        return false;
     }
     
-    FString TreeString;
     FString BlueprintName = WidgetBlueprint->GetName();
-    TreeString += FString::Printf(TEXT("%s [WidgetBlueprint]\n"), *BlueprintName);
+    OutPage.Tree = FString::Printf(TEXT("%s [WidgetBlueprint]\n"), *BlueprintName);
 
     if (!WidgetBlueprint->WidgetTree)
     {
         UE_LOG(LogUmgGet, Error, TEXT("GetWidgetTree: WidgetTree is null in UWidgetBlueprint '%s'."), *WidgetBlueprint->GetPathName());
-        return TreeString;
+        return true;
     }
 
     UWidget* StartWidget = WidgetBlueprint->WidgetTree->RootWidget;
     if (!StartWidget)
     {
         UE_LOG(LogUmgGet, Warning, TEXT("GetWidgetTree: Root widget not found in UWidgetBlueprint '%s'. The UMG asset might be empty."), *WidgetBlueprint->GetPathName());
-        return TreeString;
+        return true;
     }
 
     if (!StartWidgetName.IsEmpty())
     {
-        if (UWidget* ScopedWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*StartWidgetName)))
+        if (UWidget* ScopedWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, StartWidgetName))
         {
             StartWidget = ScopedWidget;
         }
@@ -366,10 +422,269 @@ FString UUmgGetSubsystem::GetWidgetTree(UWidgetBlueprint* WidgetBlueprint, const
         }
     }
 
+    const int64 Revision = FUmgWidgetIndexCache::Get().GetRevision(WidgetBlueprint);
+    const FString StartName = StartWidget->GetName();
+
+    // Cursor format: "<revision>:<offset>:<max depth>:<start widget>". Offsets are only meaningful for the exact
+    // traversal that produced them, so every part must match.
+    int32 Offset = 0;
+    if (!Options.Cursor.IsEmpty())
+    {
+        TArray<FString> CursorParts;
+        Options.Cursor.ParseIntoArray(CursorParts, TEXT(":"), false);
+        if (CursorParts.Num() < 4 || !CursorParts[0].IsNumeric() || !CursorParts[1].IsNumeric() || !CursorParts[2].IsNumeric())
+        {
+            OutError = FString::Printf(TEXT("Malformed cursor '%s'."), *Options.Cursor);
+            return false;
+        }
+
+        const FString CursorStart = FString::Join(TArrayView<const FString>(CursorParts).RightChop(3), TEXT(":"));
+        if (FCString::Atoi64(*CursorParts[0]) != Revision || FCString::Atoi(*CursorParts[2]) != Options.MaxDepth || CursorStart != StartName)
+        {
+            OutError = TEXT("Cursor was issued for a different tree revision, start widget or max_depth. Restart the read without a cursor.");
+            return false;
+        }
+
+        Offset = FMath::Max(0, FCString::Atoi(*CursorParts[1]));
+        // Continuation pages carry widget lines only.
+        OutPage.Tree.Reset();
+    }
+
+    // Agents poll the tree between edits; serve the page built for this structural revision when nothing changed.
+    FBlueprintTreeCache& Cache = GetTreeCache(WidgetBlueprint, Revision);
+    const FString CacheKey = FString::Printf(TEXT("%s|%s|%d|%d|%d"), *BlueprintName, *StartName, Options.MaxDepth, Options.MaxNodes, Offset);
+    if (const FUmgWidgetTreePage* CachedPage = Cache.TreesByKey.Find(CacheKey))
+    {
+        OutPage = *CachedPage;
+        return true;
+    }
+
     // Return a compact tree view from the focused widget target downward.
     // If no widget target is focused, StartWidget is the UMG root.
-    BuildBStyleWidgetTree(StartWidget, 1, TreeString);
-    return TreeString;
+    TStringBuilder<4096> TreeBuilder;
+    TreeBuilder << OutPage.Tree;
+    int32 StopOffset = INDEX_NONE;
+    BuildBStyleWidgetTree(StartWidget, Options, Offset, TreeBuilder, OutPage, StopOffset);
+    OutPage.Tree = TreeBuilder.ToString();
+    if (StopOffset != INDEX_NONE)
+    {
+        OutPage.NextCursor = FString::Printf(TEXT("%lld:%d:%d:%s"), Revision, StopOffset, Options.MaxDepth, *StartName);
+    }
+
+    if (Cache.TreesByKey.Num() >= MaxCachedTreesPerBlueprint)
+    {
+        Cache.TreesByKey.Reset();
+    }
+    Cache.TreesByKey.Add(CacheKey, OutPage);
+    return true;
+}
+
+UUmgGetSubsystem::FBlueprintTreeCache& UUmgGetSubsystem::GetTreeCache(UWidgetBlueprint* WidgetBlueprint, int64 Revision)
+{
+    FBlueprintTreeCache* Cache = TreeCaches.Find(WidgetBlueprint);
+    if (!Cache)
+    {
+        for (auto It = TreeCaches.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().ResolveObjectPtr())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        Cache = &TreeCaches.Add(WidgetBlueprint);
+    }
+
+    if (Cache->Revision != Revision)
+    {
+        Cache->Revision = Revision;
+        Cache->TreesByKey.Reset();
+    }
+    return *Cache;
+}
+
+int64 UUmgGetSubsystem::GetWidgetTreeRevision(UWidgetBlueprint* WidgetBlueprint)
+{
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        return 0;
+    }
+
+    FUmgWidgetIndexCache& WidgetIndex = FUmgWidgetIndexCache::Get();
+    const int64 Revision = WidgetIndex.GetRevision(WidgetBlueprint);
+    FBlueprintTreeCache& Cache = GetTreeCache(WidgetBlueprint, Revision);
+    if (Cache.Snapshots.ContainsByPredicate([Revision](const FTreeSnapshot& Snapshot) { return Snapshot.Revision == Revision; }))
+    {
+        return Revision;
+    }
+
+    if (Cache.Snapshots.Num() >= MaxRetainedTreeSnapshots)
+    {
+        Cache.Snapshots.RemoveAt(0);
+    }
+
+    FTreeSnapshot& Snapshot = Cache.Snapshots.AddDefaulted_GetRef();
+    Snapshot.Revision = Revision;
+
+    TArray<UWidget*> AllWidgets;
+    WidgetIndex.GetAllWidgets(WidgetBlueprint, AllWidgets);
+    Snapshot.Nodes.Reserve(AllWidgets.Num());
+
+    TMap<UWidget*, int32> NodeIndexByWidget;
+    NodeIndexByWidget.Reserve(AllWidgets.Num());
+    for (UWidget* Widget : AllWidgets)
+    {
+        NodeIndexByWidget.Add(Widget, Snapshot.Nodes.Num());
+        FTreeSnapshotNode& Node = Snapshot.Nodes.AddDefaulted_GetRef();
+        Node.Widget = FObjectKey(Widget);
+        Node.Name = Widget->GetFName();
+        Node.ClassName = Widget->GetClass()->GetFName();
+    }
+
+    TArray<UWidget*> Children;
+    for (UWidget* Widget : AllWidgets)
+    {
+        if (!WidgetIndex.GetChildren(WidgetBlueprint, Widget, Children))
+        {
+            continue;
+        }
+
+        for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+        {
+            if (const int32* NodeIndex = NodeIndexByWidget.Find(Children[ChildIndex]))
+            {
+                Snapshot.Nodes[*NodeIndex].Parent = FObjectKey(Widget);
+                Snapshot.Nodes[*NodeIndex].ChildIndex = ChildIndex;
+            }
+        }
+    }
+
+    return Revision;
+}
+
+bool UUmgGetSubsystem::GetWidgetTreeDelta(UWidgetBlueprint* WidgetBlueprint, int64 SinceRevision, TSharedPtr<FJsonObject>& OutDelta)
+{
+    OutDelta.Reset();
+
+    const int64 CurrentRevision = GetWidgetTreeRevision(WidgetBlueprint);
+    const FBlueprintTreeCache* Cache = CurrentRevision != 0 ? TreeCaches.Find(WidgetBlueprint) : nullptr;
+    if (!Cache)
+    {
+        return false;
+    }
+
+    const FTreeSnapshot* OldSnapshot = Cache->Snapshots.FindByPredicate([SinceRevision](const FTreeSnapshot& Snapshot) { return Snapshot.Revision == SinceRevision; });
+    const FTreeSnapshot* NewSnapshot = Cache->Snapshots.FindByPredicate([CurrentRevision](const FTreeSnapshot& Snapshot) { return Snapshot.Revision == CurrentRevision; });
+    if (!OldSnapshot || !NewSnapshot)
+    {
+        return false;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Inserted;
+    TArray<TSharedPtr<FJsonValue>> Removed;
+    TArray<TSharedPtr<FJsonValue>> Moved;
+    TArray<TSharedPtr<FJsonValue>> Renamed;
+
+    if (OldSnapshot != NewSnapshot)
+    {
+        TMap<FObjectKey, const FTreeSnapshotNode*> OldByWidget;
+        OldByWidget.Reserve(OldSnapshot->Nodes.Num());
+        for (const FTreeSnapshotNode& Node : OldSnapshot->Nodes)
+        {
+            OldByWidget.Add(Node.Widget, &Node);
+        }
+
+        TMap<FObjectKey, const FTreeSnapshotNode*> NewByWidget;
+        NewByWidget.Reserve(NewSnapshot->Nodes.Num());
+        for (const FTreeSnapshotNode& Node : NewSnapshot->Nodes)
+        {
+            NewByWidget.Add(Node.Widget, &Node);
+        }
+
+        auto MakeNodeJson = [&NewByWidget](const FTreeSnapshotNode& Node)
+        {
+            TSharedPtr<FJsonObject> NodeJson = MakeShared<FJsonObject>();
+            NodeJson->SetStringField(TEXT("name"), Node.Name.ToString());
+            NodeJson->SetStringField(TEXT("class"), Node.ClassName.ToString());
+            const FTreeSnapshotNode* const* ParentNode = NewByWidget.Find(Node.Parent);
+            NodeJson->SetStringField(TEXT("parent"), ParentNode ? (*ParentNode)->Name.ToString() : FString());
+            NodeJson->SetNumberField(TEXT("index"), Node.ChildIndex);
+            return MakeShared<FJsonValueObject>(NodeJson);
+        };
+
+        for (const FTreeSnapshotNode& Node : OldSnapshot->Nodes)
+        {
+            if (!NewByWidget.Contains(Node.Widget))
+            {
+                Removed.Add(MakeShared<FJsonValueString>(Node.Name.ToString()));
+            }
+        }
+
+        // Children that stayed under the same parent, grouped so sibling reorders can be reduced to a minimal move set.
+        TMap<FObjectKey, TArray<TPair<const FTreeSnapshotNode*, const FTreeSnapshotNode*>>> StayedByParent;
+        for (const FTreeSnapshotNode& Node : NewSnapshot->Nodes)
+        {
+            const FTreeSnapshotNode* const* OldNode = OldByWidget.Find(Node.Widget);
+            if (!OldNode)
+            {
+                Inserted.Add(MakeNodeJson(Node));
+                continue;
+            }
+
+            if ((*OldNode)->Name != Node.Name)
+            {
+                TSharedPtr<FJsonObject> RenameJson = MakeShared<FJsonObject>();
+                RenameJson->SetStringField(TEXT("from"), (*OldNode)->Name.ToString());
+                RenameJson->SetStringField(TEXT("to"), Node.Name.ToString());
+                Renamed.Add(MakeShared<FJsonValueObject>(RenameJson));
+            }
+
+            if ((*OldNode)->Parent != Node.Parent)
+            {
+                Moved.Add(MakeNodeJson(Node));
+            }
+            else if (Node.ChildIndex != INDEX_NONE)
+            {
+                StayedByParent.FindOrAdd(Node.Parent).Emplace(*OldNode, &Node);
+            }
+        }
+
+        // Siblings whose old order is part of the longest increasing run kept their relative position; the rest moved.
+        TArray<int32> OldOrder;
+        TBitArray<> KeptOrder;
+        for (TPair<FObjectKey, TArray<TPair<const FTreeSnapshotNode*, const FTreeSnapshotNode*>>>& Pair : StayedByParent)
+        {
+            TArray<TPair<const FTreeSnapshotNode*, const FTreeSnapshotNode*>>& Siblings = Pair.Value;
+            Siblings.Sort([](const TPair<const FTreeSnapshotNode*, const FTreeSnapshotNode*>& A, const TPair<const FTreeSnapshotNode*, const FTreeSnapshotNode*>& B)
+            {
+                return A.Value->ChildIndex < B.Value->ChildIndex;
+            });
+
+            OldOrder.Reset(Siblings.Num());
+            for (const TPair<const FTreeSnapshotNode*, const FTreeSnapshotNode*>& Sibling : Siblings)
+            {
+                OldOrder.Add(Sibling.Key->ChildIndex);
+            }
+
+            FUmgOrderPlanner::MarkLongestIncreasingSubsequence(OldOrder, KeptOrder);
+            for (int32 Index = 0; Index < Siblings.Num(); ++Index)
+            {
+                if (!KeptOrder[Index])
+                {
+                    Moved.Add(MakeNodeJson(*Siblings[Index].Value));
+                }
+            }
+        }
+    }
+
+    OutDelta = MakeShared<FJsonObject>();
+    OutDelta->SetNumberField(TEXT("since_revision"), static_cast<double>(SinceRevision));
+    OutDelta->SetNumberField(TEXT("revision"), static_cast<double>(CurrentRevision));
+    OutDelta->SetBoolField(TEXT("unchanged"), Inserted.Num() == 0 && Removed.Num() == 0 && Moved.Num() == 0 && Renamed.Num() == 0);
+    OutDelta->SetArrayField(TEXT("inserted"), Inserted);
+    OutDelta->SetArrayField(TEXT("removed"), Removed);
+    OutDelta->SetArrayField(TEXT("moved"), Moved);
+    OutDelta->SetArrayField(TEXT("renamed"), Renamed);
+    return true;
 }
 
 FString UUmgGetSubsystem::QueryWidgetProperties(UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName, const TArray<FString>& Properties)
@@ -386,7 +701,7 @@ FString UUmgGetSubsystem::QueryWidgetProperties(UWidgetBlueprint* WidgetBlueprin
         return FString();
     }
 
-    UWidget* FoundWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName));
+    UWidget* FoundWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, WidgetName);
     if (!FoundWidget)
     {
         UE_LOG(LogUmgGet, Error, TEXT("QueryWidgetProperties: Failed to find widget '%s' in asset '%s'."), *WidgetName, *WidgetBlueprint->GetPathName());
@@ -477,7 +792,31 @@ FString UUmgGetSubsystem::QueryWidgetProperties(UWidgetBlueprint* WidgetBlueprin
             }
         }
 
-        // Traverse the path for properties or struct fields
+        // Compiled accessor: one cached (class, path) lookup, then a typed read at a fixed offset.
+        if (CurrentObject && PartIndex < Parts.Num())
+        {
+            TStringBuilder<128> RelativePath;
+            for (int32 Index = PartIndex; Index < Parts.Num(); ++Index)
+            {
+                if (Index > PartIndex)
+                {
+                    RelativePath.AppendChar(TEXT('.'));
+                }
+                RelativePath << Parts[Index];
+            }
+
+            const TSharedRef<const FUmgResolvedPropertyKey> CompiledPath = FUmgPropertyPathCache::Get().ResolveKey(CurrentObject->GetClass(), RelativePath.ToView());
+            if (CompiledPath->HasDirectAccess())
+            {
+                if (TSharedPtr<FJsonValue> CompiledValue = FUmgPropertyPathCache::ReadJsonValue(*CompiledPath, CurrentObject))
+                {
+                    PropertiesJson->SetField(PropPath, CompiledValue);
+                }
+                continue;
+            }
+        }
+
+        // Traverse the path for properties or struct fields (paths that cross object references)
         void* CurrentValuePtr = CurrentObject;
         UStruct* CurrentStruct = CurrentObject ? CurrentObject->GetClass() : nullptr;
         FProperty* LastProperty = nullptr;
@@ -561,75 +900,363 @@ FString UUmgGetSubsystem::GetLayoutData(UWidgetBlueprint* WidgetBlueprint, int32
         return FString();
     }
 
-    TArray<UWidget*> AllWidgets;
-    WidgetBlueprint->WidgetTree->GetAllWidgets(AllWidgets);
+    FUmgLayoutResolution Resolution;
+    Resolution.Width = ResolutionWidth;
+    Resolution.Height = ResolutionHeight;
 
+    TArray<FUmgLayoutResult> Results;
+    FString Error;
     TArray<TSharedPtr<FJsonValue>> LayoutDataArray;
+    if (EvaluateLayout(WidgetBlueprint, MakeArrayView(&Resolution, 1), Results, Error))
+    {
+        LayoutDataArray = LayoutResultToJson(WidgetBlueprint, Results[0]);
+    }
+    else
+    {
+        UE_LOG(LogUmgGet, Warning, TEXT("GetLayoutData: %s"), *Error);
+    }
+
+    FString JsonString;
+    TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
+    FJsonSerializer::Serialize(LayoutDataArray, JsonWriter);
+    JsonWriter->Close(); // Explicitly close
+    return JsonString;
+}
 
+bool UUmgGetSubsystem::EvaluateLayout(UWidgetBlueprint* WidgetBlueprint, TConstArrayView<FUmgLayoutResolution> Resolutions, TArray<FUmgLayoutResult>& OutResults, FString& OutError)
+{
+    if (FUmgHeadlessLayout::Evaluate(WidgetBlueprint, Resolutions, OutResults, OutError))
+    {
+        return true;
+    }
+
+    // Live designer widgets only exist at the designer's current size, so they can stand in for one resolution at most.
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree || Resolutions.Num() != 1)
+    {
+        return false;
+    }
+
+    TArray<UWidget*> AllWidgets;
+    FUmgWidgetIndexCache::Get().GetAllWidgets(WidgetBlueprint, AllWidgets);
+
+    FUmgLayoutResult Result;
+    Result.Resolution = Resolutions[0];
+    Result.bHeadless = false;
     for (UWidget* Widget : AllWidgets)
     {
         if (Widget && Widget->GetCachedWidget().IsValid())
         {
-            FGeometry WidgetGeometry = Widget->GetCachedWidget()->GetTickSpaceGeometry();
-            FSlateRect BoundingBox = WidgetGeometry.GetLayoutBoundingRect();
+            FUmgLayoutRect& LayoutRect = Result.Rects.AddDefaulted_GetRef();
+            LayoutRect.WidgetName = Widget->GetName();
+            LayoutRect.Rect = Widget->GetCachedWidget()->GetTickSpaceGeometry().GetLayoutBoundingRect();
+            LayoutRect.bVisible = Widget->GetCachedWidget()->GetVisibility().IsVisible();
+        }
+    }
+
+    if (Result.Rects.Num() == 0)
+    {
+        return false;
+    }
+
+    UE_LOG(LogUmgGet, Warning, TEXT("EvaluateLayout: Headless layout failed (%s); using designer geometry for '%s'."), *OutError, *WidgetBlueprint->GetPathName());
+    OutError.Reset();
+    OutResults.Reset();
+    OutResults.Add(MoveTemp(Result));
+    return true;
+}
+
+TArray<TSharedPtr<FJsonValue>> UUmgGetSubsystem::LayoutResultToJson(UWidgetBlueprint* WidgetBlueprint, const FUmgLayoutResult& Result)
+{
+    TArray<TSharedPtr<FJsonValue>> LayoutDataArray;
+    LayoutDataArray.Reserve(Result.Rects.Num());
+
+    // Widgets are reported with the object path of the asset's widget, not of the transient layout copy.
+    const FString TreePath = WidgetBlueprint && WidgetBlueprint->WidgetTree ? WidgetBlueprint->WidgetTree->GetPathName() : FString();
+    for (const FUmgLayoutRect& LayoutRect : Result.Rects)
+    {
+        TSharedPtr<FJsonObject> WidgetLayoutJson = MakeShared<FJsonObject>();
+        WidgetLayoutJson->SetStringField(TEXT("widget_id"), FString::Printf(TEXT("%s.%s"), *TreePath, *LayoutRect.WidgetName));
+        WidgetLayoutJson->SetStringField(TEXT("name"), LayoutRect.WidgetName);
+        WidgetLayoutJson->SetNumberField(TEXT("left"), LayoutRect.Rect.Left);
+        WidgetLayoutJson->SetNumberField(TEXT("top"), LayoutRect.Rect.Top);
+        WidgetLayoutJson->SetNumberField(TEXT("right"), LayoutRect.Rect.Right);
+        WidgetLayoutJson->SetNumberField(TEXT("bottom"), LayoutRect.Rect.Bottom);
+        if (!LayoutRect.bVisible)
+        {
+            WidgetLayoutJson->SetBoolField(TEXT("visible"), false);
+        }
+
+        LayoutDataArray.Add(MakeShared<FJsonValueObject>(WidgetLayoutJson));
+    }
+    return LayoutDataArray;
+}
+
+bool UUmgGetSubsystem::EvaluateLayoutSweep(UWidgetBlueprint* WidgetBlueprint, TConstArrayView<FUmgLayoutResolution> Samples, TSharedPtr<FJsonObject>& OutSweep, FString& OutError)
+{
+    OutSweep.Reset();
+    if (Samples.Num() == 0)
+    {
+        OutError = TEXT("layout_sweep needs at least one sample.");
+        return false;
+    }
+
+    // The designer fallback in EvaluateLayout only covers one size, which would make the sweep meaningless.
+    TArray<FUmgLayoutResult> Results;
+    if (!FUmgHeadlessLayout::Evaluate(WidgetBlueprint, Samples, Results, OutError))
+    {
+        return false;
+    }
 
-            TSharedPtr<FJsonObject> WidgetLayoutJson = MakeShared<FJsonObject>();
-            WidgetLayoutJson->SetStringField(TEXT("widget_id"), Widget->GetPathName());
-            WidgetLayoutJson->SetNumberField(TEXT("left"), BoundingBox.Left);
-            WidgetLayoutJson->SetNumberField(TEXT("top"), BoundingBox.Top);
-            WidgetLayoutJson->SetNumberField(TEXT("right"), BoundingBox.Right);
-            WidgetLayoutJson->SetNumberField(TEXT("bottom"), BoundingBox.Bottom);
+    const int32 SampleCount = Results.Num();
+    struct FWidgetColumns
+    {
+        FString Name;
+        TArray<TSharedPtr<FJsonValue>> Left;
+        TArray<TSharedPtr<FJsonValue>> Top;
+        TArray<TSharedPtr<FJsonValue>> Right;
+        TArray<TSharedPtr<FJsonValue>> Bottom;
+        TArray<TSharedPtr<FJsonValue>> HiddenIn;
+    };
+
+    // Columns are created in the order widgets are first arranged, which is tree pre-order.
+    TArray<FWidgetColumns> Columns;
+    TMap<FString, int32> ColumnByName;
+    const TSharedPtr<FJsonValue> NullValue = MakeShared<FJsonValueNull>();
+    auto MakeCoordinate = [](float Value)
+    {
+        return MakeShared<FJsonValueNumber>(FMath::RoundToDouble(Value * 100.0) / 100.0);
+    };
 
-            LayoutDataArray.Add(MakeShared<FJsonValueObject>(WidgetLayoutJson));
+    for (int32 SampleIndex = 0; SampleIndex < SampleCount; ++SampleIndex)
+    {
+        for (const FUmgLayoutRect& LayoutRect : Results[SampleIndex].Rects)
+        {
+            int32 ColumnIndex = INDEX_NONE;
+            if (const int32* Existing = ColumnByName.Find(LayoutRect.WidgetName))
+            {
+                ColumnIndex = *Existing;
+            }
+            else
+            {
+                ColumnIndex = Columns.AddDefaulted();
+                ColumnByName.Add(LayoutRect.WidgetName, ColumnIndex);
+                FWidgetColumns& NewColumns = Columns[ColumnIndex];
+                NewColumns.Name = LayoutRect.WidgetName;
+                NewColumns.Left.Init(NullValue, SampleCount);
+                NewColumns.Top.Init(NullValue, SampleCount);
+                NewColumns.Right.Init(NullValue, SampleCount);
+                NewColumns.Bottom.Init(NullValue, SampleCount);
+            }
+
+            FWidgetColumns& WidgetColumns = Columns[ColumnIndex];
+            WidgetColumns.Left[SampleIndex] = MakeCoordinate(LayoutRect.Rect.Left);
+            WidgetColumns.Top[SampleIndex] = MakeCoordinate(LayoutRect.Rect.Top);
+            WidgetColumns.Right[SampleIndex] = MakeCoordinate(LayoutRect.Rect.Right);
+            WidgetColumns.Bottom[SampleIndex] = MakeCoordinate(LayoutRect.Rect.Bottom);
+            if (!LayoutRect.bVisible)
+            {
+                WidgetColumns.HiddenIn.Add(MakeShared<FJsonValueNumber>(SampleIndex));
+            }
         }
     }
 
-    FString JsonString;
-    TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
-    FJsonSerializer::Serialize(LayoutDataArray, JsonWriter);
-    JsonWriter->Close(); // Explicitly close
-    return JsonString;
+    TArray<TSharedPtr<FJsonValue>> Widths;
+    TArray<TSharedPtr<FJsonValue>> Heights;
+    TArray<TSharedPtr<FJsonValue>> DpiScales;
+    for (const FUmgLayoutResult& Result : Results)
+    {
+        Widths.Add(MakeShared<FJsonValueNumber>(Result.Resolution.Width));
+        Heights.Add(MakeShared<FJsonValueNumber>(Result.Resolution.Height));
+        DpiScales.Add(MakeShared<FJsonValueNumber>(Result.Resolution.DpiScale));
+    }
+
+    TSharedPtr<FJsonObject> SamplesJson = MakeShared<FJsonObject>();
+    SamplesJson->SetArrayField(TEXT("width"), Widths);
+    SamplesJson->SetArrayField(TEXT("height"), Heights);
+    SamplesJson->SetArrayField(TEXT("dpi_scale"), DpiScales);
+
+    TArray<TSharedPtr<FJsonValue>> WidgetsJson;
+    WidgetsJson.Reserve(Columns.Num());
+    for (FWidgetColumns& WidgetColumns : Columns)
+    {
+        TSharedPtr<FJsonObject> WidgetJson = MakeShared<FJsonObject>();
+        WidgetJson->SetStringField(TEXT("name"), WidgetColumns.Name);
+        WidgetJson->SetArrayField(TEXT("left"), MoveTemp(WidgetColumns.Left));
+        WidgetJson->SetArrayField(TEXT("top"), MoveTemp(WidgetColumns.Top));
+        WidgetJson->SetArrayField(TEXT("right"), MoveTemp(WidgetColumns.Right));
+        WidgetJson->SetArrayField(TEXT("bottom"), MoveTemp(WidgetColumns.Bottom));
+        if (WidgetColumns.HiddenIn.Num() > 0)
+        {
+            WidgetJson->SetArrayField(TEXT("hidden_in"), MoveTemp(WidgetColumns.HiddenIn));
+        }
+        WidgetsJson.Add(MakeShared<FJsonValueObject>(WidgetJson));
+    }
+
+    OutSweep = MakeShared<FJsonObject>();
+    OutSweep->SetNumberField(TEXT("sample_count"), SampleCount);
+    OutSweep->SetObjectField(TEXT("samples"), SamplesJson);
+    OutSweep->SetStringField(TEXT("widget_id_prefix"), WidgetBlueprint->WidgetTree->GetPathName() + TEXT("."));
+    OutSweep->SetArrayField(TEXT("widgets"), WidgetsJson);
+    return true;
 }
 
 bool UUmgGetSubsystem::CheckWidgetOverlap(UWidgetBlueprint* WidgetBlueprint, const TArray<FString>& WidgetIds)
 {
+    TArray<FUmgWidgetOverlap> Overlaps;
+    TArray<FString> Unmeasured;
+    FString Error;
+    if (!CollectWidgetOverlaps(WidgetBlueprint, WidgetIds, FUmgLayoutResolution(), Overlaps, Unmeasured, Error))
+    {
+        UE_LOG(LogUmgGet, Error, TEXT("CheckWidgetOverlap: %s"), *Error);
+        return false;
+    }
+
+    if (Overlaps.Num() > 0)
+    {
+        UE_LOG(LogUmgGet, Warning, TEXT("CheckWidgetOverlap: %d overlapping pair(s) detected in %s."), Overlaps.Num(), *WidgetBlueprint->GetPathName());
+        return true;
+    }
+
+    return false; // No overlaps found
+}
+
+bool UUmgGetSubsystem::CollectWidgetOverlaps(UWidgetBlueprint* WidgetBlueprint, const TArray<FString>& WidgetIds, const FUmgLayoutResolution& Resolution, TArray<FUmgWidgetOverlap>& OutOverlaps, TArray<FString>& OutUnmeasured, FString& OutError)
+{
+    OutOverlaps.Reset();
+    OutUnmeasured.Reset();
+    OutError.Reset();
+
     if (!WidgetBlueprint)
     {
-        UE_LOG(LogUmgGet, Error, TEXT("CheckWidgetOverlap: Received a null WidgetBlueprint."));
+        OutError = TEXT("Received a null WidgetBlueprint.");
         return false;
     }
 
     if (!WidgetBlueprint->WidgetTree)
     {
-        UE_LOG(LogUmgGet, Error, TEXT("CheckWidgetOverlap: WidgetTree is null for asset '%s'."), *WidgetBlueprint->GetPathName());
+        OutError = FString::Printf(TEXT("WidgetTree is null for asset '%s'."), *WidgetBlueprint->GetPathName());
         return false;
     }
 
-    TArray<UWidget*> AllWidgets;
-    WidgetBlueprint->WidgetTree->GetAllWidgets(AllWidgets);
+    FUmgWidgetIndexCache& WidgetIndex = FUmgWidgetIndexCache::Get();
 
-    TArray<FSlateRect> BoundingBoxes;
-    for (UWidget* Widget : AllWidgets)
+    TArray<UWidget*> Candidates;
+    if (WidgetIds.Num() == 0)
     {
-        if (Widget && Widget->GetCachedWidget().IsValid())
+        WidgetIndex.GetAllWidgets(WidgetBlueprint, Candidates);
+    }
+    else
+    {
+        for (const FString& WidgetId : WidgetIds)
         {
-            BoundingBoxes.Add(Widget->GetCachedWidget()->GetTickSpaceGeometry().GetLayoutBoundingRect());
+            // get_layout_data reports object paths ("...:WidgetTree.Name"); plain names are accepted too.
+            UWidget* Widget = WidgetIndex.FindWidget(WidgetBlueprint, WidgetId);
+            if (!Widget)
+            {
+                int32 SeparatorIndex = INDEX_NONE;
+                WidgetId.FindLastCharByPredicate([](TCHAR Character) { return Character == TEXT('.') || Character == TEXT(':'); }, SeparatorIndex);
+                if (SeparatorIndex != INDEX_NONE)
+                {
+                    Widget = WidgetIndex.FindWidget(WidgetBlueprint, WidgetId.RightChop(SeparatorIndex + 1));
+                }
+            }
+
+            if (!Widget)
+            {
+                OutError = FString::Printf(TEXT("Widget '%s' was not found in '%s'."), *WidgetId, *WidgetBlueprint->GetPathName());
+                return false;
+            }
+            Candidates.AddUnique(Widget);
         }
     }
 
-    for (int32 i = 0; i < BoundingBoxes.Num(); ++i)
+    // Number the tree in pre/post order so the engine can skip a panel overlapping its own descendants.
+    TMap<const UWidget*, TPair<int32, int32>> TreeRanges;
+    if (UWidget* RootWidget = WidgetBlueprint->WidgetTree->RootWidget)
     {
-        for (int32 j = i + 1; j < BoundingBoxes.Num(); ++j)
+        int32 VisitCounter = 0;
+        TArray<TPair<UWidget*, bool>> Stack;
+        Stack.Emplace(RootWidget, false);
+        TArray<UWidget*> Children;
+        while (Stack.Num() > 0)
         {
-            if (FSlateRect::DoRectanglesIntersect(BoundingBoxes[i], BoundingBoxes[j]))
+            const TPair<UWidget*, bool> Entry = Stack.Pop(EAllowShrinking::No);
+            if (Entry.Value)
             {
-                UE_LOG(LogUmgGet, Warning, TEXT("CheckWidgetOverlap: Overlap detected in %s."), *WidgetBlueprint->GetPathName());
-                return true; // Found an overlap
+                TreeRanges.FindChecked(Entry.Key).Value = VisitCounter++;
+                continue;
+            }
+
+            TreeRanges.Add(Entry.Key, TPair<int32, int32>(VisitCounter++, INDEX_NONE));
+            Stack.Emplace(Entry.Key, true);
+            if (WidgetIndex.GetChildren(WidgetBlueprint, Entry.Key, Children))
+            {
+                for (int32 ChildIndex = Children.Num() - 1; ChildIndex >= 0; --ChildIndex)
+                {
+                    Stack.Emplace(Children[ChildIndex], false);
+                }
             }
         }
     }
 
-    return false; // No overlaps found
+    TArray<FUmgLayoutResult> LayoutResults;
+    FString LayoutError;
+    if (!EvaluateLayout(WidgetBlueprint, MakeArrayView(&Resolution, 1), LayoutResults, LayoutError))
+    {
+        OutError = LayoutError;
+        return false;
+    }
+
+    TMap<FString, const FUmgLayoutRect*> RectsByName;
+    RectsByName.Reserve(LayoutResults[0].Rects.Num());
+    for (const FUmgLayoutRect& LayoutRect : LayoutResults[0].Rects)
+    {
+        // Collapsed and hidden widgets take no space on screen and cannot conflict.
+        if (LayoutRect.bVisible)
+        {
+            RectsByName.Add(LayoutRect.WidgetName, &LayoutRect);
+        }
+    }
+
+    TArray<FUmgOverlapItem> Items;
+    TArray<UWidget*> ItemWidgets;
+    Items.Reserve(Candidates.Num());
+    ItemWidgets.Reserve(Candidates.Num());
+    for (UWidget* Widget : Candidates)
+    {
+        const FUmgLayoutRect* const* LayoutRect = Widget ? RectsByName.Find(Widget->GetName()) : nullptr;
+        if (!LayoutRect)
+        {
+            if (Widget)
+            {
+                OutUnmeasured.Add(Widget->GetName());
+            }
+            continue;
+        }
+
+        FUmgOverlapItem& Item = Items.AddDefaulted_GetRef();
+        Item.Rect = (*LayoutRect)->Rect;
+        if (const TPair<int32, int32>* Range = TreeRanges.Find(Widget))
+        {
+            Item.TreeEnter = Range->Key;
+            Item.TreeExit = Range->Value;
+        }
+        ItemWidgets.Add(Widget);
+    }
+
+    TArray<FUmgOverlapPair> Pairs;
+    FUmgOverlapEngine::FindOverlaps(Items, Pairs);
+
+    OutOverlaps.Reserve(Pairs.Num());
+    for (const FUmgOverlapPair& Pair : Pairs)
+    {
+        FUmgWidgetOverlap& Overlap = OutOverlaps.AddDefaulted_GetRef();
+        Overlap.WidgetA = ItemWidgets[Pair.A]->GetName();
+        Overlap.WidgetB = ItemWidgets[Pair.B]->GetName();
+        Overlap.Intersection = Pair.Intersection;
+        Overlap.Area = Pair.Area;
+    }
+    return true;
 }
 
 FString UUmgGetSubsystem::GetAssetFileSystemPath(const FString& AssetPath)
@@ -655,44 +1282,16 @@ FString UUmgGetSubsystem::GetAssetFileSystemPath(const FString& AssetPath)
 
 FString UUmgGetSubsystem::GetWidgetSchema(const FString& WidgetType)
 {
-    UClass* WidgetClass = FindObject<UClass>(nullptr, *WidgetType);
-    if (!WidgetClass)
-    {
-        WidgetClass = LoadObject<UClass>(nullptr, *WidgetType);
-    }
-
-    if (!WidgetClass)
+    const TSharedPtr<const FJsonObject> IndexedSchema = FUmgWidgetSchemaIndex::Get().FindSchema(WidgetType);
+    if (!IndexedSchema.IsValid())
     {
         UE_LOG(LogUmgGet, Error, TEXT("GetWidgetSchema: Failed to find or load widget class '%s'."), *WidgetType);
         return FString();
     }
 
-    TSharedPtr<FJsonObject> SchemaJson = MakeShared<FJsonObject>();
+    // The indexed schema is shared; copy the top-level fields before adding the request-specific type name.
+    TSharedPtr<FJsonObject> SchemaJson = MakeShared<FJsonObject>(*IndexedSchema);
     SchemaJson->SetStringField(TEXT("widget_type"), WidgetType);
-    
-    TSharedPtr<FJsonObject> PropertiesJson = MakeShared<FJsonObject>();
-
-    for (TFieldIterator<FProperty> PropIt(WidgetClass); PropIt; ++PropIt)
-    {
-        FProperty* Property = *PropIt;
-        bool bIsEditorOnly = false;
-#if WITH_EDITOR
-        bIsEditorOnly = Property->HasAnyPropertyFlags(CPF_EditorOnly);
-#endif
-        if (Property->HasAnyPropertyFlags(CPF_Edit) && !bIsEditorOnly)
-        {
-            TSharedPtr<FJsonObject> PropInfo = MakeShared<FJsonObject>();
-            PropInfo->SetStringField(TEXT("type"), Property->GetCPPType());
-            
-            // Add more metadata if needed, e.g., tooltip, category
-#if WITH_EDITOR
-            PropInfo->SetStringField(TEXT("tooltip"), Property->GetToolTipText().ToString());
-#endif
-            PropertiesJson->SetObjectField(Property->GetName(), PropInfo);
-        }
-    }
-
-    SchemaJson->SetObjectField(TEXT("properties"), PropertiesJson);
 
     FString JsonString;
     TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
@@ -0,0 +1,144 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgHeadlessLayout.h"
+#include "Algo/StableSort.h"
+#include "WidgetBlueprint.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/Widget.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Layout/ArrangedChildren.h"
+#include "Layout/Geometry.h"
+#include "Widgets/SWidget.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    static void CollectArrangedRects(const TSharedRef<SWidget>& RootSlate, const FGeometry& RootGeometry, const TMap<const SWidget*, UWidget*>& Owners, TArray<FUmgLayoutRect>& OutRects)
+    {
+        TArray<TPair<TSharedRef<SWidget>, FGeometry>, TInlineAllocator<64>> Stack;
+        Stack.Emplace(RootSlate, RootGeometry);
+
+        while (Stack.Num() > 0)
+        {
+            const TPair<TSharedRef<SWidget>, FGeometry> Entry = Stack.Pop(EAllowShrinking::No);
+            const TSharedRef<SWidget>& SlateWidget = Entry.Key;
+
+            if (UWidget* const* Owner = Owners.Find(&SlateWidget.Get()))
+            {
+                FUmgLayoutRect& LayoutRect = OutRects.AddDefaulted_GetRef();
+                LayoutRect.WidgetName = (*Owner)->GetName();
+                LayoutRect.Rect = Entry.Value.GetLayoutBoundingRect();
+                LayoutRect.bVisible = SlateWidget->GetVisibility().IsVisible();
+            }
+
+            FArrangedChildren ArrangedChildren(EVisibility::All);
+            SlateWidget->ArrangeChildren(Entry.Value, ArrangedChildren);
+            for (int32 ChildIndex = ArrangedChildren.Num() - 1; ChildIndex >= 0; --ChildIndex)
+            {
+                const FArrangedWidget& Child = ArrangedChildren[ChildIndex];
+                Stack.Emplace(Child.Widget, Child.Geometry);
+            }
+        }
+    }
+}
+
+bool FUmgHeadlessLayout::Evaluate(UWidgetBlueprint* WidgetBlueprint, TConstArrayView<FUmgLayoutResolution> Resolutions, TArray<FUmgLayoutResult>& OutResults, FString& OutError)
+{
+    check(IsInGameThread());
+    OutResults.Reset();
+    OutError.Reset();
+
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        OutError = TEXT("Widget blueprint or widget tree is invalid.");
+        return false;
+    }
+
+    if (!WidgetBlueprint->WidgetTree->RootWidget)
+    {
+        OutError = FString::Printf(TEXT("'%s' has no root widget."), *WidgetBlueprint->GetPathName());
+        return false;
+    }
+
+    // Text measurement goes through the Slate font services, which exist in any editor session (including -nullrhi).
+    if (!FSlateApplication::IsInitialized())
+    {
+        OutError = TEXT("Slate is not initialized; headless layout requires an editor session.");
+        return false;
+    }
+
+    UWidgetTree* LayoutTree = DuplicateObject<UWidgetTree>(WidgetBlueprint->WidgetTree, GetTransientPackage());
+    if (!LayoutTree || !LayoutTree->RootWidget)
+    {
+        OutError = TEXT("Failed to duplicate the widget tree for layout.");
+        return false;
+    }
+    LayoutTree->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
+    LayoutTree->SetFlags(RF_Transient);
+
+    TArray<UWidget*> LayoutWidgets;
+    LayoutTree->GetAllWidgets(LayoutWidgets);
+    for (UWidget* Widget : LayoutWidgets)
+    {
+        Widget->ClearFlags(RF_Public | RF_Transactional | RF_ArchetypeObject);
+        Widget->SetFlags(RF_Transient);
+    }
+
+    UWidget* LayoutRoot = LayoutTree->RootWidget;
+    const TSharedRef<SWidget> RootSlate = LayoutRoot->TakeWidget();
+
+    TMap<const SWidget*, UWidget*> Owners;
+    Owners.Reserve(LayoutWidgets.Num());
+    for (UWidget* Widget : LayoutWidgets)
+    {
+        if (const TSharedPtr<SWidget> CachedWidget = Widget->GetCachedWidget())
+        {
+            Owners.Add(CachedWidget.Get(), Widget);
+        }
+    }
+
+    // Group by DPI scale so desired sizes are computed once per scale.
+    TArray<int32> EvaluationOrder;
+    EvaluationOrder.Reserve(Resolutions.Num());
+    for (int32 Index = 0; Index < Resolutions.Num(); ++Index)
+    {
+        EvaluationOrder.Add(Index);
+    }
+    Algo::StableSortBy(EvaluationOrder, [&Resolutions](int32 Index) { return Resolutions[Index].DpiScale > 0.0f ? Resolutions[Index].DpiScale : 1.0f; });
+
+    OutResults.SetNum(Resolutions.Num());
+    TMap<TTuple<int32, int32, float>, int32> EvaluatedViewports;
+    float PrepassScale = -1.0f;
+    for (const int32 Index : EvaluationOrder)
+    {
+        FUmgLayoutResult& Result = OutResults[Index];
+        Result.Resolution = Resolutions[Index];
+        Result.Resolution.Width = FMath::Max(1, Result.Resolution.Width);
+        Result.Resolution.Height = FMath::Max(1, Result.Resolution.Height);
+        Result.Resolution.DpiScale = Result.Resolution.DpiScale > 0.0f ? Result.Resolution.DpiScale : 1.0f;
+        const float Scale = Result.Resolution.DpiScale;
+
+        // Sweeps often repeat a viewport (e.g. a cross product with overlapping presets); arrange it only once.
+        const TTuple<int32, int32, float> ViewportKey(Result.Resolution.Width, Result.Resolution.Height, Scale);
+        if (const int32* EvaluatedIndex = EvaluatedViewports.Find(ViewportKey))
+        {
+            Result.Rects = OutResults[*EvaluatedIndex].Rects;
+            continue;
+        }
+        EvaluatedViewports.Add(ViewportKey, Index);
+
+        if (Scale != PrepassScale)
+        {
+            RootSlate->SlatePrepass(Scale);
+            PrepassScale = Scale;
+        }
+
+        const FVector2D ViewportSize(Result.Resolution.Width, Result.Resolution.Height);
+        const FGeometry RootGeometry = FGeometry::MakeRoot(ViewportSize / Scale, FSlateLayoutTransform(Scale));
+        Result.Rects.Reserve(Owners.Num());
+        CollectArrangedRects(RootSlate, RootGeometry, Owners, Result.Rects);
+    }
+
+    LayoutRoot->ReleaseSlateResources(true);
+    LayoutTree->MarkAsGarbage();
+    return true;
+}
@@ -4,6 +4,8 @@
 #include "Bridge/UmgMcpCommonUtils.h"
 #include "Widget/UmgGetSubsystem.h"
 #include "Widget/UmgSetSubsystem.h"
+#include "Widget/UmgWidgetIndex.h"
+#include "Widget/UmgWidgetSchemaIndex.h"
 #include "FileManage/UmgAttentionSubsystem.h"
 #include "Editor.h"
 #include "Serialization/JsonSerializer.h"
@@ -14,6 +16,131 @@
 
 
 
+namespace
+{
+    static FUmgLayoutResolution ReadLayoutResolution(const TSharedPtr<FJsonObject>& Object, const TCHAR* WidthKey, const TCHAR* HeightKey)
+    {
+        FUmgLayoutResolution Resolution;
+        if (Object.IsValid())
+        {
+            Object->TryGetNumberField(WidthKey, Resolution.Width);
+            Object->TryGetNumberField(HeightKey, Resolution.Height);
+            Object->TryGetNumberField(TEXT("dpi_scale"), Resolution.DpiScale);
+        }
+        return Resolution;
+    }
+
+    // Accepts "resolutions": [{width, height, dpi_scale}], "resolution": {width, height} or flat
+    // resolution_width / resolution_height. Always yields at least one entry; returns true for the batch form.
+    static bool ReadLayoutResolutions(const TSharedPtr<FJsonObject>& Params, TArray<FUmgLayoutResolution>& OutResolutions)
+    {
+        OutResolutions.Reset();
+        const TArray<TSharedPtr<FJsonValue>>* ResolutionsJson = nullptr;
+        if (Params.IsValid() && Params->TryGetArrayField(TEXT("resolutions"), ResolutionsJson))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *ResolutionsJson)
+            {
+                const TSharedPtr<FJsonObject>* ResolutionObject = nullptr;
+                if (Value.IsValid() && Value->TryGetObject(ResolutionObject))
+                {
+                    OutResolutions.Add(ReadLayoutResolution(*ResolutionObject, TEXT("width"), TEXT("height")));
+                }
+            }
+
+            if (OutResolutions.Num() > 0)
+            {
+                return true;
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* ResolutionObject = nullptr;
+        if (Params.IsValid() && Params->TryGetObjectField(TEXT("resolution"), ResolutionObject))
+        {
+            OutResolutions.Add(ReadLayoutResolution(*ResolutionObject, TEXT("width"), TEXT("height")));
+        }
+        else
+        {
+            OutResolutions.Add(ReadLayoutResolution(Params, TEXT("resolution_width"), TEXT("resolution_height")));
+        }
+        return false;
+    }
+
+    static constexpr int32 MaxLayoutSweepSamples = 256;
+
+    // layout_sweep samples: "viewports" ([w, h] pairs or {width, height} objects) crossed with "dpi_scales", or an
+    // explicit "resolutions" list as accepted by get_layout_data.
+    static bool ReadLayoutSweepSamples(const TSharedPtr<FJsonObject>& Params, TArray<FUmgLayoutResolution>& OutSamples, FString& OutError)
+    {
+        OutSamples.Reset();
+        const TArray<TSharedPtr<FJsonValue>>* ViewportsJson = nullptr;
+        if (Params.IsValid() && Params->TryGetArrayField(TEXT("viewports"), ViewportsJson))
+        {
+            TArray<float> DpiScales;
+            const TArray<TSharedPtr<FJsonValue>>* DpiScalesJson = nullptr;
+            if (Params->TryGetArrayField(TEXT("dpi_scales"), DpiScalesJson))
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *DpiScalesJson)
+                {
+                    double DpiScale = 0.0;
+                    if (Value.IsValid() && Value->TryGetNumber(DpiScale) && DpiScale > 0.0)
+                    {
+                        DpiScales.AddUnique(static_cast<float>(DpiScale));
+                    }
+                }
+            }
+
+            for (const TSharedPtr<FJsonValue>& Value : *ViewportsJson)
+            {
+                FUmgLayoutResolution Viewport;
+                const TArray<TSharedPtr<FJsonValue>>* PairJson = nullptr;
+                const TSharedPtr<FJsonObject>* ViewportObject = nullptr;
+                if (Value.IsValid() && Value->TryGetArray(PairJson) && PairJson->Num() == 2 && (*PairJson)[0].IsValid() && (*PairJson)[1].IsValid())
+                {
+                    (*PairJson)[0]->TryGetNumber(Viewport.Width);
+                    (*PairJson)[1]->TryGetNumber(Viewport.Height);
+                }
+                else if (Value.IsValid() && Value->TryGetObject(ViewportObject))
+                {
+                    Viewport = ReadLayoutResolution(*ViewportObject, TEXT("width"), TEXT("height"));
+                }
+                else
+                {
+                    OutError = TEXT("Each entry in 'viewports' must be [width, height] or {\"width\", \"height\"}.");
+                    return false;
+                }
+
+                // Without dpi_scales each viewport keeps its own dpi_scale (default 1).
+                if (DpiScales.Num() == 0)
+                {
+                    OutSamples.Add(Viewport);
+                }
+                for (const float DpiScale : DpiScales)
+                {
+                    Viewport.DpiScale = DpiScale;
+                    OutSamples.Add(Viewport);
+                }
+            }
+        }
+        else if (!ReadLayoutResolutions(Params, OutSamples))
+        {
+            OutError = TEXT("Missing 'viewports' or 'resolutions' parameter.");
+            return false;
+        }
+
+        if (OutSamples.Num() == 0)
+        {
+            OutError = TEXT("layout_sweep needs at least one viewport.");
+            return false;
+        }
+        if (OutSamples.Num() > MaxLayoutSweepSamples)
+        {
+            OutError = FString::Printf(TEXT("layout_sweep accepts at most %d samples, got %d."), MaxLayoutSweepSamples, OutSamples.Num());
+            return false;
+        }
+        return true;
+    }
+}
+
 TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Command, const TSharedPtr<FJsonObject>& Params)
 {
     TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject);
@@ -29,7 +156,7 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
     UWidgetBlueprint* TargetBlueprint = nullptr;
 
     // Some commands don't require a target blueprint
-    if (Command != TEXT("get_widget_schema"))
+    if (Command != TEXT("get_widget_schema") && Command != TEXT("list_widget_classes"))
     {
         TargetBlueprint = FUmgMcpCommonUtils::GetTargetWidgetBlueprint(Params, ErrorMessage);
 
@@ -54,14 +181,52 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
         bool bScopedWidgetFound = false;
         if (!ScopedWidgetName.IsEmpty() && TargetBlueprint && TargetBlueprint->WidgetTree)
         {
-            bScopedWidgetFound = TargetBlueprint->WidgetTree->FindWidget(FName(*ScopedWidgetName)) != nullptr;
+            bScopedWidgetFound = FUmgWidgetIndexCache::Get().FindWidget(TargetBlueprint, ScopedWidgetName) != nullptr;
         }
 
-        FString WidgetTreeString = GetSubsystem->GetWidgetTree(TargetBlueprint, ScopedWidgetName);
-        if (!WidgetTreeString.IsEmpty())
+        const int64 Revision = GetSubsystem->GetWidgetTreeRevision(TargetBlueprint);
+        double SinceRevision = 0.0;
+        if (Params.IsValid() && Params->TryGetNumberField(TEXT("since_revision"), SinceRevision))
+        {
+            TSharedPtr<FJsonObject> Delta;
+            if (GetSubsystem->GetWidgetTreeDelta(TargetBlueprint, static_cast<int64>(SinceRevision), Delta))
+            {
+                Response->SetBoolField(TEXT("success"), true);
+                Response->SetNumberField(TEXT("revision"), static_cast<double>(Revision));
+                Response->SetObjectField(TEXT("delta"), Delta);
+                return Response;
+            }
+
+            Response->SetStringField(TEXT("delta_warning"), FString::Printf(TEXT("Revision %lld is not retained; returned the full tree."), static_cast<int64>(SinceRevision)));
+        }
+
+        FUmgWidgetTreeReadOptions ReadOptions;
+        if (Params.IsValid())
+        {
+            Params->TryGetNumberField(TEXT("max_depth"), ReadOptions.MaxDepth);
+            Params->TryGetNumberField(TEXT("max_nodes"), ReadOptions.MaxNodes);
+            Params->TryGetStringField(TEXT("cursor"), ReadOptions.Cursor);
+        }
+        ReadOptions.MaxDepth = FMath::Max(0, ReadOptions.MaxDepth);
+        ReadOptions.MaxNodes = FMath::Max(0, ReadOptions.MaxNodes);
+
+        FUmgWidgetTreePage TreePage;
+        FString TreeError;
+        if (GetSubsystem->GetWidgetTreePage(TargetBlueprint, ScopedWidgetName, ReadOptions, TreePage, TreeError) && !TreePage.Tree.IsEmpty())
         {
             Response->SetBoolField(TEXT("success"), true);
-            Response->SetStringField(TEXT("widget_tree"), WidgetTreeString);
+            Response->SetStringField(TEXT("widget_tree"), TreePage.Tree);
+            Response->SetNumberField(TEXT("revision"), static_cast<double>(Revision));
+            Response->SetNumberField(TEXT("node_count"), TreePage.NodeCount);
+            if (TreePage.CollapsedSubtrees > 0)
+            {
+                Response->SetNumberField(TEXT("collapsed_subtrees"), TreePage.CollapsedSubtrees);
+            }
+            if (!TreePage.NextCursor.IsEmpty())
+            {
+                Response->SetBoolField(TEXT("truncated"), true);
+                Response->SetStringField(TEXT("next_cursor"), TreePage.NextCursor);
+            }
             if (!ScopedWidgetName.IsEmpty() && bScopedWidgetFound)
             {
                 Response->SetStringField(TEXT("root_widget"), ScopedWidgetName);
@@ -79,7 +244,7 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
         else
         {
             Response->SetBoolField(TEXT("success"), false);
-            Response->SetStringField(TEXT("error"), TEXT("GetWidgetTree from subsystem returned empty or invalid data. Check logs for details."));
+            Response->SetStringField(TEXT("error"), TreeError.IsEmpty() ? FString(TEXT("GetWidgetTree from subsystem returned empty or invalid data. Check logs for details.")) : TreeError);
         }
     }
     else if (Command == TEXT("query_widget_properties"))
@@ -119,16 +284,14 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
     }
     else if (Command == TEXT("get_widget_schema"))
     {
-        UUmgGetSubsystem* GetSubsystem = GEditor->GetEditorSubsystem<UUmgGetSubsystem>();
         FString WidgetType;
         if (Params->TryGetStringField(TEXT("widget_type"), WidgetType))
         {
-            FString SchemaJsonString = GetSubsystem->GetWidgetSchema(WidgetType);
-            TSharedPtr<FJsonObject> SchemaJson;
-            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(SchemaJsonString);
-            if (FJsonSerializer::Deserialize(Reader, SchemaJson) && SchemaJson.IsValid())
+            const TSharedPtr<const FJsonObject> SchemaJson = FUmgWidgetSchemaIndex::Get().FindSchema(WidgetType);
+            if (SchemaJson.IsValid())
             {
                 Response->SetBoolField(TEXT("success"), true);
+                Response->SetStringField(TEXT("widget_type"), WidgetType);
                 for (const auto& Field : SchemaJson->Values)
                 {
                     Response->SetField(UmgMcpJsonCompat::KeyToString(Field.Key), Field.Value);
@@ -137,7 +300,7 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
             else
             {
                 Response->SetBoolField(TEXT("success"), false);
-                Response->SetStringField(TEXT("error"), TEXT("Failed to get widget schema or parse response."));
+                Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown widget class '%s'."), *WidgetType));
             }
         }
         else
@@ -146,37 +309,174 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
             Response->SetStringField(TEXT("error"), TEXT("Missing 'widget_type' parameter."));
         }
     }
-    else if (Command == TEXT("get_layout_data"))
+    else if (Command == TEXT("list_widget_classes"))
     {
-        UUmgGetSubsystem* GetSubsystem = GEditor->GetEditorSubsystem<UUmgGetSubsystem>();
-        int32 ResolutionWidth = 1920;
-        int32 ResolutionHeight = 1080;
+        FString Filter;
+        bool bIncludeAbstract = false;
+        bool bIncludeBlueprints = true;
+        bool bPanelsOnly = false;
         if (Params.IsValid())
         {
-            if (Params->HasField(TEXT("resolution_width")))
+            Params->TryGetStringField(TEXT("filter"), Filter);
+            Params->TryGetBoolField(TEXT("include_abstract"), bIncludeAbstract);
+            Params->TryGetBoolField(TEXT("include_blueprints"), bIncludeBlueprints);
+            Params->TryGetBoolField(TEXT("panels_only"), bPanelsOnly);
+        }
+
+        FUmgWidgetSchemaIndex& SchemaIndex = FUmgWidgetSchemaIndex::Get();
+        TArray<const FUmgWidgetClassInfo*> Classes;
+        SchemaIndex.GetClasses(Classes);
+
+        TArray<TSharedPtr<FJsonValue>> ClassesJson;
+        for (const FUmgWidgetClassInfo* ClassInfo : Classes)
+        {
+            if ((!bIncludeAbstract && ClassInfo->bAbstract)
+                || (!bIncludeBlueprints && !ClassInfo->bNative)
+                || (bPanelsOnly && !ClassInfo->bPanel)
+                || (!Filter.IsEmpty() && !ClassInfo->ClassName.ToString().Contains(Filter)))
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> ClassJson = MakeShared<FJsonObject>();
+            ClassJson->SetStringField(TEXT("name"), ClassInfo->ClassName.ToString());
+            ClassJson->SetStringField(TEXT("path"), ClassInfo->ClassPath);
+            ClassJson->SetStringField(TEXT("parent"), ClassInfo->ParentClassPath);
+            ClassJson->SetBoolField(TEXT("native"), ClassInfo->bNative);
+            if (ClassInfo->bAbstract)
             {
-                ResolutionWidth = Params->GetIntegerField(TEXT("resolution_width"));
+                ClassJson->SetBoolField(TEXT("abstract"), true);
             }
-            if (Params->HasField(TEXT("resolution_height")))
+            if (ClassInfo->bPanel)
             {
-                ResolutionHeight = Params->GetIntegerField(TEXT("resolution_height"));
+                ClassJson->SetBoolField(TEXT("panel"), true);
             }
+            ClassesJson.Add(MakeShared<FJsonValueObject>(ClassJson));
         }
 
-        FString LayoutJsonString = GetSubsystem->GetLayoutData(TargetBlueprint, ResolutionWidth, ResolutionHeight);
-        TArray<TSharedPtr<FJsonValue>> LayoutArray;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(LayoutJsonString);
-        if (FJsonSerializer::Deserialize(Reader, LayoutArray))
+        Response->SetBoolField(TEXT("success"), true);
+        Response->SetNumberField(TEXT("count"), ClassesJson.Num());
+        Response->SetArrayField(TEXT("classes"), ClassesJson);
+        Response->SetBoolField(TEXT("index_ready"), SchemaIndex.IsReady());
+        Response->SetNumberField(TEXT("generation"), static_cast<double>(SchemaIndex.GetGeneration()));
+    }
+    else if (Command == TEXT("get_layout_data"))
+    {
+        UUmgGetSubsystem* GetSubsystem = GEditor->GetEditorSubsystem<UUmgGetSubsystem>();
+        TArray<FUmgLayoutResolution> Resolutions;
+        const bool bBatch = ReadLayoutResolutions(Params, Resolutions);
+
+        TArray<FUmgLayoutResult> LayoutResults;
+        FString LayoutError;
+        if (GetSubsystem->EvaluateLayout(TargetBlueprint, Resolutions, LayoutResults, LayoutError))
+        {
+            Response->SetBoolField(TEXT("success"), true);
+            if (!bBatch)
+            {
+                Response->SetArrayField(TEXT("layout_data"), UUmgGetSubsystem::LayoutResultToJson(TargetBlueprint, LayoutResults[0]));
+                Response->SetNumberField(TEXT("resolution_width"), LayoutResults[0].Resolution.Width);
+                Response->SetNumberField(TEXT("resolution_height"), LayoutResults[0].Resolution.Height);
+                Response->SetNumberField(TEXT("dpi_scale"), LayoutResults[0].Resolution.DpiScale);
+                Response->SetBoolField(TEXT("headless"), LayoutResults[0].bHeadless);
+            }
+            else
+            {
+                TArray<TSharedPtr<FJsonValue>> LayoutsJson;
+                for (const FUmgLayoutResult& LayoutResult : LayoutResults)
+                {
+                    TSharedPtr<FJsonObject> LayoutJson = MakeShared<FJsonObject>();
+                    LayoutJson->SetNumberField(TEXT("width"), LayoutResult.Resolution.Width);
+                    LayoutJson->SetNumberField(TEXT("height"), LayoutResult.Resolution.Height);
+                    LayoutJson->SetNumberField(TEXT("dpi_scale"), LayoutResult.Resolution.DpiScale);
+                    LayoutJson->SetArrayField(TEXT("layout_data"), UUmgGetSubsystem::LayoutResultToJson(TargetBlueprint, LayoutResult));
+                    LayoutsJson.Add(MakeShared<FJsonValueObject>(LayoutJson));
+                }
+                Response->SetArrayField(TEXT("layouts"), LayoutsJson);
+                Response->SetBoolField(TEXT("headless"), true);
+            }
+        }
+        else
+        {
+            Response->SetBoolField(TEXT("success"), false);
+            Response->SetStringField(TEXT("error"), LayoutError.IsEmpty() ? FString(TEXT("Failed to get layout data.")) : LayoutError);
+        }
+    }
+    else if (Command == TEXT("layout_sweep"))
+    {
+        UUmgGetSubsystem* GetSubsystem = GEditor->GetEditorSubsystem<UUmgGetSubsystem>();
+        TArray<FUmgLayoutResolution> Samples;
+        FString SweepError;
+        TSharedPtr<FJsonObject> Sweep;
+        if (ReadLayoutSweepSamples(Params, Samples, SweepError) && GetSubsystem->EvaluateLayoutSweep(TargetBlueprint, Samples, Sweep, SweepError))
+        {
+            Response = Sweep;
+            Response->SetBoolField(TEXT("success"), true);
+        }
+        else
+        {
+            Response->SetBoolField(TEXT("success"), false);
+            Response->SetStringField(TEXT("error"), SweepError.IsEmpty() ? FString(TEXT("Failed to run layout sweep.")) : SweepError);
+        }
+    }
+    else if (Command == TEXT("check_widget_overlap"))
+    {
+        UUmgGetSubsystem* GetSubsystem = GEditor->GetEditorSubsystem<UUmgGetSubsystem>();
+        TArray<FString> WidgetIds;
+        const TArray<TSharedPtr<FJsonValue>>* WidgetIdsJsonArray = nullptr;
+        if (Params.IsValid() && (Params->TryGetArrayField(TEXT("widget_names"), WidgetIdsJsonArray) || Params->TryGetArrayField(TEXT("widget_ids"), WidgetIdsJsonArray)))
         {
+            for (const TSharedPtr<FJsonValue>& Value : *WidgetIdsJsonArray)
+            {
+                FString WidgetId;
+                if (Value.IsValid() && Value->TryGetString(WidgetId) && !WidgetId.IsEmpty())
+                {
+                    WidgetIds.Add(WidgetId);
+                }
+            }
+        }
+
+        TArray<FUmgLayoutResolution> Resolutions;
+        ReadLayoutResolutions(Params, Resolutions);
+
+        TArray<FUmgWidgetOverlap> Overlaps;
+        TArray<FString> Unmeasured;
+        FString OverlapError;
+        if (GetSubsystem->CollectWidgetOverlaps(TargetBlueprint, WidgetIds, Resolutions[0], Overlaps, Unmeasured, OverlapError))
+        {
+            TArray<TSharedPtr<FJsonValue>> PairsJson;
+            PairsJson.Reserve(Overlaps.Num());
+            for (const FUmgWidgetOverlap& Overlap : Overlaps)
+            {
+                TSharedPtr<FJsonObject> PairJson = MakeShared<FJsonObject>();
+                PairJson->SetStringField(TEXT("widget_a"), Overlap.WidgetA);
+                PairJson->SetStringField(TEXT("widget_b"), Overlap.WidgetB);
+                PairJson->SetNumberField(TEXT("area"), Overlap.Area);
+                PairJson->SetNumberField(TEXT("left"), Overlap.Intersection.Left);
+                PairJson->SetNumberField(TEXT("top"), Overlap.Intersection.Top);
+                PairJson->SetNumberField(TEXT("right"), Overlap.Intersection.Right);
+                PairJson->SetNumberField(TEXT("bottom"), Overlap.Intersection.Bottom);
+                PairsJson.Add(MakeShared<FJsonValueObject>(PairJson));
+            }
+
+            TArray<TSharedPtr<FJsonValue>> UnmeasuredJson;
+            for (const FString& WidgetName : Unmeasured)
+            {
+                UnmeasuredJson.Add(MakeShared<FJsonValueString>(WidgetName));
+            }
+
             Response->SetBoolField(TEXT("success"), true);
-            Response->SetArrayField(TEXT("layout_data"), LayoutArray);
-            Response->SetNumberField(TEXT("resolution_width"), ResolutionWidth);
-            Response->SetNumberField(TEXT("resolution_height"), ResolutionHeight);
+            Response->SetBoolField(TEXT("has_overlap"), Overlaps.Num() > 0);
+            Response->SetNumberField(TEXT("overlap_count"), Overlaps.Num());
+            Response->SetArrayField(TEXT("overlaps"), PairsJson);
+            if (UnmeasuredJson.Num() > 0)
+            {
+                Response->SetArrayField(TEXT("unmeasured_widgets"), UnmeasuredJson);
+            }
         }
         else
         {
             Response->SetBoolField(TEXT("success"), false);
-            Response->SetStringField(TEXT("error"), TEXT("Failed to get layout data or parse response."));
+            Response->SetStringField(TEXT("error"), OverlapError);
         }
     }
     
@@ -208,6 +508,40 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
             Response->SetStringField(TEXT("error"), TEXT("Missing parameters for create_widget (widget_type, new_widget_name)."));
         }
     }
+    else if (Command == TEXT("create_widget_subtree"))
+    {
+        UUmgSetSubsystem* SetSubsystem = GEditor->GetEditorSubsystem<UUmgSetSubsystem>();
+        TSharedPtr<FJsonValue> Spec = Params.IsValid() ? Params->TryGetField(TEXT("tree")) : nullptr;
+        if (Spec.IsValid())
+        {
+            FString ParentName;
+            Params->TryGetStringField(TEXT("parent_name"), ParentName); // Optional
+
+            TArray<FString> CreatedWidgets;
+            FString SubtreeError;
+            if (SetSubsystem->CreateWidgetSubtree(TargetBlueprint, ParentName, Spec, CreatedWidgets, SubtreeError))
+            {
+                TArray<TSharedPtr<FJsonValue>> CreatedJson;
+                for (const FString& CreatedWidget : CreatedWidgets)
+                {
+                    CreatedJson.Add(MakeShared<FJsonValueString>(CreatedWidget));
+                }
+                Response->SetBoolField(TEXT("success"), true);
+                Response->SetNumberField(TEXT("created_count"), CreatedWidgets.Num());
+                Response->SetArrayField(TEXT("created_widgets"), CreatedJson);
+            }
+            else
+            {
+                Response->SetBoolField(TEXT("success"), false);
+                Response->SetStringField(TEXT("error"), SubtreeError);
+            }
+        }
+        else
+        {
+            Response->SetBoolField(TEXT("success"), false);
+            Response->SetStringField(TEXT("error"), TEXT("Missing 'tree' parameter for create_widget_subtree."));
+        }
+    }
     else if (Command == TEXT("set_active_widget"))
     {
          FString WidgetName;
@@ -268,11 +602,13 @@ TSharedPtr<FJsonObject> FUmgMcpWidgetCommands::HandleCommand(const FString& Comm
 
             UE_LOG(LogTemp, Log, TEXT("UmgMcpWidgetCommands: Serialized Properties JSON for '%s': %s"), *WidgetName, *PropertiesJsonString);
 
-            if (SetSubsystem->SetWidgetProperties(TargetBlueprint, WidgetName, PropertiesJsonString))
+            EUmgModificationPath ModificationPath;
+            if (SetSubsystem->SetWidgetProperties(TargetBlueprint, WidgetName, PropertiesJsonString, ModificationPath))
             {
                 Response->SetBoolField(TEXT("success"), true);
                 Response->SetStringField(TEXT("widget"), WidgetName);
                 Response->SetObjectField(TEXT("properties_applied"), PropertiesJsonObject);
+                Response->SetStringField(TEXT("modification_path"), LexToString(ModificationPath));
             }
             else
             {
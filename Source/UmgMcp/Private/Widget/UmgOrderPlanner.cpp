@@ -0,0 +1,89 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgOrderPlanner.h"
+#include "Algo/BinarySearch.h"
+#include "Components/PanelWidget.h"
+
+void FUmgOrderPlanner::MarkLongestIncreasingSubsequence(TConstArrayView<int32> Values, TBitArray<>& OutInSequence)
+{
+	OutInSequence.Init(false, Values.Num());
+	TArray<int32> TailIndices;
+	TArray<int32> Predecessors;
+	Predecessors.Init(INDEX_NONE, Values.Num());
+
+	for (int32 Index = 0; Index < Values.Num(); ++Index)
+	{
+		const int32 Position = Algo::LowerBoundBy(TailIndices, Values[Index], [&Values](int32 TailIndex) { return Values[TailIndex]; });
+		if (Position > 0)
+		{
+			Predecessors[Index] = TailIndices[Position - 1];
+		}
+
+		if (Position == TailIndices.Num())
+		{
+			TailIndices.Add(Index);
+		}
+		else
+		{
+			TailIndices[Position] = Index;
+		}
+	}
+
+	for (int32 Index = TailIndices.Num() > 0 ? TailIndices.Last() : INDEX_NONE; Index != INDEX_NONE; Index = Predecessors[Index])
+	{
+		OutInSequence[Index] = true;
+	}
+}
+
+void FUmgOrderPlanner::PlanMoves(TConstArrayView<int32> CurrentIndices, TArray<int32>& OutMovedPositions)
+{
+	OutMovedPositions.Reset();
+
+	TBitArray<> Kept;
+	MarkLongestIncreasingSubsequence(CurrentIndices, Kept);
+
+	// Right to left, so every anchor is either kept or already in its final place when something is inserted before it.
+	for (int32 Position = CurrentIndices.Num() - 1; Position >= 0; --Position)
+	{
+		if (!Kept[Position])
+		{
+			OutMovedPositions.Add(Position);
+		}
+	}
+}
+
+int32 FUmgOrderPlanner::ApplyOrder(UPanelWidget* Panel, TConstArrayView<UWidget*> FinalOrder, TFunctionRef<void(UWidget* Child, int32 Position)> BeforeMove)
+{
+	TMap<UWidget*, int32> CurrentIndexByChild;
+	CurrentIndexByChild.Reserve(Panel->GetChildrenCount());
+	for (int32 Index = 0; Index < Panel->GetChildrenCount(); ++Index)
+	{
+		CurrentIndexByChild.Add(Panel->GetChildAt(Index), Index);
+	}
+
+	TArray<int32> CurrentIndices;
+	CurrentIndices.Reserve(FinalOrder.Num());
+	for (UWidget* Child : FinalOrder)
+	{
+		CurrentIndices.Add(CurrentIndexByChild.FindChecked(Child));
+	}
+
+	TArray<int32> MovedPositions;
+	PlanMoves(CurrentIndices, MovedPositions);
+	for (const int32 Position : MovedPositions)
+	{
+		UWidget* Child = FinalOrder[Position];
+		BeforeMove(Child, Position);
+
+		// ShiftChild takes the index after the child has been removed from its current slot.
+		const int32 CurrentIndex = Panel->GetChildIndex(Child);
+		int32 TargetIndex = Panel->GetChildrenCount() - 1;
+		if (FinalOrder.IsValidIndex(Position + 1))
+		{
+			const int32 AnchorIndex = Panel->GetChildIndex(FinalOrder[Position + 1]);
+			TargetIndex = CurrentIndex < AnchorIndex ? AnchorIndex - 1 : AnchorIndex;
+		}
+
+		Panel->ShiftChild(TargetIndex, Child);
+	}
+	return MovedPositions.Num();
+}
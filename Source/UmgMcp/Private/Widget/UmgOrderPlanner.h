@@ -0,0 +1,38 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "Templates/Function.h"
+
+class UPanelWidget;
+class UWidget;
+
+/**
+ * Helpers for turning one sibling order into another with as few moves as possible.
+ *
+ * The elements that already appear in the requested relative order form an increasing subsequence of their current
+ * indices; keeping the longest such subsequence in place and relocating everything else gives the minimum number of
+ * single-element moves. Reordering a long list where only a few items changed therefore touches only those items.
+ */
+class FUmgOrderPlanner
+{
+public:
+	/** Marks the elements of Values that form one longest strictly increasing subsequence (O(n log n)). */
+	static void MarkLongestIncreasingSubsequence(TConstArrayView<int32> Values, TBitArray<>& OutInSequence);
+
+	/**
+	 * CurrentIndices[i] is the current index of the element that must end up at position i (a permutation of 0..n-1).
+	 * Fills OutMovedPositions with the final positions of the elements to relocate, right to left. Applying them in
+	 * that order, each moved element is inserted directly before the element at its final position + 1 (or at the end
+	 * for the last position), which yields the requested order.
+	 */
+	static void PlanMoves(TConstArrayView<int32> CurrentIndices, TArray<int32>& OutMovedPositions);
+
+	/**
+	 * Reorders the children of Panel into FinalOrder, which must list each of them exactly once, shifting only the
+	 * children PlanMoves picks. BeforeMove gets each of those with its final position just before it is shifted, so
+	 * the caller can put it in the undo buffer and record the move. Returns the number of children moved.
+	 */
+	static int32 ApplyOrder(UPanelWidget* Panel, TConstArrayView<UWidget*> FinalOrder, TFunctionRef<void(UWidget* Child, int32 Position)> BeforeMove);
+};
@@ -0,0 +1,80 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgOverlapEngine.h"
+
+bool FUmgOverlapEngine::AreTreeRelated(const FUmgOverlapItem& First, const FUmgOverlapItem& Second)
+{
+	if (First.TreeEnter == INDEX_NONE || Second.TreeEnter == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const bool bFirstContainsSecond = First.TreeEnter <= Second.TreeEnter && Second.TreeExit <= First.TreeExit;
+	const bool bSecondContainsFirst = Second.TreeEnter <= First.TreeEnter && First.TreeExit <= Second.TreeExit;
+	return bFirstContainsSecond || bSecondContainsFirst;
+}
+
+void FUmgOverlapEngine::FindOverlaps(TConstArrayView<FUmgOverlapItem> Items, TArray<FUmgOverlapPair>& OutPairs)
+{
+	OutPairs.Reset();
+
+	TArray<int32> SweepOrder;
+	SweepOrder.Reserve(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		const FSlateRect& Rect = Items[Index].Rect;
+		if (Rect.Right > Rect.Left && Rect.Bottom > Rect.Top)
+		{
+			SweepOrder.Add(Index);
+		}
+	}
+
+	SweepOrder.Sort([&Items](int32 First, int32 Second)
+	{
+		return Items[First].Rect.Left < Items[Second].Rect.Left;
+	});
+
+	TArray<int32> Active;
+	for (const int32 Current : SweepOrder)
+	{
+		const FUmgOverlapItem& CurrentItem = Items[Current];
+		const FSlateRect& CurrentRect = CurrentItem.Rect;
+
+		for (int32 ActiveIndex = Active.Num() - 1; ActiveIndex >= 0; --ActiveIndex)
+		{
+			const int32 Other = Active[ActiveIndex];
+			const FUmgOverlapItem& OtherItem = Items[Other];
+			const FSlateRect& OtherRect = OtherItem.Rect;
+
+			// Everything later in the sweep starts at or right of CurrentRect.Left, so this rect can be retired.
+			if (OtherRect.Right <= CurrentRect.Left)
+			{
+				Active.RemoveAtSwap(ActiveIndex, EAllowShrinking::No);
+				continue;
+			}
+
+			const float Top = FMath::Max(CurrentRect.Top, OtherRect.Top);
+			const float Bottom = FMath::Min(CurrentRect.Bottom, OtherRect.Bottom);
+			if (Bottom <= Top || AreTreeRelated(CurrentItem, OtherItem))
+			{
+				continue;
+			}
+
+			FUmgOverlapPair& Pair = OutPairs.AddDefaulted_GetRef();
+			Pair.A = FMath::Min(Current, Other);
+			Pair.B = FMath::Max(Current, Other);
+			Pair.Intersection = FSlateRect(CurrentRect.Left, Top, FMath::Min(CurrentRect.Right, OtherRect.Right), Bottom);
+			Pair.Area = static_cast<double>(Pair.Intersection.Right - Pair.Intersection.Left) * static_cast<double>(Bottom - Top);
+		}
+
+		Active.Add(Current);
+	}
+
+	OutPairs.Sort([](const FUmgOverlapPair& First, const FUmgOverlapPair& Second)
+	{
+		if (First.Area != Second.Area)
+		{
+			return First.Area > Second.Area;
+		}
+		return First.A != Second.A ? First.A < Second.A : First.B < Second.B;
+	});
+}
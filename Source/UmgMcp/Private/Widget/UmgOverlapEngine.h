@@ -0,0 +1,40 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Layout/SlateRect.h"
+
+struct FUmgOverlapItem
+{
+	FSlateRect Rect;
+
+	/** Pre-order / post-order visit numbers in the widget tree. Items whose ranges nest are ancestor and descendant. */
+	int32 TreeEnter = INDEX_NONE;
+	int32 TreeExit = INDEX_NONE;
+};
+
+struct FUmgOverlapPair
+{
+	/** Indices into the item array, A < B. */
+	int32 A = INDEX_NONE;
+	int32 B = INDEX_NONE;
+	FSlateRect Intersection;
+	double Area = 0.0;
+};
+
+/**
+ * Pure sweep-and-prune overlap finder for widget bounding rects.
+ *
+ * Items are swept along X in order of their left edge while an active list holds every rect that still spans the
+ * sweep line, so only rects that already overlap in X are tested in Y. Cost is O(n log n + n * active + pairs)
+ * instead of the O(n^2) all-pairs test. Rects only touching at an edge, empty rects and ancestor/descendant pairs
+ * (a panel always contains its children) are not reported.
+ */
+class FUmgOverlapEngine
+{
+public:
+	/** Fills OutPairs with every overlapping pair, largest intersection first. */
+	static void FindOverlaps(TConstArrayView<FUmgOverlapItem> Items, TArray<FUmgOverlapPair>& OutPairs);
+
+	static bool AreTreeRelated(const FUmgOverlapItem& First, const FUmgOverlapItem& Second);
+};
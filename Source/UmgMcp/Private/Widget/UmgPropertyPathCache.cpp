@@ -0,0 +1,603 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgPropertyPathCache.h"
+#include "Bridge/UmgMcpJsonCompat.h"
+#include "Bridge/UmgMcpRequestArena.h"
+#include "Widget/UmgAssetPreloader.h"
+#include "PropertyNameMappings.h"
+
+#include "Editor.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "JsonObjectConverter.h"
+#include "Layout/Margin.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    /** Looks a single key segment up on Owner: exact (case-insensitive) FName, then the mapping table, then the 'b' prefix of bool properties. */
+    static FProperty* FindPropertyForSegment(const UStruct* Owner, FStringView Segment)
+    {
+        if (!Owner || Segment.IsEmpty())
+        {
+            return nullptr;
+        }
+
+        const FName SegmentName(Segment.Len(), Segment.GetData(), FNAME_Find);
+        if (!SegmentName.IsNone())
+        {
+            if (FProperty* Property = Owner->FindPropertyByName(SegmentName))
+            {
+                return Property;
+            }
+        }
+
+        TStringBuilder<128> Mapped;
+        AppendNormalizedPropertyName(Mapped, Segment);
+        const FName MappedName(Mapped.Len(), Mapped.GetData(), FNAME_Find);
+        if (!MappedName.IsNone() && MappedName != SegmentName)
+        {
+            if (FProperty* Property = Owner->FindPropertyByName(MappedName))
+            {
+                return Property;
+            }
+        }
+
+        TStringBuilder<128> BoolSpelling;
+        BoolSpelling.AppendChar(TEXT('b'));
+        BoolSpelling << Mapped.ToView();
+        const FName BoolName(BoolSpelling.Len(), BoolSpelling.GetData(), FNAME_Find);
+        if (!BoolName.IsNone())
+        {
+            return FindFProperty<FBoolProperty>(Owner, BoolName);
+        }
+        return nullptr;
+    }
+
+    /** Struct or class whose fields a JSON object stored under Property describes. */
+    static const UStruct* GetValueOwner(const FProperty* Property)
+    {
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            Property = ArrayProperty->Inner;
+        }
+        else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            Property = SetProperty->ElementProp;
+        }
+
+        if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+        {
+            return StructProperty->Struct;
+        }
+        if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+        {
+            return ObjectProperty->PropertyClass;
+        }
+        return nullptr;
+    }
+
+    static EUmgPropertyAccessKind ClassifyLeaf(const FProperty* Leaf)
+    {
+        if (!Leaf || Leaf->ArrayDim != 1)
+        {
+            return EUmgPropertyAccessKind::Converter;
+        }
+        if (Leaf->IsA<FBoolProperty>())
+        {
+            return EUmgPropertyAccessKind::Bool;
+        }
+        if (Leaf->IsA<FEnumProperty>())
+        {
+            return EUmgPropertyAccessKind::Enum;
+        }
+        if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Leaf))
+        {
+            return NumericProperty->GetIntPropertyEnum() ? EUmgPropertyAccessKind::Enum : EUmgPropertyAccessKind::Numeric;
+        }
+        if (Leaf->IsA<FObjectProperty>())
+        {
+            return EUmgPropertyAccessKind::Object;
+        }
+        if (const FStructProperty* StructProperty = CastField<FStructProperty>(Leaf))
+        {
+            const UScriptStruct* Struct = StructProperty->Struct;
+            if (Struct == TBaseStructure<FLinearColor>::Get()) return EUmgPropertyAccessKind::LinearColor;
+            if (Struct == TBaseStructure<FColor>::Get()) return EUmgPropertyAccessKind::Color;
+            if (Struct == FMargin::StaticStruct()) return EUmgPropertyAccessKind::Margin;
+            if (Struct == TBaseStructure<FVector2D>::Get()) return EUmgPropertyAccessKind::Vector2D;
+            if (Struct == TBaseStructure<FVector>::Get()) return EUmgPropertyAccessKind::Vector;
+        }
+        return EUmgPropertyAccessKind::Converter;
+    }
+
+    /**
+     * Reads up to Names.Num() components from a JSON array ([x, y, ...]) or object ({"X": .., "Y": ..}).
+     * Missing object fields keep their current value, matching JsonObjectToUStruct's merge behaviour.
+     */
+    static bool ReadJsonComponents(const TSharedPtr<FJsonValue>& Value, TConstArrayView<const TCHAR*> Names, int32 MinArrayCount, double* InOutComponents)
+    {
+        if (Value->Type == EJson::Array)
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Items = Value->AsArray();
+            if (Items.Num() < MinArrayCount || Items.Num() > Names.Num())
+            {
+                return false;
+            }
+            for (int32 Index = 0; Index < Items.Num(); ++Index)
+            {
+                if (!Items[Index].IsValid() || !Items[Index]->TryGetNumber(InOutComponents[Index]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (Value->Type == EJson::Object)
+        {
+            const TSharedPtr<FJsonObject> Object = Value->AsObject();
+            for (int32 Index = 0; Index < Names.Num(); ++Index)
+            {
+                Object->TryGetNumberField(Names[Index], InOutComponents[Index]);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /** Object in the shape UStructToJsonObject produces: StandardizeCase keys in declaration order. */
+    static TSharedPtr<FJsonValue> MakeComponentsJson(TConstArrayView<const TCHAR*> Keys, const double* Components)
+    {
+        TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+        for (int32 Index = 0; Index < Keys.Num(); ++Index)
+        {
+            Object->SetNumberField(Keys[Index], Components[Index]);
+        }
+        return MakeShared<FJsonValueObject>(Object);
+    }
+
+    static bool WriteEnumValue(const FProperty* Leaf, void* ValuePtr, const TSharedPtr<FJsonValue>& Value)
+    {
+        const FNumericProperty* Underlying = nullptr;
+        const UEnum* Enum = nullptr;
+        if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Leaf))
+        {
+            Underlying = EnumProperty->GetUnderlyingProperty();
+            Enum = EnumProperty->GetEnum();
+        }
+        else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Leaf))
+        {
+            Underlying = NumericProperty;
+            Enum = NumericProperty->GetIntPropertyEnum();
+        }
+        if (!Underlying || !Enum)
+        {
+            return false;
+        }
+
+        int64 EnumValue = INDEX_NONE;
+        if (Value->Type == EJson::String)
+        {
+            EnumValue = Enum->GetValueByNameString(Value->AsString());
+            if (EnumValue == INDEX_NONE)
+            {
+                return false;
+            }
+        }
+        else if (Value->Type == EJson::Number)
+        {
+            EnumValue = static_cast<int64>(Value->AsNumber());
+        }
+        else
+        {
+            return false;
+        }
+        Underlying->SetIntPropertyValue(ValuePtr, EnumValue);
+        return true;
+    }
+
+    static bool WriteTypedValue(EUmgPropertyAccessKind Kind, FProperty* Leaf, void* ValuePtr, const TSharedPtr<FJsonValue>& Value)
+    {
+        static const TCHAR* ColorNames[] = { TEXT("R"), TEXT("G"), TEXT("B"), TEXT("A") };
+        static const TCHAR* MarginNames[] = { TEXT("Left"), TEXT("Top"), TEXT("Right"), TEXT("Bottom") };
+        static const TCHAR* VectorNames[] = { TEXT("X"), TEXT("Y"), TEXT("Z") };
+
+        switch (Kind)
+        {
+        case EUmgPropertyAccessKind::Bool:
+            if (Value->Type == EJson::Boolean)
+            {
+                CastFieldChecked<FBoolProperty>(Leaf)->SetPropertyValue(ValuePtr, Value->AsBool());
+                return true;
+            }
+            return false;
+
+        case EUmgPropertyAccessKind::Numeric:
+            if (Value->Type == EJson::Number)
+            {
+                const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Leaf);
+                if (NumericProperty->IsFloatingPoint())
+                {
+                    NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Value->AsNumber());
+                }
+                else
+                {
+                    NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(Value->AsNumber()));
+                }
+                return true;
+            }
+            return false;
+
+        case EUmgPropertyAccessKind::Enum:
+            return WriteEnumValue(Leaf, ValuePtr, Value);
+
+        case EUmgPropertyAccessKind::Object:
+            // Auto-resolve object pointers from asset paths (e.g. Brush.ResourceObject, Font.FontObject).
+            if (Value->Type == EJson::String && !Value->AsString().IsEmpty())
+            {
+                const FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(Leaf);
+                UObject* Resolved = FUmgAssetPreloader::Get().ResolveObjectPath(Value->AsString());
+                if (Resolved && Resolved->IsA(ObjectProperty->PropertyClass))
+                {
+                    ObjectProperty->SetObjectPropertyValue(ValuePtr, Resolved);
+                    return true;
+                }
+            }
+            return false;
+
+        case EUmgPropertyAccessKind::LinearColor:
+        {
+            FLinearColor& Color = *static_cast<FLinearColor*>(ValuePtr);
+            double Components[4] = { Color.R, Color.G, Color.B, Color.A };
+            if (!ReadJsonComponents(Value, ColorNames, 3, Components))
+            {
+                return false;
+            }
+            Color = FLinearColor(static_cast<float>(Components[0]), static_cast<float>(Components[1]), static_cast<float>(Components[2]), static_cast<float>(Components[3]));
+            return true;
+        }
+
+        case EUmgPropertyAccessKind::Color:
+        {
+            FColor& Color = *static_cast<FColor*>(ValuePtr);
+            double Components[4] = { static_cast<double>(Color.R), static_cast<double>(Color.G), static_cast<double>(Color.B), static_cast<double>(Color.A) };
+            if (!ReadJsonComponents(Value, ColorNames, 3, Components))
+            {
+                return false;
+            }
+            Color = FColor(
+                static_cast<uint8>(FMath::Clamp(Components[0], 0.0, 255.0)),
+                static_cast<uint8>(FMath::Clamp(Components[1], 0.0, 255.0)),
+                static_cast<uint8>(FMath::Clamp(Components[2], 0.0, 255.0)),
+                static_cast<uint8>(FMath::Clamp(Components[3], 0.0, 255.0)));
+            return true;
+        }
+
+        case EUmgPropertyAccessKind::Margin:
+        {
+            FMargin& Margin = *static_cast<FMargin*>(ValuePtr);
+            if (Value->Type == EJson::Number)
+            {
+                Margin = FMargin(static_cast<float>(Value->AsNumber()));
+                return true;
+            }
+            if (Value->Type == EJson::Array && Value->AsArray().Num() == 2)
+            {
+                double Components[2] = { 0.0, 0.0 };
+                if (!ReadJsonComponents(Value, VectorNames, 2, Components))
+                {
+                    return false;
+                }
+                Margin = FMargin(static_cast<float>(Components[0]), static_cast<float>(Components[1]));
+                return true;
+            }
+            double Components[4] = { Margin.Left, Margin.Top, Margin.Right, Margin.Bottom };
+            if (!ReadJsonComponents(Value, MarginNames, 4, Components))
+            {
+                return false;
+            }
+            Margin = FMargin(static_cast<float>(Components[0]), static_cast<float>(Components[1]), static_cast<float>(Components[2]), static_cast<float>(Components[3]));
+            return true;
+        }
+
+        case EUmgPropertyAccessKind::Vector2D:
+        {
+            FVector2D& Vector = *static_cast<FVector2D*>(ValuePtr);
+            double Components[2] = { Vector.X, Vector.Y };
+            if (!ReadJsonComponents(Value, TConstArrayView<const TCHAR*>(VectorNames, 2), 2, Components))
+            {
+                return false;
+            }
+            Vector = FVector2D(Components[0], Components[1]);
+            return true;
+        }
+
+        case EUmgPropertyAccessKind::Vector:
+        {
+            FVector& Vector = *static_cast<FVector*>(ValuePtr);
+            double Components[3] = { Vector.X, Vector.Y, Vector.Z };
+            if (!ReadJsonComponents(Value, VectorNames, 3, Components))
+            {
+                return false;
+            }
+            Vector = FVector(Components[0], Components[1], Components[2]);
+            return true;
+        }
+
+        default:
+            return false;
+        }
+    }
+}
+
+FUmgPropertyPathCache& FUmgPropertyPathCache::Get()
+{
+    static FUmgPropertyPathCache Instance;
+    return Instance;
+}
+
+FUmgResolvedPropertyKey FUmgPropertyPathCache::BuildResolvedKey(const UStruct* OwnerStruct, FStringView RawKey)
+{
+    FUmgResolvedPropertyKey Result;
+    TStringBuilder<128> Normalized;
+    const UStruct* Owner = OwnerStruct;
+
+    // Dotted keys (e.g. "slot.position") are resolved one segment at a time; empty segments are dropped.
+    int32 SegmentStart = 0;
+    for (int32 Index = 0; Index <= RawKey.Len(); ++Index)
+    {
+        if (Index < RawKey.Len() && RawKey[Index] != TEXT('.'))
+        {
+            continue;
+        }
+        if (Index > SegmentStart)
+        {
+            const FStringView Segment = RawKey.Mid(SegmentStart, Index - SegmentStart);
+            if (Normalized.Len() > 0)
+            {
+                Normalized.AppendChar(TEXT('.'));
+            }
+
+            // Once a segment fails to resolve Owner is cleared, so the remaining ones only get the textual normalization.
+            FProperty* Property = FindPropertyForSegment(Owner, Segment);
+            if (Property)
+            {
+                Result.PropertyChain.Add(Property);
+                Property->GetFName().AppendString(Normalized);
+                Owner = GetValueOwner(Property);
+            }
+            else
+            {
+                AppendNormalizedPropertyName(Normalized, Segment);
+                Owner = nullptr;
+            }
+            ++Result.SegmentCount;
+        }
+        SegmentStart = Index + 1;
+    }
+
+    Result.NormalizedKey = FString(Normalized.ToView());
+    Result.ValueOwner = Result.IsFullyResolved() ? Owner : nullptr;
+
+    // Fold the chain into a single offset when it only crosses inline structs; object hops need a runtime dereference.
+    if (Result.IsFullyResolved())
+    {
+        int32 Offset = 0;
+        bool bInline = true;
+        for (int32 Index = 0; Index < Result.PropertyChain.Num(); ++Index)
+        {
+            const FProperty* Property = Result.PropertyChain[Index];
+            Offset += Property->GetOffset_ForInternal();
+            if (Index + 1 < Result.PropertyChain.Num() && !Property->IsA<FStructProperty>())
+            {
+                bInline = false;
+                break;
+            }
+        }
+        if (bInline)
+        {
+            Result.LeafOffset = Offset;
+            Result.AccessKind = ClassifyLeaf(Result.PropertyChain.Last());
+        }
+    }
+    return Result;
+}
+
+TSharedRef<const FUmgResolvedPropertyKey> FUmgPropertyPathCache::ResolveKey(const UStruct* OwnerStruct, FStringView RawKey)
+{
+    const FObjectKey OwnerKey(OwnerStruct);
+    const uint32 KeyHash = GetTypeHash(RawKey);
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (const FKeyTable* Table = Tables.Find(OwnerKey))
+        {
+            if (const FEntryRef* Entry = Table->FindByHash(KeyHash, RawKey))
+            {
+                return *Entry;
+            }
+        }
+    }
+
+    FEntryRef NewEntry = MakeShared<const FUmgResolvedPropertyKey>(BuildResolvedKey(OwnerStruct, RawKey));
+
+    FWriteScopeLock WriteLock(Lock);
+    FKeyTable& Table = Tables.FindOrAdd(OwnerKey);
+    if (const FEntryRef* Existing = Table.FindByHash(KeyHash, RawKey))
+    {
+        return *Existing;
+    }
+    return Table.Emplace(FString(RawKey), MoveTemp(NewEntry));
+}
+
+void FUmgPropertyPathCache::NormalizeJsonKeysInPlace(const TSharedPtr<FJsonObject>& JsonObject, const UStruct* OwnerStruct)
+{
+    if (!JsonObject.IsValid())
+    {
+        return;
+    }
+
+    FMemMark ScratchMark(FMemStack::Get());
+    TUmgMcpScratchArray<TPair<FString, FEntryRef>> Renames;
+
+    for (const auto& Pair : JsonObject->Values)
+    {
+        const FStringView RawKey = UmgMcpJsonCompat::KeyToView(Pair.Key);
+        FEntryRef Resolved = ResolveKey(OwnerStruct, RawKey);
+
+        const TSharedPtr<FJsonValue>& Value = Pair.Value;
+        if (Value.IsValid() && Value->Type == EJson::Object)
+        {
+            NormalizeJsonKeysInPlace(Value->AsObject(), Resolved->ValueOwner);
+        }
+        else if (Value.IsValid() && Value->Type == EJson::Array)
+        {
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+            {
+                if (Element.IsValid() && Element->Type == EJson::Object)
+                {
+                    NormalizeJsonKeysInPlace(Element->AsObject(), Resolved->ValueOwner);
+                }
+            }
+        }
+
+        if (!RawKey.Equals(Resolved->NormalizedKey, ESearchCase::CaseSensitive))
+        {
+            Renames.Emplace(FString(RawKey), MoveTemp(Resolved));
+        }
+    }
+
+    for (const TPair<FString, FEntryRef>& Rename : Renames)
+    {
+        TSharedPtr<FJsonValue> Value = JsonObject->TryGetField(Rename.Key);
+        JsonObject->RemoveField(Rename.Key);
+        JsonObject->SetField(Rename.Value->NormalizedKey, Value);
+    }
+}
+
+bool FUmgPropertyPathCache::WriteJsonValue(const FUmgResolvedPropertyKey& Path, void* Container, const TSharedPtr<FJsonValue>& Value)
+{
+    if (!Path.HasDirectAccess() || !Container || !Value.IsValid())
+    {
+        return false;
+    }
+
+    FProperty* Leaf = Path.PropertyChain.Last();
+    void* ValuePtr = static_cast<uint8*>(Container) + Path.LeafOffset;
+    if (WriteTypedValue(Path.AccessKind, Leaf, ValuePtr, Value))
+    {
+        return true;
+    }
+
+    // Exotic types and unusual encodings (hex colors, numeric strings, ImportText syntax) keep the converter's rules.
+    return FJsonObjectConverter::JsonValueToUProperty(Value, Leaf, ValuePtr, 0, 0);
+}
+
+TSharedPtr<FJsonValue> FUmgPropertyPathCache::ReadJsonValue(const FUmgResolvedPropertyKey& Path, const void* Container)
+{
+    if (!Path.HasDirectAccess() || !Container)
+    {
+        return nullptr;
+    }
+
+    static const TCHAR* ColorKeys[] = { TEXT("r"), TEXT("g"), TEXT("b"), TEXT("a") };
+    static const TCHAR* MarginKeys[] = { TEXT("left"), TEXT("top"), TEXT("right"), TEXT("bottom") };
+    static const TCHAR* VectorKeys[] = { TEXT("x"), TEXT("y"), TEXT("z") };
+
+    const FProperty* Leaf = Path.PropertyChain.Last();
+    const void* ValuePtr = static_cast<const uint8*>(Container) + Path.LeafOffset;
+    switch (Path.AccessKind)
+    {
+    case EUmgPropertyAccessKind::Bool:
+        return MakeShared<FJsonValueBoolean>(CastFieldChecked<FBoolProperty>(Leaf)->GetPropertyValue(ValuePtr));
+
+    case EUmgPropertyAccessKind::Numeric:
+    {
+        const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Leaf);
+        return MakeShared<FJsonValueNumber>(NumericProperty->IsFloatingPoint()
+            ? NumericProperty->GetFloatingPointPropertyValue(ValuePtr)
+            : static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr)));
+    }
+
+    case EUmgPropertyAccessKind::Enum:
+    {
+        const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Leaf);
+        const FNumericProperty* Underlying = EnumProperty ? EnumProperty->GetUnderlyingProperty() : CastFieldChecked<FNumericProperty>(Leaf);
+        const UEnum* Enum = EnumProperty ? EnumProperty->GetEnum() : Underlying->GetIntPropertyEnum();
+        return MakeShared<FJsonValueString>(Enum->GetAuthoredNameStringByValue(Underlying->GetSignedIntPropertyValue(ValuePtr)));
+    }
+
+    case EUmgPropertyAccessKind::LinearColor:
+    {
+        const FLinearColor& Color = *static_cast<const FLinearColor*>(ValuePtr);
+        const double Components[4] = { Color.R, Color.G, Color.B, Color.A };
+        return MakeComponentsJson(ColorKeys, Components);
+    }
+
+    case EUmgPropertyAccessKind::Margin:
+    {
+        const FMargin& Margin = *static_cast<const FMargin*>(ValuePtr);
+        const double Components[4] = { Margin.Left, Margin.Top, Margin.Right, Margin.Bottom };
+        return MakeComponentsJson(MarginKeys, Components);
+    }
+
+    case EUmgPropertyAccessKind::Vector2D:
+    {
+        const FVector2D& Vector = *static_cast<const FVector2D*>(ValuePtr);
+        const double Components[2] = { Vector.X, Vector.Y };
+        return MakeComponentsJson(TConstArrayView<const TCHAR*>(VectorKeys, 2), Components);
+    }
+
+    case EUmgPropertyAccessKind::Vector:
+    {
+        const FVector& Vector = *static_cast<const FVector*>(ValuePtr);
+        const double Components[3] = { Vector.X, Vector.Y, Vector.Z };
+        return MakeComponentsJson(VectorKeys, Components);
+    }
+
+    default:
+        // FColor keeps the converter so its B,G,R,A declaration order is preserved in the output.
+        return FJsonObjectConverter::UPropertyToJsonValue(const_cast<FProperty*>(Leaf), ValuePtr);
+    }
+}
+
+void FUmgPropertyPathCache::Invalidate()
+{
+    FWriteScopeLock WriteLock(Lock);
+    Tables.Reset();
+}
+
+void FUmgPropertyPathCache::RegisterInvalidationHooks()
+{
+    if (GEditor && !BlueprintCompiledHandle.IsValid())
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FUmgPropertyPathCache::Invalidate);
+    }
+    if (!ObjectsReinstancedHandle.IsValid())
+    {
+        ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([this](const TMap<UObject*, UObject*>&)
+        {
+            Invalidate();
+        });
+    }
+    if (!ReloadCompleteHandle.IsValid())
+    {
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+        {
+            Invalidate();
+        });
+    }
+}
+
+void FUmgPropertyPathCache::UnregisterInvalidationHooks()
+{
+    if (GEditor && BlueprintCompiledHandle.IsValid())
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    BlueprintCompiledHandle.Reset();
+    FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+    ObjectsReinstancedHandle.Reset();
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    ReloadCompleteHandle.Reset();
+    Invalidate();
+}
@@ -15,8 +15,17 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "FileHelpers.h"
+#include "FileManage/UmgExportPlanCache.h"
 #include "FileManage/UmgFileTransformation.h"
+#include "Widget/UmgAssetPreloader.h"
+#include "Widget/UmgOrderPlanner.h"
+#include "Widget/UmgPropertyPathCache.h"
+#include "Widget/UmgWidgetIndex.h"
+#include "Widget/UmgWidgetClassResolver.h"
 #include "Components/CanvasPanelSlot.h"
+#include "Blueprint/UserWidget.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "WidgetBlueprintEditor.h"
 
 DEFINE_LOG_CATEGORY(LogUmgSet);
 
@@ -289,7 +298,7 @@ namespace
         UWidget* Widget = nullptr;
         if (!PanelName.IsEmpty())
         {
-            Widget = WidgetBlueprint->WidgetTree->FindWidget(FName(*PanelName));
+            Widget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, PanelName);
         }
 
         if (!Widget && (PanelName.IsEmpty() || PanelName.Equals(TEXT("root"), ESearchCase::IgnoreCase)))
@@ -381,36 +390,29 @@ namespace
 #endif
     }
 
-    static UWidget* FindDirectChildByName(UPanelWidget* ParentPanel, const FString& ChildName, int32& OutIndex)
+    static void ApplyOrderNode(UPanelWidget* ParentPanel, const FWidgetOrderNode& ParentOrder, TArray<FString>& OutReorderedWidgets, TArray<FString>& OutWarnings)
     {
-        OutIndex = INDEX_NONE;
         if (!ParentPanel)
         {
-            return nullptr;
+            return;
         }
 
-        for (int32 Index = 0; Index < ParentPanel->GetChildrenCount(); ++Index)
+        const int32 ChildCount = ParentPanel->GetChildrenCount();
+        TMap<FString, UWidget*> ChildrenByName;
+        ChildrenByName.Reserve(ChildCount);
+        for (int32 Index = 0; Index < ChildCount; ++Index)
         {
-            UWidget* Child = ParentPanel->GetChildAt(Index);
-            if (Child && Child->GetName().Equals(ChildName, ESearchCase::IgnoreCase))
+            if (UWidget* Child = ParentPanel->GetChildAt(Index))
             {
-                OutIndex = Index;
-                return Child;
+                ChildrenByName.Add(Child->GetName().ToLower(), Child);
             }
         }
 
-        return nullptr;
-    }
-
-    static void ApplyOrderNode(UPanelWidget* ParentPanel, const FWidgetOrderNode& ParentOrder, TArray<FString>& OutReorderedWidgets, TArray<FString>& OutWarnings)
-    {
-        if (!ParentPanel)
-        {
-            return;
-        }
-
+        // Requested order: listed children first, then the unlisted ones in their current relative order.
+        TArray<UWidget*> FinalOrder;
+        FinalOrder.Reserve(ChildrenByName.Num());
+        TSet<UWidget*> ListedChildren;
         TSet<FString> SeenNames;
-        int32 TargetIndex = 0;
         for (const FWidgetOrderNode& ChildOrder : ParentOrder.Children)
         {
             if (ChildOrder.Name.IsEmpty())
@@ -426,29 +428,44 @@ namespace
             }
             SeenNames.Add(Key);
 
-            int32 CurrentIndex = INDEX_NONE;
-            UWidget* Child = FindDirectChildByName(ParentPanel, ChildOrder.Name, CurrentIndex);
+            UWidget* const* Child = ChildrenByName.Find(Key);
             if (!Child)
             {
                 OutWarnings.Add(FString::Printf(TEXT("Child '%s' is not a direct child of '%s'; skipped."), *ChildOrder.Name, *ParentPanel->GetName()));
                 continue;
             }
 
-            if (CurrentIndex != TargetIndex)
+            FinalOrder.Add(*Child);
+            ListedChildren.Add(*Child);
+        }
+
+        for (int32 Index = 0; Index < ChildCount; ++Index)
+        {
+            UWidget* Child = ParentPanel->GetChildAt(Index);
+            if (Child && !ListedChildren.Contains(Child))
             {
-                ParentPanel->Modify();
-                Child->Modify();
-                if (Child->Slot)
-                {
-                    Child->Slot->Modify();
-                }
-                ParentPanel->ShiftChild(TargetIndex, Child);
-                OutReorderedWidgets.Add(FString::Printf(TEXT("%s -> %s[%d]"), *Child->GetName(), *ParentPanel->GetName(), TargetIndex));
+                FinalOrder.Add(Child);
             }
-
-            ++TargetIndex;
         }
 
+        // Children already in the requested relative order stay put; only the rest are shifted, so slot data
+        // and the undo buffer are touched for the widgets that actually move.
+        bool bPanelModified = false;
+        FUmgOrderPlanner::ApplyOrder(ParentPanel, FinalOrder, [ParentPanel, &bPanelModified, &OutReorderedWidgets](UWidget* Child, int32 Position)
+        {
+            if (!bPanelModified)
+            {
+                ParentPanel->Modify();
+                bPanelModified = true;
+            }
+            Child->Modify();
+            if (Child->Slot)
+            {
+                Child->Slot->Modify();
+            }
+            OutReorderedWidgets.Add(FString::Printf(TEXT("%s -> %s[%d]"), *Child->GetName(), *ParentPanel->GetName(), Position));
+        });
+
         for (const FWidgetOrderNode& ChildOrder : ParentOrder.Children)
         {
             if (ChildOrder.Children.Num() == 0)
@@ -456,9 +473,8 @@ namespace
                 continue;
             }
 
-            int32 ChildIndex = INDEX_NONE;
-            UWidget* Child = FindDirectChildByName(ParentPanel, ChildOrder.Name, ChildIndex);
-            UPanelWidget* ChildPanel = Cast<UPanelWidget>(Child);
+            UWidget* const* Child = ChildrenByName.Find(ChildOrder.Name.ToLower());
+            UPanelWidget* ChildPanel = Child ? Cast<UPanelWidget>(*Child) : nullptr;
             if (!ChildPanel)
             {
                 OutWarnings.Add(FString::Printf(TEXT("Child '%s' under '%s' has nested order entries but is not a panel."), *ChildOrder.Name, *ParentPanel->GetName()));
@@ -473,49 +489,71 @@ namespace
 void UUmgSetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
+    FUmgPropertyPathCache::Get().RegisterInvalidationHooks();
     UE_LOG(LogUmgSet, Warning, TEXT("UmgSetSubsystem Initialized."));
 }
 
 void UUmgSetSubsystem::Deinitialize()
 {
+    FUmgPropertyPathCache::Get().UnregisterInvalidationHooks();
+    FUmgWidgetIndexCache::Get().Reset();
+    FUmgWidgetClassResolver::Get().Reset();
+    FUmgAssetPreloader::Get().Reset();
+    FUmgExportPlanCache::Get().Reset();
     UE_LOG(LogUmgSet, Log, TEXT("UmgSetSubsystem Deinitialized."));
     Super::Deinitialize();
 }
 
-// Removed redundant NormalizeJsonKeysToPascalCase implementation, now using UUmgFileTransformation::NormalizeJsonKeysToPascalCase
-
-bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName, const FString& PropertiesJson)
+namespace
 {
-    if (!WidgetBlueprint)
+    // Top-level reflected properties written by one ApplyWidgetPropertiesJson call.
+    struct FAppliedWidgetProperties
     {
-        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: Received a null WidgetBlueprint."));
-        return false;
-    }
+        TArray<FProperty*, TInlineAllocator<8>> WidgetProperties;
+        TArray<FProperty*, TInlineAllocator<8>> SlotProperties;
+    };
 
-    if (!WidgetBlueprint->WidgetTree)
+    static void AddAppliedProperty(FUmgPropertyPathCache& PathCache, const UClass* OwnerClass, FStringView Key, TArray<FProperty*, TInlineAllocator<8>>& OutProperties)
     {
-        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: WidgetTree is null for asset '%s'."), *WidgetBlueprint->GetPathName());
-        return false;
+        const TSharedRef<const FUmgResolvedPropertyKey> Resolved = PathCache.ResolveKey(OwnerClass, Key);
+        if (Resolved->PropertyChain.Num() > 0)
+        {
+            OutProperties.AddUnique(Resolved->PropertyChain[0]);
+        }
     }
 
-    UWidget* FoundWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName));
-    if (!FoundWidget)
+    // Writes one top-level key through its compiled path. Keys the cache could not resolve keep
+    // FJsonObjectConverter's own matching (case-insensitive name or authored name), as JsonObjectToUStruct applied them.
+    static bool WriteTopLevelValue(FUmgPropertyPathCache& PathCache, UObject* Target, FStringView Key, const TSharedPtr<FJsonValue>& Value)
     {
-        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: Failed to find widget '%s' in asset '%s'."), *WidgetName, *WidgetBlueprint->GetPathName());
-        return false;
-    }
+        const TSharedRef<const FUmgResolvedPropertyKey> CompiledPath = PathCache.ResolveKey(Target->GetClass(), Key);
+        if (CompiledPath->HasDirectAccess())
+        {
+            return FUmgPropertyPathCache::WriteJsonValue(*CompiledPath, Target, Value);
+        }
 
-    TSharedPtr<FJsonObject> PropertiesJsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(PropertiesJson);
-    if (!FJsonSerializer::Deserialize(Reader, PropertiesJsonObject) || !PropertiesJsonObject.IsValid())
-    {
-        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: Failed to parse PropertiesJson string."));
+        for (TFieldIterator<FProperty> It(Target->GetClass()); It; ++It)
+        {
+            if (Key.Equals(It->GetName(), ESearchCase::IgnoreCase) || Key.Equals(It->GetAuthoredName(), ESearchCase::IgnoreCase))
+            {
+                return FJsonObjectConverter::JsonValueToUProperty(Value, *It, It->ContainerPtrToValuePtr<void>(Target), 0, 0);
+            }
+        }
         return false;
     }
+}
+
+// Applies a set_widget_properties payload to one widget and its slot. PropertiesJsonObject is rewritten in place.
+// The caller owns WidgetBlueprint->Modify() and the modification notice, so batches can issue them once.
+static void ApplyWidgetPropertiesJson(UWidget* FoundWidget, const TSharedPtr<FJsonObject>& PropertiesJsonObject, FAppliedWidgetProperties* OutApplied = nullptr)
+{
+    const FString WidgetName = FoundWidget->GetName();
 
-    // Normalize JSON keys from camelCase to PascalCase (especially important for Slot properties)
+    // Normalize JSON keys from camelCase to PascalCase (especially important for Slot properties).
+    // The parsed object is private to this call, so keys are rewritten in place against the widget class.
     UE_LOG(LogUmgSet, Log, TEXT("SetWidgetProperties: Normalizing property keys for widget '%s'"), *WidgetName);
-    TSharedPtr<FJsonObject> NormalizedProperties = UUmgFileTransformation::NormalizeJsonKeysToPascalCase(PropertiesJsonObject);
+    UUmgFileTransformation::NormalizeJsonKeysInPlace(PropertiesJsonObject, FoundWidget->GetClass());
+    TSharedPtr<FJsonObject> NormalizedProperties = PropertiesJsonObject;
     
     // 2. Extract and expand aliases in NormalizedProperties
     TArray<FString> CurrentKeys;
@@ -592,8 +630,25 @@ bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, co
     {
         SlotProperties = NormalizedProperties->GetObjectField(TEXT("Slot"));
         NormalizedProperties->RemoveField(TEXT("Slot"));
+        if (FoundWidget->Slot)
+        {
+            // Resolved against UPanelSlot above; re-key against the concrete slot class so nested fields map exactly.
+            UUmgFileTransformation::NormalizeJsonKeysInPlace(SlotProperties, FoundWidget->Slot->GetClass());
+        }
     }
 
+    // Dotted leaves that compile to a fixed offset (e.g. "Slot.LayoutData.Offsets.Left") are written directly
+    // after everything else, so they keep overriding the nested objects they would otherwise be merged into.
+    struct FCompiledWrite
+    {
+        UObject* Target = nullptr;
+        // Shared so the entry outlives a cache flush triggered by asset loads in between.
+        TSharedPtr<const FUmgResolvedPropertyKey> Path;
+        TSharedPtr<FJsonValue> Value;
+    };
+    TArray<FCompiledWrite> CompiledWrites;
+    FUmgPropertyPathCache& PathCache = FUmgPropertyPathCache::Get();
+
     // Re-scan for any dotted keys (including expanded aliases)
     CurrentKeys.Reset();
     for (const auto& Pair : NormalizedProperties->Values)
@@ -610,6 +665,20 @@ bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, co
                 continue;
             }
 
+            const bool bSlotKey = FullKey.StartsWith(TEXT("Slot."), ESearchCase::IgnoreCase);
+            UObject* CompiledTarget = bSlotKey ? static_cast<UObject*>(FoundWidget->Slot.Get()) : static_cast<UObject*>(FoundWidget);
+            if (CompiledTarget)
+            {
+                const FStringView RelativeKey = bSlotKey ? FStringView(FullKey).RightChop(5) : FStringView(FullKey);
+                TSharedRef<const FUmgResolvedPropertyKey> CompiledPath = PathCache.ResolveKey(CompiledTarget->GetClass(), RelativeKey);
+                if (CompiledPath->HasDirectAccess())
+                {
+                    CompiledWrites.Add({ CompiledTarget, CompiledPath, SourceValue });
+                    NormalizedProperties->RemoveField(FullKey);
+                    continue;
+                }
+            }
+
             TArray<FString> Parts;
             FullKey.ParseIntoArray(Parts, TEXT("."));
             
@@ -649,7 +718,6 @@ bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, co
         UE_LOG(LogUmgSet, Log, TEXT("SetWidgetProperties: Final Slot JSON for '%s': %s"), *WidgetName, *SlotJsonString);
     }
 
-    WidgetBlueprint->Modify();
     FoundWidget->Modify();
 
     // REFINED STRATEGY: Intercept Brush.ResourceObject specifically as it's the #1 cause of failure.
@@ -659,7 +727,7 @@ bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, co
         if (BrushObj->HasField(TEXT("ResourceObject")))
         {
             FString Path = BrushObj->GetStringField(TEXT("ResourceObject"));
-            UObject* MatAsset = LoadObject<UObject>(nullptr, *Path);
+            UObject* MatAsset = FUmgAssetPreloader::Get().ResolveObjectPath(Path);
             if (MatAsset)
             {
                 // We use reflection to set it directly to avoid converter issues
@@ -679,153 +747,197 @@ bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, co
         }
     }
 
-    // 4. Apply widget properties (excluding Slot)
+    // 4. Apply widget properties (excluding Slot) through compiled accessors.
+    // Object properties given as strings are resolved with LoadObject; exotic types fall back to the converter per field.
     if (NormalizedProperties->Values.Num() > 0)
     {
         for (const auto& Pair : NormalizedProperties->Values)
         {
-            const FString PropertyName = UmgMcpJsonCompat::KeyToString(Pair.Key);
-            FProperty* Prop = FoundWidget->GetClass()->FindPropertyByName(FName(*PropertyName));
-            if (!Prop) continue;
-
-            // SPECIAL CASE: Auto-resolve Object Pointers from paths
-            if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Prop))
+            const FStringView Key = UmgMcpJsonCompat::KeyToView(Pair.Key);
+            if (!WriteTopLevelValue(PathCache, FoundWidget, Key, Pair.Value))
             {
-                if (Pair.Value->Type == EJson::String)
-                {
-                    FString ObjectPath = Pair.Value->AsString();
-                    UObject* ResolvedObj = LoadObject<UObject>(nullptr, *ObjectPath);
-                    if (ResolvedObj)
-                    {
-                        ObjProp->SetObjectPropertyValue(ObjProp->ContainerPtrToValuePtr<void>(FoundWidget), ResolvedObj);
-                        continue;
-                    }
-                }
+                UE_LOG(LogUmgSet, Warning, TEXT("SetWidgetProperties: Could not apply '%.*s' to widget '%s'."), Key.Len(), Key.GetData(), *WidgetName);
             }
-
-            // Fallback: Use standard converter for this specific field
-            TSharedPtr<FJsonObject> SinglePropJson = MakeShared<FJsonObject>();
-            SinglePropJson->SetField(PropertyName, Pair.Value);
-            FJsonObjectConverter::JsonObjectToUStruct(SinglePropJson.ToSharedRef(), FoundWidget->GetClass(), FoundWidget, 0, 0);
         }
     }
     
     // Apply Slot properties separately (CRITICAL: must apply to Slot object, not Widget object)
-    if (SlotProperties.IsValid() && FoundWidget->Slot)
+    if (FoundWidget->Slot && (SlotProperties->Values.Num() > 0 || CompiledWrites.ContainsByPredicate([FoundWidget](const FCompiledWrite& Write) { return Write.Target == FoundWidget->Slot.Get(); })))
     {
         UE_LOG(LogUmgSet, Log, TEXT("SetWidgetProperties: Applying Slot properties to Slot object (class: %s)"), *FoundWidget->Slot->GetClass()->GetName());
         FoundWidget->Slot->Modify();
 
-        // Standard converter is usually fine for Slots (mostly numeric/enums)
-        FJsonObjectConverter::JsonObjectToUStruct(SlotProperties.ToSharedRef(), FoundWidget->Slot->GetClass(), FoundWidget->Slot, 0, 0);
+        for (const auto& Pair : SlotProperties->Values)
+        {
+            const FStringView Key = UmgMcpJsonCompat::KeyToView(Pair.Key);
+            if (!WriteTopLevelValue(PathCache, FoundWidget->Slot, Key, Pair.Value))
+            {
+                UE_LOG(LogUmgSet, Warning, TEXT("SetWidgetProperties: Could not apply slot property '%.*s' to widget '%s'."), Key.Len(), Key.GetData(), *WidgetName);
+            }
+        }
     }
-
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
-    return true;
-}
-
-FString UUmgSetSubsystem::CreateWidget(UWidgetBlueprint* WidgetBlueprint, const FString& ParentName, const FString& WidgetType, const FString& WidgetName)
-{
-    if (!WidgetBlueprint)
+    else if (!FoundWidget->Slot && SlotProperties->Values.Num() > 0)
     {
-        UE_LOG(LogUmgSet, Error, TEXT("CreateWidget: Received a null WidgetBlueprint."));
-        return FString();
+        UE_LOG(LogUmgSet, Warning, TEXT("SetWidgetProperties: Widget '%s' has no slot; %d slot properties were not applied."), *WidgetName, SlotProperties->Values.Num());
     }
 
-    if (!WidgetBlueprint->WidgetTree)
+    for (const FCompiledWrite& Write : CompiledWrites)
     {
-        UE_LOG(LogUmgSet, Error, TEXT("CreateWidget: WidgetTree is null for asset '%s'."), *WidgetBlueprint->GetPathName());
-        return FString();
-    }
-
-    // Load widget class first to check if it's valid
-    // 1. Try finding/loading as a fully qualified path (if provided)
-    UClass* WidgetClass = nullptr;
-    if (WidgetType.Contains(TEXT("/")))
-    {
-        WidgetClass = FindObject<UClass>(nullptr, *WidgetType);
-        if (!WidgetClass)
+        if (!FUmgPropertyPathCache::WriteJsonValue(*Write.Path, Write.Target, Write.Value))
         {
-            WidgetClass = LoadObject<UClass>(nullptr, *WidgetType);
+            UE_LOG(LogUmgSet, Warning, TEXT("SetWidgetProperties: Could not apply '%s' to '%s'."), *Write.Path->NormalizedKey, *Write.Target->GetName());
         }
     }
 
-    // 1.5 Special handling for Blueprint Asset Paths (e.g. /Game/UI/MyWidget)
-    // If we failed to find it as a direct class, and it looks like a content path, try appending _C
-    // This allows users/AI to pass the Asset Path (from list_assets) directly without knowing about _C.
-    if (!WidgetClass && WidgetType.StartsWith(TEXT("/Game")))
+    if (OutApplied)
     {
-        FString ClassPath = WidgetType;
-        if (!ClassPath.EndsWith(TEXT("_C")))
+        for (const auto& Pair : NormalizedProperties->Values)
         {
-            ClassPath += TEXT("_C");
+            AddAppliedProperty(PathCache, FoundWidget->GetClass(), UmgMcpJsonCompat::KeyToView(Pair.Key), OutApplied->WidgetProperties);
         }
-        
-        WidgetClass = FindObject<UClass>(nullptr, *ClassPath);
-        if (!WidgetClass)
+        if (FoundWidget->Slot)
         {
-            // Note: LoadObject might trigger a load of the package
-            WidgetClass = LoadObject<UClass>(nullptr, *ClassPath);
+            for (const auto& Pair : SlotProperties->Values)
+            {
+                AddAppliedProperty(PathCache, FoundWidget->Slot->GetClass(), UmgMcpJsonCompat::KeyToView(Pair.Key), OutApplied->SlotProperties);
+            }
         }
-        
-        if (WidgetClass)
+        for (const FCompiledWrite& Write : CompiledWrites)
         {
-            UE_LOG(LogUmgSet, Log, TEXT("CreateWidget: Resolved Blueprint Asset '%s' to Class '%s'"), *WidgetType, *ClassPath);
+            TArray<FProperty*, TInlineAllocator<8>>& Touched = Write.Target == FoundWidget ? OutApplied->WidgetProperties : OutApplied->SlotProperties;
+            Touched.AddUnique(Write.Path->PropertyChain[0]);
         }
     }
+}
 
-    // 1. Check if widget already exists to prevent duplicates or recursive loops
-    if (UWidget* ExistingWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName)))
+// Toggling bIsVariable adds or removes a member variable on the generated class.
+static bool IsStructuralWidgetProperty(const FProperty* Property)
+{
+    static const FName IsVariableName(TEXT("bIsVariable"));
+    return Property->GetFName() == IsVariableName;
+}
+
+// Instanced subobjects cannot be copied by value onto the preview; their owner must be rebuilt instead.
+static bool CanCopyToPreview(const FProperty* Property)
+{
+    return !Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference | CPF_PersistentInstance);
+}
+
+static bool CopyPropertiesToPreview(UObject* Template, UObject* Preview, TConstArrayView<FProperty*> Properties)
+{
+    if (!Template || !Preview || Template->GetClass() != Preview->GetClass())
     {
-        UE_LOG(LogUmgSet, Log, TEXT("CreateWidget: Widget '%s' already exists in '%s'. Skipping creation."), *WidgetName, *WidgetBlueprint->GetName());
-        return WidgetName;
+        return Properties.Num() == 0;
     }
 
-    // 2. If not found or simple name, try native UMG paths
-    if (!WidgetClass)
+    for (const FProperty* Property : Properties)
     {
-        // Try /Script/UMG.WidgetType
-        FString NativePath = FString::Printf(TEXT("/Script/UMG.%s"), *WidgetType);
-        WidgetClass = FindObject<UClass>(nullptr, *NativePath);
-        if (!WidgetClass)
+        if (!CanCopyToPreview(Property))
         {
-             WidgetClass = LoadObject<UClass>(nullptr, *NativePath);
+            return false;
         }
     }
 
-    // 3. Try /Script/UMG.UWidgetType (Reflection prefix)
-    if (!WidgetClass)
+    for (const FProperty* Property : Properties)
     {
-        FString NativePathU = FString::Printf(TEXT("/Script/UMG.U%s"), *WidgetType);
-        WidgetClass = FindObject<UClass>(nullptr, *NativePathU);
-         if (!WidgetClass)
-        {
-             WidgetClass = LoadObject<UClass>(nullptr, *NativePathU);
-        }
+        Property->CopyCompleteValue_InContainer(Preview, Template);
     }
+    return true;
+}
 
-    // 4. Last resort: Try LoadObject with the raw name (might cause 'Class None.X' warning but handles some edge cases)
-    if (!WidgetClass && !WidgetType.Contains(TEXT("/")))
+void UUmgSetSubsystem::SyncDesignerPreview(UWidgetBlueprint* WidgetBlueprint, UWidget* TemplateWidget, TConstArrayView<FProperty*> WidgetProperties, TConstArrayView<FProperty*> SlotProperties)
+{
+    if (!GEditor)
     {
-        WidgetClass = FindObject<UClass>(nullptr, *WidgetType);
-        if (!WidgetClass)
-        {
-            // Only call LoadObject if we really have to, as it might warn
-            WidgetClass = LoadObject<UClass>(nullptr, *WidgetType);
-        }
+        return;
     }
-    
-    if (!WidgetClass)
+
+    UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+    IAssetEditorInstance* EditorInstance = AssetEditorSubsystem ? AssetEditorSubsystem->FindEditorForAsset(WidgetBlueprint, false) : nullptr;
+    if (!EditorInstance || EditorInstance->GetEditorName() != FName(TEXT("WidgetBlueprintEditor")))
     {
-        UE_LOG(LogUmgSet, Error, TEXT("CreateWidget: Failed to find or load widget class '%s'."), *WidgetType);
-        return FString();
+        return;
     }
 
-    // Check if this is a request to create root widget (no existing root)
-    bool bCreatingRootWidget = false;
-    UPanelWidget* ParentWidget = nullptr;
+    FWidgetBlueprintEditor* WidgetEditor = static_cast<FWidgetBlueprintEditor*>(EditorInstance);
+    UUserWidget* Preview = WidgetEditor->GetPreview();
+    UWidget* PreviewWidget = Preview ? Preview->GetWidgetFromName(TemplateWidget->GetFName()) : nullptr;
 
-    // IMPLICIT PARENTING LOGIC
+    const bool bPatched = PreviewWidget
+        && CopyPropertiesToPreview(TemplateWidget, PreviewWidget, WidgetProperties)
+        && CopyPropertiesToPreview(TemplateWidget->Slot, PreviewWidget->Slot, SlotProperties);
+    if (!bPatched)
+    {
+        WidgetEditor->RefreshPreview();
+        return;
+    }
+
+    PreviewWidget->SynchronizeProperties();
+    if (PreviewWidget->Slot && SlotProperties.Num() > 0)
+    {
+        PreviewWidget->Slot->SynchronizeProperties();
+    }
+}
+
+bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName, const FString& PropertiesJson)
+{
+    EUmgModificationPath Path;
+    return SetWidgetProperties(WidgetBlueprint, WidgetName, PropertiesJson, Path);
+}
+
+bool UUmgSetSubsystem::SetWidgetProperties(UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName, const FString& PropertiesJson, EUmgModificationPath& OutPath)
+{
+    OutPath = EUmgModificationPath::Structural;
+    if (!WidgetBlueprint)
+    {
+        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: Received a null WidgetBlueprint."));
+        return false;
+    }
+
+    if (!WidgetBlueprint->WidgetTree)
+    {
+        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: WidgetTree is null for asset '%s'."), *WidgetBlueprint->GetPathName());
+        return false;
+    }
+
+    UWidget* FoundWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, WidgetName);
+    if (!FoundWidget)
+    {
+        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: Failed to find widget '%s' in asset '%s'."), *WidgetName, *WidgetBlueprint->GetPathName());
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> PropertiesJsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(PropertiesJson);
+    if (!FJsonSerializer::Deserialize(Reader, PropertiesJsonObject) || !PropertiesJsonObject.IsValid())
+    {
+        UE_LOG(LogUmgSet, Error, TEXT("SetWidgetProperties: Failed to parse PropertiesJson string."));
+        return false;
+    }
+
+    WidgetBlueprint->Modify();
+    const FName OriginalName = FoundWidget->GetFName();
+    FAppliedWidgetProperties Applied;
+    ApplyWidgetPropertiesJson(FoundWidget, PropertiesJsonObject, &Applied);
+
+    const bool bStructural = FoundWidget->GetFName() != OriginalName
+        || Applied.WidgetProperties.ContainsByPredicate([](const FProperty* Property) { return IsStructuralWidgetProperty(Property); });
+    if (bStructural)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+        return true;
+    }
+
+    // Values only: the generated class is unchanged, so skip skeleton regeneration and the full designer rebuild.
+    FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBlueprint);
+    SyncDesignerPreview(WidgetBlueprint, FoundWidget, Applied.WidgetProperties, Applied.SlotProperties);
+    OutPath = EUmgModificationPath::Property;
+    return true;
+}
+
+// IMPLICIT PARENTING LOGIC: an empty parent means the active widget scope, then the root widget.
+static FString ResolveImplicitParentName(UWidgetBlueprint* WidgetBlueprint, const FString& ParentName, const TCHAR* Context)
+{
     FString ActualParentName = ParentName;
     if (ActualParentName.IsEmpty())
     {
@@ -838,7 +950,7 @@ FString UUmgSetSubsystem::CreateWidget(UWidgetBlueprint* WidgetBlueprint, const
                 if (!ScopedWidgetName.IsEmpty())
                 {
                     ActualParentName = ScopedWidgetName;
-                    UE_LOG(LogUmgSet, Log, TEXT("CreateWidget: Implicit parent from Active Scope: '%s'"), *ActualParentName);
+                    UE_LOG(LogUmgSet, Log, TEXT("%s: Implicit parent from Active Scope: '%s'"), Context, *ActualParentName);
                 }
             }
         }
@@ -847,9 +959,47 @@ FString UUmgSetSubsystem::CreateWidget(UWidgetBlueprint* WidgetBlueprint, const
         if (ActualParentName.IsEmpty() && WidgetBlueprint->WidgetTree->RootWidget)
         {
             ActualParentName = WidgetBlueprint->WidgetTree->RootWidget->GetName();
-             UE_LOG(LogUmgSet, Log, TEXT("CreateWidget: Implicit parent from Root Widget: '%s'"), *ActualParentName);
+            UE_LOG(LogUmgSet, Log, TEXT("%s: Implicit parent from Root Widget: '%s'"), Context, *ActualParentName);
         }
     }
+    return ActualParentName;
+}
+
+FString UUmgSetSubsystem::CreateWidget(UWidgetBlueprint* WidgetBlueprint, const FString& ParentName, const FString& WidgetType, const FString& WidgetName)
+{
+    if (!WidgetBlueprint)
+    {
+        UE_LOG(LogUmgSet, Error, TEXT("CreateWidget: Received a null WidgetBlueprint."));
+        return FString();
+    }
+
+    if (!WidgetBlueprint->WidgetTree)
+    {
+        UE_LOG(LogUmgSet, Error, TEXT("CreateWidget: WidgetTree is null for asset '%s'."), *WidgetBlueprint->GetPathName());
+        return FString();
+    }
+
+    // 1. Check if widget already exists to prevent duplicates or recursive loops
+    if (UWidget* ExistingWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, WidgetName))
+    {
+        UE_LOG(LogUmgSet, Log, TEXT("CreateWidget: Widget '%s' already exists in '%s'. Skipping creation."), *WidgetName, *WidgetBlueprint->GetName());
+        return WidgetName;
+    }
+
+    // 2. Resolve the class from a short name, /Script/UMG path, class path or Blueprint asset path
+    UClass* WidgetClass = FUmgWidgetClassResolver::Get().Resolve(WidgetType);
+    if (!WidgetClass)
+    {
+        UE_LOG(LogUmgSet, Error, TEXT("CreateWidget: Failed to find or load widget class '%s'."), *WidgetType);
+        return FString();
+    }
+
+    // Check if this is a request to create root widget (no existing root)
+    bool bCreatingRootWidget = false;
+    UPanelWidget* ParentWidget = nullptr;
+
+    // IMPLICIT PARENTING LOGIC
+    const FString ActualParentName = ResolveImplicitParentName(WidgetBlueprint, ParentName, TEXT("CreateWidget"));
 
     if (!WidgetBlueprint->WidgetTree->RootWidget)
     {
@@ -871,7 +1021,7 @@ FString UUmgSetSubsystem::CreateWidget(UWidgetBlueprint* WidgetBlueprint, const
     if (!bCreatingRootWidget)
     {
         // Normal case: creating a child widget, need to find parent
-        ParentWidget = Cast<UPanelWidget>(WidgetBlueprint->WidgetTree->FindWidget(FName(*ActualParentName)));
+        ParentWidget = Cast<UPanelWidget>(FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, ActualParentName));
         if (!ParentWidget)
         {
             UE_LOG(LogUmgSet, Error, TEXT("CreateWidget: Failed to find ParentWidget with name '%s' in asset '%s'."), *ActualParentName, *WidgetBlueprint->GetPathName());
@@ -901,12 +1051,285 @@ FString UUmgSetSubsystem::CreateWidget(UWidgetBlueprint* WidgetBlueprint, const
         UE_LOG(LogUmgSet, Log, TEXT("CreateWidget: Successfully created '%s' as child of '%s'."), *WidgetName, *ActualParentName);
     }
 
+    FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
     EnsureSourceWidgetGuids(WidgetBlueprint);
 
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
     return NewWidget->GetName();
 }
 
+namespace
+{
+    struct FSubtreeNodePlan
+    {
+        TSharedPtr<FJsonObject> Spec;
+        UClass* WidgetClass = nullptr;
+        FName WidgetName;
+
+        /** Index of the parent node in the plan, or INDEX_NONE for nodes attached to the subtree parent. */
+        int32 ParentIndex = INDEX_NONE;
+    };
+
+    static bool CanAcceptChildren(const UClass* PanelClass, int32 ExistingChildren, int32 NewChildren)
+    {
+        const UPanelWidget* PanelDefaults = PanelClass ? Cast<UPanelWidget>(PanelClass->GetDefaultObject()) : nullptr;
+        return PanelDefaults && (PanelDefaults->CanHaveMultipleChildren() || ExistingChildren + NewChildren <= 1);
+    }
+
+    // Flattens one spec node and its children into OutPlan in pre-order, validating everything up front.
+    static bool PlanSubtreeNode(UWidgetBlueprint* WidgetBlueprint, const TSharedPtr<FJsonObject>& NodeSpec, int32 ParentIndex, const FString& NodePath, TSet<FName>& UsedNames, TArray<FSubtreeNodePlan>& OutPlan, FString& OutError)
+    {
+        if (!NodeSpec.IsValid())
+        {
+            OutError = FString::Printf(TEXT("Node %s is not an object."), *NodePath);
+            return false;
+        }
+
+        FString ClassName;
+        if (!NodeSpec->TryGetStringField(TEXT("class"), ClassName) && !NodeSpec->TryGetStringField(TEXT("widget_class"), ClassName))
+        {
+            NodeSpec->TryGetStringField(TEXT("widget_type"), ClassName);
+        }
+        if (ClassName.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("Node %s is missing 'class'."), *NodePath);
+            return false;
+        }
+
+        UClass* WidgetClass = FUmgWidgetClassResolver::Get().Resolve(ClassName);
+        if (!WidgetClass || !WidgetClass->IsChildOf(UWidget::StaticClass()) || WidgetClass->HasAnyClassFlags(CLASS_Abstract))
+        {
+            OutError = FString::Printf(TEXT("Node %s: '%s' is not a creatable widget class."), *NodePath, *ClassName);
+            return false;
+        }
+
+        FString WidgetNameString;
+        if (!NodeSpec->TryGetStringField(TEXT("name"), WidgetNameString))
+        {
+            NodeSpec->TryGetStringField(TEXT("widget_name"), WidgetNameString);
+        }
+
+        const FName WidgetName = WidgetNameString.IsEmpty() ? NAME_None : FName(*WidgetNameString);
+        if (!WidgetName.IsNone())
+        {
+            if (UsedNames.Contains(WidgetName) || FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, WidgetName))
+            {
+                OutError = FString::Printf(TEXT("Node %s: a widget named '%s' already exists."), *NodePath, *WidgetNameString);
+                return false;
+            }
+            UsedNames.Add(WidgetName);
+        }
+
+        const int32 NodeIndex = OutPlan.Num();
+        FSubtreeNodePlan& Plan = OutPlan.AddDefaulted_GetRef();
+        Plan.Spec = NodeSpec;
+        Plan.WidgetClass = WidgetClass;
+        Plan.WidgetName = WidgetName;
+        Plan.ParentIndex = ParentIndex;
+
+        const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+        if (!NodeSpec->TryGetArrayField(TEXT("children"), Children) || Children->Num() == 0)
+        {
+            return true;
+        }
+
+        if (!WidgetClass->IsChildOf(UPanelWidget::StaticClass()) || !CanAcceptChildren(WidgetClass, 0, Children->Num()))
+        {
+            OutError = FString::Printf(TEXT("Node %s: '%s' cannot hold %d children."), *NodePath, *ClassName, Children->Num());
+            return false;
+        }
+
+        for (int32 ChildIndex = 0; ChildIndex < Children->Num(); ++ChildIndex)
+        {
+            const TSharedPtr<FJsonValue>& ChildValue = (*Children)[ChildIndex];
+            const TSharedPtr<FJsonObject>* ChildSpec = nullptr;
+            const FString ChildPath = FString::Printf(TEXT("%s.children[%d]"), *NodePath, ChildIndex);
+            if (!ChildValue.IsValid() || !ChildValue->TryGetObject(ChildSpec))
+            {
+                OutError = FString::Printf(TEXT("Node %s is not an object."), *ChildPath);
+                return false;
+            }
+            if (!PlanSubtreeNode(WidgetBlueprint, *ChildSpec, NodeIndex, ChildPath, UsedNames, OutPlan, OutError))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+bool UUmgSetSubsystem::CreateWidgetSubtree(UWidgetBlueprint* WidgetBlueprint, const FString& ParentName, const TSharedPtr<FJsonValue>& Spec, TArray<FString>& OutCreatedWidgets, FString& OutError)
+{
+    OutCreatedWidgets.Reset();
+    OutError.Reset();
+
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        OutError = TEXT("CreateWidgetSubtree: Widget blueprint or widget tree is invalid.");
+        return false;
+    }
+
+    TArray<TSharedPtr<FJsonObject>> TopLevelSpecs;
+    const TArray<TSharedPtr<FJsonValue>>* SpecArray = nullptr;
+    const TSharedPtr<FJsonObject>* SpecObject = nullptr;
+    if (Spec.IsValid() && Spec->TryGetArray(SpecArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *SpecArray)
+        {
+            const TSharedPtr<FJsonObject>* NodeObject = nullptr;
+            TopLevelSpecs.Add(Value.IsValid() && Value->TryGetObject(NodeObject) ? *NodeObject : TSharedPtr<FJsonObject>());
+        }
+    }
+    else if (Spec.IsValid() && Spec->TryGetObject(SpecObject))
+    {
+        TopLevelSpecs.Add(*SpecObject);
+    }
+
+    if (TopLevelSpecs.Num() == 0)
+    {
+        OutError = TEXT("CreateWidgetSubtree: The subtree spec must be a node object or a non-empty array of nodes.");
+        return false;
+    }
+
+    // 1. Validate and flatten the whole spec before touching the tree.
+    TArray<FSubtreeNodePlan> Plan;
+    TSet<FName> UsedNames;
+    for (int32 Index = 0; Index < TopLevelSpecs.Num(); ++Index)
+    {
+        if (!PlanSubtreeNode(WidgetBlueprint, TopLevelSpecs[Index], INDEX_NONE, FString::Printf(TEXT("[%d]"), Index), UsedNames, Plan, OutError))
+        {
+            OutError = TEXT("CreateWidgetSubtree: ") + OutError;
+            return false;
+        }
+    }
+
+    // 2. Resolve where the subtree goes. An empty tree takes a single panel node as its root, like CreateWidget.
+    UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+    UPanelWidget* ParentPanel = nullptr;
+    if (!WidgetTree->RootWidget)
+    {
+        if (TopLevelSpecs.Num() != 1 || !Plan[0].WidgetClass->IsChildOf(UPanelWidget::StaticClass()))
+        {
+            OutError = TEXT("CreateWidgetSubtree: The asset has no root widget; the subtree must be a single panel node to become the root.");
+            return false;
+        }
+    }
+    else
+    {
+        const FString ActualParentName = ResolveImplicitParentName(WidgetBlueprint, ParentName, TEXT("CreateWidgetSubtree"));
+        ParentPanel = Cast<UPanelWidget>(FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, ActualParentName));
+        if (!ParentPanel)
+        {
+            OutError = FString::Printf(TEXT("CreateWidgetSubtree: Parent '%s' is not a panel in '%s'."), *ActualParentName, *WidgetBlueprint->GetPathName());
+            return false;
+        }
+        if (!CanAcceptChildren(ParentPanel->GetClass(), ParentPanel->GetChildrenCount(), TopLevelSpecs.Num()))
+        {
+            OutError = FString::Printf(TEXT("CreateWidgetSubtree: Parent '%s' cannot hold %d more children."), *ActualParentName, TopLevelSpecs.Num());
+            return false;
+        }
+    }
+
+    // 3. Construct in pre-order so every parent exists, and has created the child's slot, before properties apply.
+    WidgetBlueprint->Modify();
+
+    TArray<UWidget*> Constructed;
+    Constructed.Reserve(Plan.Num());
+    for (const FSubtreeNodePlan& Node : Plan)
+    {
+        // Descendants of a node that failed to construct are skipped rather than left orphaned.
+        if (Node.ParentIndex != INDEX_NONE && !Constructed[Node.ParentIndex])
+        {
+            Constructed.Add(nullptr);
+            continue;
+        }
+
+        UWidget* NewWidget = WidgetTree->ConstructWidget<UWidget>(Node.WidgetClass, Node.WidgetName);
+        Constructed.Add(NewWidget);
+        if (!NewWidget)
+        {
+            continue;
+        }
+
+        UPanelWidget* NodeParent = Node.ParentIndex == INDEX_NONE ? ParentPanel : Cast<UPanelWidget>(Constructed[Node.ParentIndex]);
+        if (NodeParent)
+        {
+            NodeParent->AddChild(NewWidget);
+        }
+        else if (Node.ParentIndex == INDEX_NONE)
+        {
+            WidgetTree->RootWidget = NewWidget;
+        }
+
+        TSharedPtr<FJsonObject> Properties;
+        const TSharedPtr<FJsonObject>* PropertiesObject = nullptr;
+        if (Node.Spec->TryGetObjectField(TEXT("properties"), PropertiesObject))
+        {
+            // Copied because ApplyWidgetPropertiesJson rewrites keys in place.
+            Properties = MakeShared<FJsonObject>(**PropertiesObject);
+        }
+
+        const TSharedPtr<FJsonObject>* SlotObject = nullptr;
+        if (Node.Spec->TryGetObjectField(TEXT("slot"), SlotObject))
+        {
+            if (!Properties.IsValid())
+            {
+                Properties = MakeShared<FJsonObject>();
+            }
+            TSharedPtr<FJsonObject> SlotProperties = MakeShared<FJsonObject>(**SlotObject);
+            const TSharedPtr<FJsonObject>* ExistingSlot = nullptr;
+            if (Properties->TryGetObjectField(TEXT("Slot"), ExistingSlot))
+            {
+                for (const auto& Pair : (*ExistingSlot)->Values)
+                {
+                    if (!SlotProperties->HasField(UmgMcpJsonCompat::KeyToString(Pair.Key)))
+                    {
+                        SlotProperties->SetField(UmgMcpJsonCompat::KeyToString(Pair.Key), Pair.Value);
+                    }
+                }
+            }
+            Properties->SetObjectField(TEXT("Slot"), SlotProperties);
+        }
+
+        if (Properties.IsValid() && Properties->Values.Num() > 0)
+        {
+            ApplyWidgetPropertiesJson(NewWidget, Properties);
+        }
+        OutCreatedWidgets.Add(NewWidget->GetName());
+    }
+
+    if (Constructed.Contains(nullptr))
+    {
+        UE_LOG(LogUmgSet, Warning, TEXT("CreateWidgetSubtree: %d of %d widgets could not be constructed in '%s'."), Constructed.Num() - OutCreatedWidgets.Num(), Constructed.Num(), *WidgetBlueprint->GetPathName());
+    }
+
+#if WITH_EDITORONLY_DATA
+    // 4. Register variable GUIDs for the new widgets only, instead of re-walking the whole tree per widget.
+    for (UWidget* NewWidget : Constructed)
+    {
+        if (!NewWidget)
+        {
+            continue;
+        }
+        const FGuid* ExistingGuid = WidgetBlueprint->WidgetVariableNameToGuidMap.Find(NewWidget->GetFName());
+        if (!ExistingGuid || !ExistingGuid->IsValid())
+        {
+            WidgetBlueprint->WidgetVariableNameToGuidMap.Add(NewWidget->GetFName(), FGuid::NewGuid());
+        }
+    }
+#endif
+
+    FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+
+    if (OutCreatedWidgets.Num() == 0)
+    {
+        OutError = TEXT("CreateWidgetSubtree: No widget could be constructed.");
+        return false;
+    }
+    return true;
+}
+
 bool UUmgSetSubsystem::DeleteWidget(UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName)
 {
     if (!WidgetBlueprint)
@@ -921,7 +1344,7 @@ bool UUmgSetSubsystem::DeleteWidget(UWidgetBlueprint* WidgetBlueprint, const FSt
         return false;
     }
 
-    UWidget* FoundWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName));
+    UWidget* FoundWidget = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, WidgetName);
     if (!FoundWidget)
     {
         UE_LOG(LogUmgSet, Error, TEXT("DeleteWidget: Failed to find widget '%s' in asset '%s'."), *WidgetName, *WidgetBlueprint->GetPathName());
@@ -932,6 +1355,7 @@ bool UUmgSetSubsystem::DeleteWidget(UWidgetBlueprint* WidgetBlueprint, const FSt
 
     if (WidgetBlueprint->WidgetTree->RemoveWidget(FoundWidget))
     {
+        FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
         EnsureSourceWidgetGuids(WidgetBlueprint);
         FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
         return true;
@@ -981,6 +1405,7 @@ bool UUmgSetSubsystem::ReorderWidgetTree(UWidgetBlueprint* WidgetBlueprint, cons
 
     if (OutReorderedWidgets.Num() > 0)
     {
+        FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
         FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
     }
 
@@ -997,7 +1422,7 @@ TArray<FString> UUmgSetSubsystem::ReparentWidget(UWidgetBlueprint* WidgetBluepri
         return AffectedWidgets;
     }
 
-    UWidget* WidgetToReplace = WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName));
+    UWidget* WidgetToReplace = FUmgWidgetIndexCache::Get().FindWidget(WidgetBlueprint, WidgetName);
     if (!WidgetToReplace)
     {
         UE_LOG(LogUmgSet, Error, TEXT("ReparentWidget: Failed to find widget to replace '%s'."), *WidgetName);
@@ -1021,27 +1446,7 @@ TArray<FString> UUmgSetSubsystem::ReparentWidget(UWidgetBlueprint* WidgetBluepri
     }
 
     // 2. Resolve widget class
-    UClass* WidgetClass = nullptr;
-    if (WidgetClassPath.Contains(TEXT("/")))
-    {
-        WidgetClass = FindObject<UClass>(nullptr, *WidgetClassPath);
-        if (!WidgetClass) WidgetClass = LoadObject<UClass>(nullptr, *WidgetClassPath);
-    }
-    
-    if (!WidgetClass)
-    {
-        FString NativePath = FString::Printf(TEXT("/Script/UMG.%s"), *WidgetClassPath);
-        WidgetClass = FindObject<UClass>(nullptr, *NativePath);
-        if (!WidgetClass) WidgetClass = LoadObject<UClass>(nullptr, *NativePath);
-    }
-
-    if (!WidgetClass)
-    {
-        FString NativePathU = FString::Printf(TEXT("/Script/UMG.U%s"), *WidgetClassPath);
-        WidgetClass = FindObject<UClass>(nullptr, *NativePathU);
-        if (!WidgetClass) WidgetClass = LoadObject<UClass>(nullptr, *NativePathU);
-    }
-
+    UClass* WidgetClass = FUmgWidgetClassResolver::Get().Resolve(WidgetClassPath);
     if (!WidgetClass)
     {
         UE_LOG(LogUmgSet, Error, TEXT("ReparentWidget: Failed to find or load class '%s'."), *WidgetClassPath);
@@ -1186,6 +1591,7 @@ TArray<FString> UUmgSetSubsystem::ReparentWidget(UWidgetBlueprint* WidgetBluepri
         FinalName = WidgetName;
     }
 
+    FUmgWidgetIndexCache::Get().Invalidate(WidgetBlueprint);
     EnsureSourceWidgetGuids(WidgetBlueprint);
 
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
@@ -0,0 +1,191 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgWidgetClassResolver.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    static IAssetRegistry* GetAssetRegistry()
+    {
+        FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+        return AssetRegistryModule ? &AssetRegistryModule->Get() : nullptr;
+    }
+
+    static UClass* FindOrLoadClass(const FString& ClassPath)
+    {
+        if (UClass* Found = FindObject<UClass>(nullptr, *ClassPath))
+        {
+            return Found;
+        }
+
+        // Script packages are always resident, so a miss there cannot be fixed by loading.
+        if (ClassPath.StartsWith(TEXT("/Script/")))
+        {
+            return nullptr;
+        }
+        return LoadObject<UClass>(nullptr, *ClassPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+    }
+}
+
+FUmgWidgetClassResolver& FUmgWidgetClassResolver::Get()
+{
+    static FUmgWidgetClassResolver Instance;
+    return Instance;
+}
+
+UClass* FUmgWidgetClassResolver::Resolve(const FString& WidgetType)
+{
+    check(IsInGameThread());
+    if (WidgetType.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    BindHooks();
+
+    const double Now = FPlatformTime::Seconds();
+    if (const FEntry* Entry = Entries.Find(WidgetType))
+    {
+        UClass* CachedClass = Entry->Class.Get();
+        if (CachedClass && !CachedClass->HasAnyClassFlags(CLASS_NewerVersionExists))
+        {
+            return CachedClass;
+        }
+        if (Entry->Class.IsExplicitlyNull() && Now < Entry->RetryAfter)
+        {
+            return nullptr;
+        }
+    }
+
+    UClass* Resolved = ResolveUncached(WidgetType);
+    FEntry& Entry = Entries.FindOrAdd(WidgetType);
+    Entry.Class = Resolved;
+    Entry.RetryAfter = Resolved ? 0.0 : Now + NegativeTtlSeconds;
+    return Resolved;
+}
+
+UClass* FUmgWidgetClassResolver::ResolveUncached(const FString& WidgetType)
+{
+    if (WidgetType.Contains(TEXT("/")))
+    {
+        if (UClass* Found = FindOrLoadClass(WidgetType))
+        {
+            return Found;
+        }
+
+        // Blueprint asset paths (e.g. from list_assets) name the asset, not its generated class.
+        if (!WidgetType.StartsWith(TEXT("/Script/")) && !WidgetType.EndsWith(TEXT("_C")))
+        {
+            FString ClassPath = WidgetType;
+            if (!ClassPath.Contains(TEXT(".")))
+            {
+                ClassPath = FString::Printf(TEXT("%s.%s"), *ClassPath, *FPackageName::GetShortName(ClassPath));
+            }
+            ClassPath += TEXT("_C");
+
+            if (UClass* Found = FindOrLoadClass(ClassPath))
+            {
+                return Found;
+            }
+        }
+        return nullptr;
+    }
+
+    if (UClass* Found = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/UMG.%s"), *WidgetType)))
+    {
+        return Found;
+    }
+
+    if (WidgetType.Len() > 1 && WidgetType[0] == TEXT('U'))
+    {
+        if (UClass* Found = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/UMG.%s"), *WidgetType.RightChop(1))))
+        {
+            return Found;
+        }
+    }
+
+    // Widget classes from other modules (CommonUI, plugins) and already loaded Blueprint classes.
+    return FindFirstObject<UClass>(*WidgetType, EFindFirstObjectOptions::NativeFirst);
+}
+
+void FUmgWidgetClassResolver::Invalidate()
+{
+    Entries.Reset();
+}
+
+void FUmgWidgetClassResolver::Reset()
+{
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    ModulesChangedHandle.Reset();
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    ReloadCompleteHandle.Reset();
+    if (IAssetRegistry* AssetRegistry = GetAssetRegistry())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    Invalidate();
+}
+
+void FUmgWidgetClassResolver::BindHooks()
+{
+    if (!ModulesChangedHandle.IsValid())
+    {
+        ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([this](FName, EModuleChangeReason)
+        {
+            Invalidate();
+        });
+    }
+    if (!ReloadCompleteHandle.IsValid())
+    {
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+        {
+            Invalidate();
+        });
+    }
+
+    IAssetRegistry* AssetRegistry = GetAssetRegistry();
+    if (AssetRegistry && !AssetAddedHandle.IsValid())
+    {
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FUmgWidgetClassResolver::HandleAssetAdded);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FUmgWidgetClassResolver::HandleAssetChanged);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddLambda([this](const FAssetData& AssetData, const FString&)
+        {
+            HandleAssetChanged(AssetData);
+        });
+    }
+}
+
+void FUmgWidgetClassResolver::HandleAssetChanged(const FAssetData& AssetData)
+{
+    if (Entries.Num() > 0 && AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+    {
+        for (auto It = Entries.CreateIterator(); It; ++It)
+        {
+            if (It.Value().Class.IsExplicitlyNull())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+}
+
+void FUmgWidgetClassResolver::HandleAssetAdded(const FAssetData& AssetData)
+{
+    // The initial scan and bulk imports add thousands of assets; dropping misses for each one would buy nothing.
+    IAssetRegistry* AssetRegistry = GetAssetRegistry();
+    if (AssetRegistry && AssetRegistry->IsLoadingAssets())
+    {
+        return;
+    }
+    HandleAssetChanged(AssetData);
+}
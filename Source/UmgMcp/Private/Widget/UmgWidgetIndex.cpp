@@ -0,0 +1,248 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgWidgetIndex.h"
+#include "WidgetBlueprint.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/PanelWidget.h"
+#include "Components/PanelSlot.h"
+#include "Components/Widget.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "UObject/UObjectGlobals.h"
+
+FUmgWidgetIndexCache& FUmgWidgetIndexCache::Get()
+{
+    static FUmgWidgetIndexCache Instance;
+    return Instance;
+}
+
+FUmgWidgetIndexCache::FBlueprintIndex* FUmgWidgetIndexCache::GetOrBuildIndex(UWidgetBlueprint* WidgetBlueprint)
+{
+    check(IsInGameThread());
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        return nullptr;
+    }
+
+    FBlueprintIndex* Index = Indices.Find(WidgetBlueprint);
+    if (!ObjectTransactedHandle.IsValid())
+    {
+        ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FUmgWidgetIndexCache::HandleObjectTransacted);
+    }
+
+    if (!Index)
+    {
+        // Opportunistically drop indices of blueprints that have been garbage collected.
+        for (auto It = Indices.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().Blueprint.IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        Index = &Indices.Add(WidgetBlueprint);
+        Index->Blueprint = WidgetBlueprint;
+        Index->Revision = ++RevisionCounter;
+        Index->ChangedHandle = WidgetBlueprint->OnChanged().AddRaw(this, &FUmgWidgetIndexCache::HandleBlueprintChanged);
+        Index->CompiledHandle = WidgetBlueprint->OnCompiled().AddRaw(this, &FUmgWidgetIndexCache::HandleBlueprintChanged);
+    }
+
+    if (!Index->bBuilt)
+    {
+        BuildIndex(*Index, WidgetBlueprint);
+    }
+    else if (Index->IndexedTree.Get() != WidgetBlueprint->WidgetTree)
+    {
+        RebuildStaleIndex(*Index, WidgetBlueprint);
+    }
+    return Index;
+}
+
+void FUmgWidgetIndexCache::BuildIndex(FBlueprintIndex& Index, UWidgetBlueprint* WidgetBlueprint)
+{
+    Index.WidgetsByName.Reset();
+    Index.ChildrenByParent.Reset();
+    Index.AllWidgets.Reset();
+    Index.IndexedTree = WidgetBlueprint->WidgetTree;
+
+    WidgetBlueprint->WidgetTree->ForEachWidget([&Index](UWidget* Widget)
+    {
+        if (!Widget)
+        {
+            return;
+        }
+
+        Index.AllWidgets.Add(Widget);
+        // Keep the first match, like UWidgetTree::FindWidget.
+        if (!Index.WidgetsByName.Contains(Widget->GetFName()))
+        {
+            Index.WidgetsByName.Add(Widget->GetFName(), Widget);
+        }
+
+        if (UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
+        {
+            TArray<TWeakObjectPtr<UWidget>>& Children = Index.ChildrenByParent.Add(Panel);
+            Children.Reserve(Panel->GetChildrenCount());
+            for (int32 ChildIndex = 0; ChildIndex < Panel->GetChildrenCount(); ++ChildIndex)
+            {
+                Children.Add(Panel->GetChildAt(ChildIndex));
+            }
+        }
+    });
+
+    Index.bBuilt = true;
+}
+
+void FUmgWidgetIndexCache::RebuildStaleIndex(FBlueprintIndex& Index, UWidgetBlueprint* WidgetBlueprint)
+{
+    // The tree changed without a notification, so whatever was cached against the old revision is stale as well.
+    Index.Revision = ++RevisionCounter;
+    BuildIndex(Index, WidgetBlueprint);
+}
+
+UWidget* FUmgWidgetIndexCache::FindWidget(UWidgetBlueprint* WidgetBlueprint, FName WidgetName)
+{
+    if (WidgetName.IsNone())
+    {
+        return nullptr;
+    }
+
+    FBlueprintIndex* Index = GetOrBuildIndex(WidgetBlueprint);
+    if (!Index)
+    {
+        return nullptr;
+    }
+
+    const TWeakObjectPtr<UWidget>* Found = Index->WidgetsByName.Find(WidgetName);
+    if (!Found)
+    {
+        // Widgets added or renamed by code that does not broadcast OnChanged (Python, other plugins) are invisible
+        // to the index; a name lookup in the tree's outer confirms the miss before callers create under that name.
+        if (!StaticFindObjectFast(UWidget::StaticClass(), WidgetBlueprint->WidgetTree, WidgetName))
+        {
+            return nullptr;
+        }
+
+        RebuildStaleIndex(*Index, WidgetBlueprint);
+        const TWeakObjectPtr<UWidget>* Rebuilt = Index->WidgetsByName.Find(WidgetName);
+        return Rebuilt ? Rebuilt->Get() : nullptr;
+    }
+
+    UWidget* Widget = Found->Get();
+    if (Widget && Widget->GetFName() == WidgetName && Widget->GetTypedOuter<UWidgetTree>() == WidgetBlueprint->WidgetTree)
+    {
+        return Widget;
+    }
+
+    // The entry went stale without a change notification; rebuild once and answer from the fresh index.
+    RebuildStaleIndex(*Index, WidgetBlueprint);
+    const TWeakObjectPtr<UWidget>* Rebuilt = Index->WidgetsByName.Find(WidgetName);
+    return Rebuilt ? Rebuilt->Get() : nullptr;
+}
+
+UWidget* FUmgWidgetIndexCache::FindWidget(UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName)
+{
+    return WidgetName.IsEmpty() ? nullptr : FindWidget(WidgetBlueprint, FName(*WidgetName, FNAME_Find));
+}
+
+bool FUmgWidgetIndexCache::GetChildren(UWidgetBlueprint* WidgetBlueprint, const UWidget* Parent, TArray<UWidget*>& OutChildren)
+{
+    OutChildren.Reset();
+    FBlueprintIndex* Index = GetOrBuildIndex(WidgetBlueprint);
+    const TArray<TWeakObjectPtr<UWidget>>* Children = Index ? Index->ChildrenByParent.Find(Parent) : nullptr;
+    if (!Children)
+    {
+        return false;
+    }
+
+    OutChildren.Reserve(Children->Num());
+    for (const TWeakObjectPtr<UWidget>& Child : *Children)
+    {
+        if (UWidget* ChildWidget = Child.Get())
+        {
+            OutChildren.Add(ChildWidget);
+        }
+    }
+    return true;
+}
+
+void FUmgWidgetIndexCache::GetAllWidgets(UWidgetBlueprint* WidgetBlueprint, TArray<UWidget*>& OutWidgets)
+{
+    OutWidgets.Reset();
+    FBlueprintIndex* Index = GetOrBuildIndex(WidgetBlueprint);
+    if (!Index)
+    {
+        return;
+    }
+
+    OutWidgets.Reserve(Index->AllWidgets.Num());
+    for (const TWeakObjectPtr<UWidget>& Widget : Index->AllWidgets)
+    {
+        if (UWidget* Resolved = Widget.Get())
+        {
+            OutWidgets.Add(Resolved);
+        }
+    }
+}
+
+int64 FUmgWidgetIndexCache::GetRevision(UWidgetBlueprint* WidgetBlueprint)
+{
+    const FBlueprintIndex* Index = GetOrBuildIndex(WidgetBlueprint);
+    return Index ? Index->Revision : 0;
+}
+
+void FUmgWidgetIndexCache::Invalidate(const UWidgetBlueprint* WidgetBlueprint)
+{
+    if (FBlueprintIndex* Index = WidgetBlueprint ? Indices.Find(WidgetBlueprint) : nullptr)
+    {
+        Index->Revision = ++RevisionCounter;
+        Index->bBuilt = false;
+        Index->WidgetsByName.Reset();
+        Index->ChildrenByParent.Reset();
+        Index->AllWidgets.Reset();
+    }
+}
+
+void FUmgWidgetIndexCache::HandleBlueprintChanged(UBlueprint* Blueprint)
+{
+    Invalidate(Cast<UWidgetBlueprint>(Blueprint));
+}
+
+void FUmgWidgetIndexCache::HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& Event)
+{
+    if (!Object || Event.GetEventType() != ETransactionObjectEventType::UndoRedo || Indices.Num() == 0)
+    {
+        return;
+    }
+
+    if (Object->IsA<UWidget>() || Object->IsA<UPanelSlot>() || Object->IsA<UWidgetTree>())
+    {
+        Invalidate(Object->GetTypedOuter<UWidgetBlueprint>());
+    }
+    else if (const UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Object))
+    {
+        Invalidate(WidgetBlueprint);
+    }
+}
+
+void FUmgWidgetIndexCache::UnbindDelegates(FBlueprintIndex& Index)
+{
+    if (UWidgetBlueprint* WidgetBlueprint = Index.Blueprint.Get())
+    {
+        WidgetBlueprint->OnChanged().Remove(Index.ChangedHandle);
+        WidgetBlueprint->OnCompiled().Remove(Index.CompiledHandle);
+    }
+    Index.ChangedHandle.Reset();
+    Index.CompiledHandle.Reset();
+}
+
+void FUmgWidgetIndexCache::Reset()
+{
+    for (TPair<TObjectKey<UWidgetBlueprint>, FBlueprintIndex>& Pair : Indices)
+    {
+        UnbindDelegates(Pair.Value);
+    }
+    Indices.Reset();
+
+    FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+    ObjectTransactedHandle.Reset();
+}
@@ -0,0 +1,461 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#include "Widget/UmgWidgetSchemaIndex.h"
+#include "Widget/UmgGetSubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Components/PanelWidget.h"
+#include "Components/Widget.h"
+#include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+#include "WidgetBlueprint.h"
+
+namespace
+{
+    // Time spent building schemas per editor tick while the index warms up.
+    static constexpr double SchemaBuildBudgetSeconds = 0.002;
+
+    static IAssetRegistry* GetAssetRegistry()
+    {
+        FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+        return AssetRegistryModule ? &AssetRegistryModule->Get() : nullptr;
+    }
+
+    static bool IsIndexableNativeClass(const UClass* Class)
+    {
+        return Class
+            && Class->HasAnyClassFlags(CLASS_Native)
+            && !Class->HasAnyClassFlags(CLASS_NewerVersionExists | CLASS_Deprecated)
+            && Class->IsChildOf(UWidget::StaticClass());
+    }
+
+    static FString TagToObjectPath(const FAssetData& AssetData, FName Tag)
+    {
+        FString Value;
+        if (AssetData.GetTagValue(Tag, Value) && !Value.IsEmpty())
+        {
+            return FPackageName::ExportTextPathToObjectPath(Value);
+        }
+        return FString();
+    }
+}
+
+FUmgWidgetSchemaIndex& FUmgWidgetSchemaIndex::Get()
+{
+    static FUmgWidgetSchemaIndex Instance;
+    return Instance;
+}
+
+void FUmgWidgetSchemaIndex::Start()
+{
+    check(IsInGameThread());
+    if (bStarted)
+    {
+        return;
+    }
+    bStarted = true;
+
+    if (IAssetRegistry* AssetRegistry = GetAssetRegistry())
+    {
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FUmgWidgetSchemaIndex::HandleAssetAdded);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FUmgWidgetSchemaIndex::HandleAssetRemoved);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FUmgWidgetSchemaIndex::HandleAssetRenamed);
+    }
+    if (GEditor)
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FUmgWidgetSchemaIndex::HandleBlueprintCompiled);
+    }
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+    {
+        HandleReloadComplete();
+    });
+
+    ScheduleTick();
+}
+
+void FUmgWidgetSchemaIndex::Stop()
+{
+    if (!bStarted)
+    {
+        return;
+    }
+    bStarted = false;
+
+    if (TickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+    if (IAssetRegistry* AssetRegistry = GetAssetRegistry())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    BlueprintCompiledHandle.Reset();
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    ReloadCompleteHandle.Reset();
+
+    ResetEntries();
+}
+
+TSharedPtr<const FJsonObject> FUmgWidgetSchemaIndex::FindSchema(const FString& WidgetType)
+{
+    check(IsInGameThread());
+    FClassEntry* Entry = FindEntry(WidgetType);
+    UClass* WidgetClass = Entry ? Entry->Class.Get() : nullptr;
+
+    if (Entry && Entry->Schema.IsValid())
+    {
+        return Entry->Schema;
+    }
+
+    if (!WidgetClass)
+    {
+        // Blueprint entries are listed from asset tags only; their class is loaded on first schema request.
+        const FString& ClassPath = Entry ? Entry->Info.ClassPath : WidgetType;
+        if (ClassPath.Contains(TEXT("/")) || ClassPath.Contains(TEXT(".")))
+        {
+            WidgetClass = FindObject<UClass>(nullptr, *ClassPath);
+            if (!WidgetClass)
+            {
+                WidgetClass = LoadObject<UClass>(nullptr, *ClassPath);
+            }
+        }
+        else
+        {
+            WidgetClass = FindFirstObject<UClass>(*ClassPath, EFindFirstObjectOptions::NativeFirst);
+        }
+    }
+
+    if (!WidgetClass)
+    {
+        return nullptr;
+    }
+
+    // Non-widget classes are still described, as before the index existed, but are not listed.
+    if (!Entry && !WidgetClass->IsChildOf(UWidget::StaticClass()))
+    {
+        return BuildSchema(WidgetClass);
+    }
+
+    if (!Entry)
+    {
+        FUmgWidgetClassInfo Info;
+        Info.ClassName = WidgetClass->GetFName();
+        Info.ClassPath = WidgetClass->GetPathName();
+        Info.ParentClassPath = WidgetClass->GetSuperClass() ? WidgetClass->GetSuperClass()->GetPathName() : FString();
+        Info.bNative = WidgetClass->HasAnyClassFlags(CLASS_Native);
+        Info.bAbstract = WidgetClass->HasAnyClassFlags(CLASS_Abstract);
+        Info.bPanel = WidgetClass->IsChildOf(UPanelWidget::StaticClass());
+        Entry = &AddClassEntry(MoveTemp(Info), WidgetClass);
+    }
+
+    Entry->Class = WidgetClass;
+    Entry->Schema = BuildSchema(WidgetClass);
+    return Entry->Schema;
+}
+
+void FUmgWidgetSchemaIndex::GetClasses(TArray<const FUmgWidgetClassInfo*>& OutClasses)
+{
+    check(IsInGameThread());
+    if (bSortedClassesDirty)
+    {
+        SortedClasses.Reset(EntriesByPath.Num());
+        for (const TPair<FString, TUniquePtr<FClassEntry>>& Pair : EntriesByPath)
+        {
+            SortedClasses.Add(&Pair.Value->Info);
+        }
+        SortedClasses.Sort([](const FUmgWidgetClassInfo& First, const FUmgWidgetClassInfo& Second)
+        {
+            const int32 Compare = First.ClassName.Compare(Second.ClassName);
+            return Compare != 0 ? Compare < 0 : First.ClassPath < Second.ClassPath;
+        });
+        bSortedClassesDirty = false;
+    }
+    OutClasses = SortedClasses;
+}
+
+TSharedPtr<const FJsonObject> FUmgWidgetSchemaIndex::BuildSchema(const UClass* WidgetClass)
+{
+    TSharedPtr<FJsonObject> SchemaJson = MakeShared<FJsonObject>();
+    SchemaJson->SetStringField(TEXT("class_path"), WidgetClass->GetPathName());
+    if (const UClass* SuperClass = WidgetClass->GetSuperClass())
+    {
+        SchemaJson->SetStringField(TEXT("parent_class"), SuperClass->GetPathName());
+    }
+    SchemaJson->SetBoolField(TEXT("is_panel"), WidgetClass->IsChildOf(UPanelWidget::StaticClass()));
+
+    TSharedPtr<FJsonObject> PropertiesJson = MakeShared<FJsonObject>();
+    for (TFieldIterator<FProperty> PropIt(WidgetClass); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        bool bIsEditorOnly = false;
+#if WITH_EDITOR
+        bIsEditorOnly = Property->HasAnyPropertyFlags(CPF_EditorOnly);
+#endif
+        if (Property->HasAnyPropertyFlags(CPF_Edit) && !bIsEditorOnly)
+        {
+            TSharedPtr<FJsonObject> PropInfo = MakeShared<FJsonObject>();
+            PropInfo->SetStringField(TEXT("type"), Property->GetCPPType());
+#if WITH_EDITOR
+            PropInfo->SetStringField(TEXT("tooltip"), Property->GetToolTipText().ToString());
+#endif
+            PropertiesJson->SetObjectField(Property->GetName(), PropInfo);
+        }
+    }
+
+    SchemaJson->SetObjectField(TEXT("properties"), PropertiesJson);
+    return SchemaJson;
+}
+
+void FUmgWidgetSchemaIndex::ScanNativeClasses()
+{
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        if (!IsIndexableNativeClass(Class) || EntriesByPath.Contains(Class->GetPathName()))
+        {
+            continue;
+        }
+
+        FUmgWidgetClassInfo Info;
+        Info.ClassName = Class->GetFName();
+        Info.ClassPath = Class->GetPathName();
+        Info.ParentClassPath = Class->GetSuperClass() ? Class->GetSuperClass()->GetPathName() : FString();
+        Info.bNative = true;
+        Info.bAbstract = Class->HasAnyClassFlags(CLASS_Abstract);
+        Info.bPanel = Class->IsChildOf(UPanelWidget::StaticClass());
+        PendingSchemas.Add(Info.ClassPath);
+        AddClassEntry(MoveTemp(Info), Class);
+    }
+    bNativeScanned = true;
+}
+
+void FUmgWidgetSchemaIndex::ScanBlueprintClasses()
+{
+    IAssetRegistry* AssetRegistry = GetAssetRegistry();
+    if (AssetRegistry)
+    {
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+
+        TArray<FAssetData> Assets;
+        AssetRegistry->GetAssets(Filter, Assets);
+        for (const FAssetData& AssetData : Assets)
+        {
+            AddBlueprintEntry(AssetData);
+        }
+    }
+    bBlueprintsScanned = true;
+}
+
+FUmgWidgetSchemaIndex::FClassEntry& FUmgWidgetSchemaIndex::AddClassEntry(FUmgWidgetClassInfo&& Info, UClass* Class)
+{
+    TUniquePtr<FClassEntry>& Slot = EntriesByPath.FindOrAdd(Info.ClassPath);
+    if (!Slot.IsValid())
+    {
+        Slot = MakeUnique<FClassEntry>();
+    }
+    Slot->Info = MoveTemp(Info);
+    if (Class)
+    {
+        Slot->Class = Class;
+    }
+
+    // Short names can collide across modules and content folders; native classes own the name over Blueprints.
+    FClassEntry*& NamedEntry = EntriesByName.FindOrAdd(Slot->Info.ClassName);
+    if (!NamedEntry || (Slot->Info.bNative && !NamedEntry->Info.bNative))
+    {
+        NamedEntry = Slot.Get();
+    }
+
+    bSortedClassesDirty = true;
+    ++Generation;
+    return *Slot;
+}
+
+void FUmgWidgetSchemaIndex::AddBlueprintEntry(const FAssetData& AssetData)
+{
+    FUmgWidgetClassInfo Info;
+    Info.ClassPath = TagToObjectPath(AssetData, FBlueprintTags::GeneratedClassPath);
+    if (Info.ClassPath.IsEmpty())
+    {
+        Info.ClassPath = AssetData.GetObjectPathString() + TEXT("_C");
+    }
+    Info.ClassName = FName(*FPackageName::ObjectPathToObjectName(Info.ClassPath));
+    Info.ParentClassPath = TagToObjectPath(AssetData, FBlueprintTags::ParentClassPath);
+    Info.bNative = false;
+    AddClassEntry(MoveTemp(Info), nullptr);
+}
+
+void FUmgWidgetSchemaIndex::RemoveClassEntry(const FString& ClassPath)
+{
+    TUniquePtr<FClassEntry>* Existing = EntriesByPath.Find(ClassPath);
+    if (!Existing)
+    {
+        return;
+    }
+    const TUniquePtr<FClassEntry> Removed = MoveTemp(*Existing);
+    EntriesByPath.Remove(ClassPath);
+
+    const FName ClassName = Removed->Info.ClassName;
+    FClassEntry** NamedEntry = EntriesByName.Find(ClassName);
+    if (NamedEntry && *NamedEntry == Removed.Get())
+    {
+        EntriesByName.Remove(ClassName);
+        for (const TPair<FString, TUniquePtr<FClassEntry>>& Pair : EntriesByPath)
+        {
+            if (Pair.Value->Info.ClassName == ClassName)
+            {
+                EntriesByName.Add(ClassName, Pair.Value.Get());
+                break;
+            }
+        }
+    }
+
+    bSortedClassesDirty = true;
+    ++Generation;
+}
+
+FUmgWidgetSchemaIndex::FClassEntry* FUmgWidgetSchemaIndex::FindEntry(const FString& WidgetType)
+{
+    if (const TUniquePtr<FClassEntry>* ByPath = EntriesByPath.Find(WidgetType))
+    {
+        return ByPath->Get();
+    }
+
+    const FName TypeName(*WidgetType, FNAME_Find);
+    if (FClassEntry* const* ByName = TypeName.IsNone() ? nullptr : EntriesByName.Find(TypeName))
+    {
+        return *ByName;
+    }
+
+    // Accept the C++ spelling, e.g. "UButton" for "Button".
+    if (WidgetType.Len() > 1 && WidgetType[0] == TEXT('U'))
+    {
+        const FName UnprefixedName(*WidgetType.RightChop(1), FNAME_Find);
+        if (FClassEntry* const* ByName = UnprefixedName.IsNone() ? nullptr : EntriesByName.Find(UnprefixedName))
+        {
+            return *ByName;
+        }
+    }
+    return nullptr;
+}
+
+void FUmgWidgetSchemaIndex::ResetEntries()
+{
+    EntriesByPath.Reset();
+    EntriesByName.Reset();
+    SortedClasses.Reset();
+    PendingSchemas.Reset();
+    bSortedClassesDirty = true;
+    bNativeScanned = false;
+    bBlueprintsScanned = false;
+    ++Generation;
+}
+
+void FUmgWidgetSchemaIndex::ScheduleTick()
+{
+    if (bStarted && !TickHandle.IsValid())
+    {
+        TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FUmgWidgetSchemaIndex::Tick));
+    }
+}
+
+bool FUmgWidgetSchemaIndex::Tick(float DeltaTime)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (!bNativeScanned)
+    {
+        ScanNativeClasses();
+    }
+
+    if (!bBlueprintsScanned)
+    {
+        IAssetRegistry* AssetRegistry = GetAssetRegistry();
+        if (!AssetRegistry || !AssetRegistry->IsLoadingAssets())
+        {
+            ScanBlueprintClasses();
+        }
+    }
+
+    while (PendingSchemas.Num() > 0 && FPlatformTime::Seconds() - StartTime < SchemaBuildBudgetSeconds)
+    {
+        const FString ClassPath = PendingSchemas.Pop(EAllowShrinking::No);
+        const TUniquePtr<FClassEntry>* Entry = EntriesByPath.Find(ClassPath);
+        UClass* WidgetClass = Entry ? (*Entry)->Class.Get() : nullptr;
+        if (WidgetClass && !(*Entry)->Schema.IsValid())
+        {
+            (*Entry)->Schema = BuildSchema(WidgetClass);
+        }
+    }
+
+    if (!IsReady())
+    {
+        return true;
+    }
+
+    UE_LOG(LogUmgGet, Log, TEXT("FUmgWidgetSchemaIndex: Indexed %d widget classes."), EntriesByPath.Num());
+    TickHandle.Reset();
+    return false;
+}
+
+void FUmgWidgetSchemaIndex::HandleAssetAdded(const FAssetData& AssetData)
+{
+    // Assets found by the startup scan are picked up in one batch by ScanBlueprintClasses.
+    if (bBlueprintsScanned && AssetData.IsInstanceOf(UWidgetBlueprint::StaticClass()))
+    {
+        AddBlueprintEntry(AssetData);
+    }
+}
+
+void FUmgWidgetSchemaIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if (bBlueprintsScanned && AssetData.IsInstanceOf(UWidgetBlueprint::StaticClass()))
+    {
+        const FString ClassPath = TagToObjectPath(AssetData, FBlueprintTags::GeneratedClassPath);
+        RemoveClassEntry(ClassPath.IsEmpty() ? AssetData.GetObjectPathString() + TEXT("_C") : ClassPath);
+    }
+}
+
+void FUmgWidgetSchemaIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (bBlueprintsScanned && AssetData.IsInstanceOf(UWidgetBlueprint::StaticClass()))
+    {
+        RemoveClassEntry(OldObjectPath + TEXT("_C"));
+        AddBlueprintEntry(AssetData);
+    }
+}
+
+void FUmgWidgetSchemaIndex::HandleBlueprintCompiled()
+{
+    // Compilation can add or remove Blueprint variables; their schemas are rebuilt on the next request.
+    for (const TPair<FString, TUniquePtr<FClassEntry>>& Pair : EntriesByPath)
+    {
+        if (!Pair.Value->Info.bNative)
+        {
+            Pair.Value->Schema.Reset();
+        }
+    }
+}
+
+void FUmgWidgetSchemaIndex::HandleReloadComplete()
+{
+    // Hot reload and live coding can add, remove or reshape native classes; start over.
+    ResetEntries();
+    ScheduleTick();
+}
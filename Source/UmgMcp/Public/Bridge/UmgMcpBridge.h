@@ -84,6 +84,8 @@ private:
     {
         FString CommandType;
         TSharedPtr<FJsonObject> Params;
+        /** Layout payload parsed and validated on the connection thread (apply_json_to_umg / apply_layout). */
+        TSharedPtr<FUmgPreparedLayout> PreparedLayout;
         FString Response;
         FEvent* CompletionEvent = nullptr;
         FString ClientId;
@@ -109,8 +111,11 @@ private:
     };
 
     // Internal helper to execute command logic (thread-agnostic)
-    FString InternalExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+    FString InternalExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+        const TSharedPtr<FUmgPreparedLayout>& PreparedLayout = nullptr);
     void ProcessNextQueuedCommand();
+    void RunQueuedCommand(const TSharedPtr<FQueuedBridgeCommand, ESPMode::ThreadSafe>& QueuedCommand);
+    void ContinueCommandQueue();
     FString ExecuteQueuedCommand(const TSharedPtr<FQueuedBridgeCommand, ESPMode::ThreadSafe>& QueuedCommand);
     FString HandleConnectionCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FString& ClientId);
     bool RestoreSessionContext(const FString& ClientId, FString& OutError);
@@ -137,6 +142,8 @@ private:
     FIPv4Address ServerAddress;
     FCriticalSection CommandQueueCs;
     TArray<TSharedPtr<FQueuedBridgeCommand, ESPMode::ThreadSafe>> CommandQueue;
+    /** Command taken off the queue that is waiting for its assets to stream in; StopServer answers it too. */
+    TSharedPtr<FQueuedBridgeCommand, ESPMode::ThreadSafe> PreloadingCommand;
     bool bCommandQueueProcessing;
     TAtomic<uint64> NextSequence;
     FString ServerInstanceId;
@@ -14,10 +14,21 @@ namespace UmgMcpJsonCompat
 		return Key;
 	}
 
+	/** Non-allocating view of a JSON object key; valid while the owning FJsonObject is alive. */
+	inline FStringView KeyToView(const FString& Key)
+	{
+		return Key;
+	}
+
 #if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 8)
 	inline FString KeyToString(const UE::FSharedString& Key)
 	{
 		return FString(Key.ToView());
 	}
+
+	inline FStringView KeyToView(const UE::FSharedString& Key)
+	{
+		return Key.ToView();
+	}
 #endif
 }
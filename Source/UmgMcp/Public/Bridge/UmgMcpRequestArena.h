@@ -0,0 +1,38 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/MemStack.h"
+
+/** Scratch array whose storage lives on the calling thread's FMemStack and is reclaimed when the enclosing FMemMark pops. */
+template <typename ElementType>
+using TUmgMcpScratchArray = TArray<ElementType, TMemStackAllocator<>>;
+
+/**
+ * @brief Request-scoped scratch memory for a single bridge command.
+ *
+ * One arena is opened on the game thread around every queued bridge command. It pushes an FMemMark on the thread's
+ * FMemStack, so helpers that build temporary key lists, path segments or child lists with TUmgMcpScratchArray
+ * bump-allocate instead of hitting the general purpose allocator, and all of it is dropped in one pop at the end of the
+ * request. JSON trees are not covered: FJsonObject nodes are allocated individually and freed by their shared
+ * pointers as usual.
+ *
+ * Arenas nest; Get() always returns the innermost one opened on the current thread, or nullptr
+ * when the caller runs outside a bridge command (Blueprint calls, commandlets, tests).
+ */
+class UMGMCP_API FUmgMcpRequestArena
+{
+public:
+    FUmgMcpRequestArena();
+    ~FUmgMcpRequestArena();
+
+    FUmgMcpRequestArena(const FUmgMcpRequestArena&) = delete;
+    FUmgMcpRequestArena& operator=(const FUmgMcpRequestArena&) = delete;
+
+    /** Returns the innermost arena opened on this thread, or nullptr. */
+    static FUmgMcpRequestArena* Get();
+
+private:
+    FMemMark ScratchMark;
+    FUmgMcpRequestArena* PreviousArena = nullptr;
+};
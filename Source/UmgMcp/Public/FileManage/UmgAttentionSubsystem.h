@@ -3,10 +3,14 @@
 
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
+#include "Containers/LruCache.h"
+#include "Containers/Ticker.h"
+#include "FileManage/UmgDependencyPrefetcher.h"
 #include "UmgAttentionSubsystem.generated.h"
 
 class UWidgetBlueprint;
 class UBlueprint;
+struct FStreamableHandle;
 
 /**
  * @brief Manages the "attention" or context for AI-driven UMG operations.
@@ -16,6 +20,15 @@ class UBlueprint;
  * for an explicit "attention target" to be set. When a command is issued without a specific
  * target asset (e.g., "change the button color"), other systems can query this subsystem
  * to determine which UMG asset the user is likely working on.
+ *
+ * The history is an LRU keyed by package name, so touching an asset is O(1) however the path was spelled. It is saved
+ * to Saved/UmgMcp/AssetHistory.json HistorySaveDelaySeconds after the last change (and on shutdown) and read back on
+ * startup, after which the most recent blueprints and the user widgets they place are streamed in below the default
+ * load priority, so the first command after an editor launch finds its target already loaded without holding up
+ * the loads commands ask for.
+ *
+ * Setting a target also starts an FUmgDependencyPrefetcher for it, so the textures, fonts, materials and user widgets
+ * it references are streamed in before commands touch them.
  */
 UCLASS()
 class UMGMCP_API UUmgAttentionSubsystem : public UEditorSubsystem
@@ -33,6 +46,15 @@ public:
 	 */
 	FString GetLastEditedUMGAsset() const;
 
+	/** Entries kept in the asset history. */
+	static constexpr int32 MaxAssetHistory = 32;
+
+	/** Most recent history entries streamed in on startup. */
+	static constexpr int32 WarmupAssetCount = 3;
+
+	/** Quiet period after a history change before it is written to disk; a burst of touches costs one write. */
+	static constexpr float HistorySaveDelaySeconds = 2.0f;
+
 	/**
 	 * Gets a list of recently edited UMG assets.
 	 * @param MaxCount The maximum number of assets to return.
@@ -68,6 +90,9 @@ public:
      */
     UWidgetBlueprint* GetCachedTargetWidgetBlueprint() const;
 
+    /** Progress of the dependency prefetch started by the last successful SetTargetUmgAsset / SetTargetBlueprintAsset. */
+    FUmgPrefetchProgress GetPrefetchProgress() const;
+
 	/**
 	 * Sets the name of the animation currently being focused on.
 	 * @param AnimationName The name of the animation.
@@ -134,6 +159,18 @@ public:
 private:
 	void HandleAssetOpened(UObject* Asset, class IAssetEditorInstance* EditorInstance);
 
+	/** Moves AssetPath to the front of the history and schedules a save. */
+	void TouchAssetHistory(const FString& AssetPath);
+
+	void LoadAssetHistory();
+	void SaveAssetHistory() const;
+
+	/** One-shot ticker callback behind TouchAssetHistory's debounce. */
+	bool SaveScheduledAssetHistory(float DeltaTime);
+
+	/** Streams in the first WarmupAssetCount history entries; waits for the asset registry scan when it is still running. */
+	void StartHistoryWarmup();
+
 	// The asset path of the Blueprint that is the current focus of attention.
 	FString AttentionTargetAssetPath;
 
@@ -153,7 +190,19 @@ private:
     FVector2D CurrentNodePosition; // The visual cursor
 
 protected:
-	TArray<FString> UmgAssetHistory;
+	/** Package name -> asset path as last targeted or opened, most recent first. */
+	TLruCache<FString, FString> UmgAssetHistory;
+
+private:
+	FDelegateHandle FilesLoadedHandle;
+
+	// Pending debounced history save; invalid when the file is up to date.
+	FTSTicker::FDelegateHandle HistorySaveHandle;
+
+	// Keeps the warmed-up assets resident until the subsystem shuts down.
+	TSharedPtr<FStreamableHandle> WarmupHandle;
+
+	FUmgDependencyPrefetcher DependencyPrefetcher;
 
 private:
     bool SetTargetBlueprintAssetInternal(const FString& AssetPath, bool bAllowCreateWidget);
@@ -0,0 +1,54 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class UClass;
+
+/**
+ * @brief Compact binary snapshots of a widget subtree, for stamping template layouts into other screens.
+ *
+ * A snapshot holds an interned string table (widget names, class paths, property names, and the names and object
+ * paths referenced by values), a class table with one layout fingerprint per class, fixed-size widget and property
+ * records in pre-order, and a blob area with each non-default property value in binary form at a recorded offset.
+ * Values are written with FProperty::SerializeItem, so applying one copies it straight into the new widget; nothing is
+ * parsed as text and no key is normalized.
+ *
+ * The file is memory-mapped when applied. Every class fingerprint is checked against the loaded class first, so a
+ * snapshot taken before a widget or slot class changed its properties is rejected as stale_snapshot instead of being
+ * misread; export it again to refresh it.
+ *
+ * Property coverage matches export_umg_to_json (editable, non-transient, non-editor-only, plus slot properties),
+ * minus instanced subobjects and delegates, which have no meaning outside the source asset, and values whose element
+ * counts the reader cannot bound before decoding (a container nested inside a struct, or after a struct element).
+ *
+ * Game thread only.
+ */
+class UMGMCP_API FUmgBinarySnapshot
+{
+public:
+    /** Bumped whenever the file layout changes; older files are rejected as stale_snapshot. */
+    static constexpr uint32 FormatVersion = 2;
+
+    /**
+     * Writes the subtree under TargetWidgetName (the root widget when empty or "Root") to FilePath, or to
+     * GetDefaultFilePath when FilePath is empty. Returns the structured result with file_path and sizes.
+     */
+    static TSharedPtr<FJsonObject> ExportToFile(const FString& AssetPath, const FString& TargetWidgetName, const FString& FilePath);
+
+    /**
+     * Creates the snapshot's widgets under TargetWidgetName (the root widget when empty or "Root"; the new subtree
+     * becomes the root of an empty tree). Names already taken in the asset get a unique suffix and are listed in
+     * "renamed". Everything is validated before the asset is modified, including every stored value, which is decoded
+     * once into scratch memory; a truncated or corrupt file is rejected as invalid_snapshot. Every count read from the
+     * file (string table, container elements, string lengths) is bounded by the bytes that are left for it.
+     */
+    static TSharedPtr<FJsonObject> ApplyFromFile(const FString& FilePath, const FString& AssetPath, const FString& TargetWidgetName);
+
+    /** <Project>/Saved/UmgMcp/Snapshots/<package path>/<widget>.umgsnap */
+    static FString GetDefaultFilePath(const FString& AssetPath, const FString& WidgetName);
+
+    /** Hash of a class's property layout (name, C++ type, offset and size of every property, inherited ones included). */
+    static uint64 ComputeClassFingerprint(const UClass* Class);
+};
@@ -0,0 +1,91 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FStreamableHandle;
+
+/** Snapshot of the current prefetch, as reported by get_target_umg_asset. */
+struct FUmgPrefetchProgress
+{
+    /** Package whose dependencies are being prefetched; empty before the first target is set. */
+    FString PackageName;
+
+    /** Dependency packages selected for streaming. */
+    int32 RequestedPackages = 0;
+
+    /** Assets in those packages, and how many of them have finished loading. */
+    int32 RequestedAssets = 0;
+    int32 LoadedAssets = 0;
+
+    /** Dependencies already in memory when the prefetch started. */
+    int32 ResidentPackages = 0;
+
+    /** Dependencies left out because they would have pushed the estimate past BudgetBytes. */
+    int32 SkippedOverBudget = 0;
+
+    /** Sum of the on-disk sizes of the requested packages, used as the memory estimate. */
+    int64 EstimatedBytes = 0;
+    int64 BudgetBytes = 0;
+
+    /** The dependency walk is still running; the counters above are partial and nothing is streaming yet. */
+    bool bWalking = false;
+
+    bool bComplete = true;
+};
+
+/**
+ * @brief Streams in what a target blueprint references before commands ask for it.
+ *
+ * Commands load textures, fonts, materials, user widgets and animations lazily and synchronously (LoadObject in
+ * property writes, material lookups, ...). When a target is set, Start queues a walk of the asset registry's hard and
+ * soft package dependencies, breadth first; a core ticker advances it a few milliseconds per frame, so setting a target
+ * does not stall on a large dependency graph. When the walk ends, every package that is not yet in memory is handed to
+ * the asset manager's FStreamableManager in one background request.
+ *
+ * Memory is capped by estimate: packages are taken in walk order while the sum of their on-disk sizes stays within
+ * BudgetBytes; larger ones are counted in SkippedOverBudget and their own dependencies are not followed. The handle is
+ * held until the next Start or Cancel, so the prefetched assets stay resident while the target is being edited. Starting
+ * the package that is already being walked or held again is a no-op.
+ *
+ * Game thread only.
+ */
+class UMGMCP_API FUmgDependencyPrefetcher
+{
+public:
+    static constexpr int64 DefaultBudgetBytes = 256ll * 1024 * 1024;
+
+    /** Upper bound on packages visited by one walk, so a target that references the whole project stays cheap. */
+    static constexpr int32 MaxVisitedPackages = 2048;
+
+    /** Time spent walking dependencies per editor tick. */
+    static constexpr double WalkBudgetSeconds = 0.002;
+
+    ~FUmgDependencyPrefetcher();
+
+    /** Cancels any running prefetch and starts one for PackageName's dependencies, unless PackageName's is still live. */
+    void Start(const FString& PackageName, int64 BudgetBytes = DefaultBudgetBytes);
+
+    /** Cancels the running prefetch, releases what it loaded and clears the reported progress. */
+    void Cancel();
+
+    FUmgPrefetchProgress GetProgress() const;
+
+private:
+    bool TickWalk(float DeltaTime);
+
+    /** Hands the walk's result to the streamable manager. */
+    void RequestLoad();
+
+    /** Breadth-first walk state; WalkQueue[WalkIndex] is the next package whose dependencies are read. */
+    TArray<FName> WalkQueue;
+    int32 WalkIndex = 0;
+    TSet<FName> Visited;
+    TArray<FSoftObjectPath> PathsToLoad;
+
+    FTSTicker::FDelegateHandle TickHandle;
+    TSharedPtr<FStreamableHandle> Handle;
+    FUmgPrefetchProgress Progress;
+};
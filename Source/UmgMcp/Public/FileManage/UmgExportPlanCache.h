@@ -0,0 +1,78 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/** One property ExportWidgetToJson compares against the class default. */
+struct FUmgExportProperty
+{
+    FProperty* Property = nullptr;
+
+    /** Key written to the JSON, captured once instead of per widget. */
+    FString Name;
+
+    /** Byte offset of the value inside an instance of the planned class. */
+    int32 Offset = 0;
+
+    /** The same value on the class default object. */
+    const void* DefaultValue = nullptr;
+
+    /** UWidget::Slot: exported as a nested object through the slot class's own plan. */
+    bool bIsSlot = false;
+
+    /**
+     * The value is plain data declared by native code (numbers, enums, strings, text, native structs and containers
+     * of those), so a copy of it can be converted to JSON off the game thread. Object references, delegates and
+     * Blueprint-declared properties are converted while the live object is still being read.
+     */
+    bool bCopyByValue = false;
+
+    const void* GetValue(const UObject* Object) const { return reinterpret_cast<const uint8*>(Object) + Offset; }
+};
+
+/** Export-relevant properties of one widget or slot class, in reflection order. */
+struct FUmgExportPlan
+{
+    TWeakObjectPtr<const UClass> Class;
+    TArray<FUmgExportProperty> Properties;
+};
+
+/**
+ * @brief Per-class tables of the properties ExportWidgetToJson writes when they differ from the class default.
+ *
+ * Exporting used to run TFieldIterator over the widget class and its slot class for every widget, testing CPF_Edit,
+ * CPF_Transient and CPF_EditorOnly and comparing names against "Slot", "Content" and "Parent" each time. A plan does
+ * that filtering once per class and keeps the value offset and the class default's value pointer for each surviving
+ * property, so an export only compares values.
+ *
+ * Plans hold raw FProperty and CDO pointers, so the cache is dropped on Blueprint compilation, object reinstancing
+ * and hot reload / live coding; a plan whose class was garbage collected is rebuilt on the next lookup.
+ *
+ * Game thread only. The returned plans are immutable and may be read from other threads while referenced.
+ */
+class UMGMCP_API FUmgExportPlanCache
+{
+public:
+    static FUmgExportPlanCache& Get();
+
+    /** Plan for a widget class (CPF_Edit, non-transient, non-editor-only) or a slot class (CPF_Edit, non-transient, minus Content and Parent). */
+    TSharedRef<const FUmgExportPlan> GetPlan(const UClass* Class);
+
+    /** Drops every plan. */
+    void Invalidate();
+
+    /** Drops every plan and unbinds the invalidation hooks. */
+    void Reset();
+
+private:
+    static TSharedRef<const FUmgExportPlan> BuildPlan(const UClass* Class);
+
+    void BindHooks();
+
+    TMap<const UClass*, TSharedRef<const FUmgExportPlan>> Plans;
+
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle ObjectsReinstancedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
@@ -5,11 +5,105 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
+#include "Async/Future.h"
 #include "UmgFileTransformation.generated.h"
 
 class UWidget;
 class FJsonObject;
 
+/** One widget node of a layout JSON payload. */
+struct FUmgJsonWidgetInfo
+{
+    FString Name;
+    FString ClassPath;
+
+    /** Name of the enclosing JSON node; empty for the payload root, which attaches to the apply target. */
+    FString ParentName;
+};
+
+/**
+ * Layout JSON parsed and checked without touching UObjects, so it can be built on any thread.
+ * Invalid payloads carry ErrorCode / Error and are rejected before the game thread is involved.
+ *
+ * Payloads of StreamingThreshold characters or more are not built into a DOM: they are validated by a streaming scan
+ * and keep their text in SourceText, which the create path reads again one widget at a time.
+ */
+struct UMGMCP_API FUmgPreparedLayout
+{
+    /** Character count from which PrepareLayoutJson streams the payload instead of parsing it into Root. */
+    static constexpr int32 StreamingThreshold = 1024 * 1024;
+
+    /** Parsed payload; null for a streamed one. */
+    TSharedPtr<FJsonObject> Root;
+
+    /** Payload text of a streamed layout; null when Root is set. */
+    TSharedPtr<const FString> SourceText;
+
+    /** widget_name / widget_class of the payload root; empty when it omits them. */
+    FString RootName;
+    FString RootClassPath;
+
+    TMap<FString, FUmgJsonWidgetInfo> Widgets;
+
+    /** Distinct widget_class values, resolved in one batch before anything is mutated. */
+    TArray<FString> ClassPaths;
+
+    FString ErrorCode;
+    FString Error;
+
+    bool IsStreamed() const { return !Root.IsValid() && SourceText.IsValid(); }
+    bool IsValid() const { return (Root.IsValid() || SourceText.IsValid()) && ErrorCode.IsEmpty(); }
+};
+
+/** How ApplyPreparedLayout treats a payload that names widgets already in the tree. */
+enum class EUmgLayoutApplyMode : uint8
+{
+    /** New names are created and existing ones upserted append-only; nothing is removed or moved. */
+    Merge,
+
+    /**
+     * The payload root describes the target widget and its whole subtree, keyed by widget name. Missing widgets are
+     * created, unlisted ones destroyed, misplaced ones moved, and only property values that differ from the live
+     * ones are written. Properties a node omits go back to the class default, matching what an export omits.
+     */
+    Reconcile
+};
+
+/** Outcome of applying layout JSON to a UMG asset. */
+struct UMGMCP_API FUmgApplyJsonResult
+{
+    bool bSuccess = false;
+
+    /** invalid_json, invalid_node, duplicate_name, unknown_class, class_mismatch, parent_mismatch, root_mismatch, asset_unavailable or apply_failed. */
+    FString ErrorCode;
+    FString Error;
+
+    /** Asset that was written, after the active-target / default-workspace fallbacks. */
+    FString AssetPath;
+
+    /** Widget the payload was applied under; empty when it became the root. */
+    FString TargetWidget;
+
+    int32 WidgetCount = 0;
+
+    /** True when the payload named existing widgets and was merged append-only instead of created. */
+    bool bMerged = false;
+    bool bCreatedAsset = false;
+
+    /** Reconcile mode: the tree was diffed against the payload. An unchanged layout reports no changes and leaves the asset clean. */
+    bool bReconciled = false;
+    int32 WidgetsCreated = 0;
+    int32 WidgetsRemoved = 0;
+    int32 WidgetsMoved = 0;
+    int32 PropertiesWritten = 0;
+    int32 WidgetsTouched = 0;
+
+    /** Reconcile mode: widgets were created, removed or moved, or a variable flag changed, so the class is regenerated. */
+    bool bStructuralChange = false;
+
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
 /**
  * @brief Handles the "compilation" and "decompilation" of UMG assets to and from JSON.
  *
@@ -38,8 +132,29 @@ public:
      * This function loads the asset, converts its widget tree to JSON, and returns the JSON string.
      * @param AssetPath The Unreal Engine asset path (e.g., "/Game/MyWidget.MyMyWidget").
      * @return The JSON string representation of the UMG asset, or an empty string if failed.
+     *
+     * The widget tree is read once on the game thread into a snapshot; JSON text is then written from the snapshot
+     * with subtrees serialized in parallel. Called off the game thread, this waits on ExportUmgAssetToJsonStringAsync.
+     * @param bIncludeHashes Adds "hash" (subtree) and "content_hash" (class and properties) to every widget node; a
+     *        stored export with hashes is the baseline DiffUmgAssetAgainstJson compares against.
+     */
+    static FString ExportUmgAssetToJsonString(const FString& AssetPath, const FString& TargetWidgetName = TEXT(""), bool bIncludeHashes = false);
+
+    /**
+     * Same output as ExportUmgAssetToJsonString, but only the snapshot runs on the game thread (scheduled there when
+     * called from elsewhere); serialization happens on a background task and the game thread is released meanwhile.
+     * The future resolves to an empty string when the asset or target widget cannot be found.
      */
-    static FString ExportUmgAssetToJsonString(const FString& AssetPath, const FString& TargetWidgetName = TEXT(""));
+    static TFuture<FString> ExportUmgAssetToJsonStringAsync(const FString& AssetPath, const FString& TargetWidgetName = TEXT(""), bool bIncludeHashes = false);
+
+    /**
+     * Compares an export made with hashes against the live asset. Subtrees whose hash still matches are skipped without
+     * being read further, so the comparison visits only changed paths. Reports widgets that were added, removed,
+     * moved, reordered, renamed (export root only), had their class changed, or were modified (with the changed
+     * property keys). Errors carry error_code missing_hashes or asset_unavailable. Game thread only.
+     * @param TargetWidgetName Widget to compare; defaults to the widget_name of the baseline root.
+     */
+    static TSharedPtr<FJsonObject> DiffUmgAssetAgainstJson(const FString& AssetPath, const TSharedPtr<FJsonObject>& Baseline, const FString& TargetWidgetName = TEXT(""));
 
     /**
      * Applies JSON data to a UMG asset, creating or modifying it.
@@ -47,17 +162,40 @@ public:
      * @param AssetPath The Unreal Engine asset path to create/modify.
      * @param JsonData The JSON string data to apply.
      * @param TargetWidgetName Optional. The name of the specific widget to replace. If empty or "Root", the entire widget tree (RootWidget) is replaced.
-     * @return True if the operation was successful, false otherwise.
+     * @return True if the operation was successful, false otherwise. Runs synchronously on the game thread; other
+     *         threads wait for ApplyJsonStringToUmgAssetAsync.
      */
     static bool ApplyJsonStringToUmgAsset(const FString& AssetPath, const FString& JsonData, const FString& TargetWidgetName = TEXT(""));
 
     /**
-     * Normalizes JSON keys from camelCase to PascalCase to match C++ UPROPERTY names.
-     * This solves the case-sensitivity issue where UE exports JSON with camelCase keys
-     * but JsonObjectToUStruct requires PascalCase to match UPROPERTY names.
-     * 
-     * @param SourceJson The source JSON object with potentially camelCase keys
-     * @return A new JSON object with all keys converted to PascalCase
+     * Parses and validates layout JSON (node fields, duplicate names) without touching UObjects. Safe on any thread;
+     * the bridge runs it on the connection thread so malformed payloads never reach the game-thread queue.
+     * Large payloads are only scanned, not parsed (see FUmgPreparedLayout); pass the text with MoveTemp to keep it
+     * from being copied.
+     */
+    static TSharedRef<FUmgPreparedLayout> PrepareLayoutJson(FString JsonData);
+
+    /** PrepareLayoutJson for a payload that is already parsed. */
+    static TSharedRef<FUmgPreparedLayout> PrepareLayoutJson(const TSharedPtr<FJsonObject>& Root);
+
+    /**
+     * Applies a prepared layout on the game thread. Widget classes are resolved and the payload is checked against
+     * the existing tree (class and parent of every widget it names) before the asset is loaded, created or modified.
+     * In Reconcile mode the parent check is replaced by a containment check: named widgets may move, but only
+     * within the target's subtree. Reconcile on an empty tree creates it as Merge would.
+     */
+    static FUmgApplyJsonResult ApplyPreparedLayout(const FString& AssetPath, const FUmgPreparedLayout& Layout, const FString& TargetWidgetName = TEXT(""), EUmgLayoutApplyMode Mode = EUmgLayoutApplyMode::Merge);
+
+    /**
+     * Awaitable apply: parsing and validation run on the thread pool, the mutation on the game thread, and the future
+     * resolves with the structured result once the tree is ready. Do not block the game thread on the future.
+     */
+    static TFuture<FUmgApplyJsonResult> ApplyJsonStringToUmgAssetAsync(const FString& AssetPath, const FString& JsonData, const FString& TargetWidgetName = TEXT(""));
+
+    /**
+     * Rewrites the keys of JsonObject in place from camelCase (as UE exports them) to the PascalCase UPROPERTY
+     * names JsonObjectToUStruct requires. When OwnerStruct is provided (widget or slot class), keys resolve to the
+     * exact reflected property names through the shared per-class cache in FUmgPropertyPathCache.
      */
-    static TSharedPtr<FJsonObject> NormalizeJsonKeysToPascalCase(const TSharedPtr<FJsonObject>& SourceJson);
+    static void NormalizeJsonKeysInPlace(const TSharedPtr<FJsonObject>& JsonObject, const UStruct* OwnerStruct = nullptr);
 };
\ No newline at end of file
@@ -0,0 +1,34 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "UmgMcpBatchCommandlet.generated.h"
+
+/**
+ * @brief Headless whole-project UMG <-> JSON conversion for build agents.
+ *
+ * Widget blueprints under a package path are listed through the asset registry, so only the assets being converted
+ * are loaded. Each one is exported with UUmgFileTransformation::ExportUmgAssetToJsonString, reconciled from its JSON
+ * file with ApplyPreparedLayout, or verified against the stored file. Assets are processed in batches with a garbage
+ * collection between batches (and earlier when resident memory passes a limit), and a JSON summary with the time spent
+ * on every asset is written at the end.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project>.uproject -run=UmgMcpBatch -Mode=export|apply|verify -Path=/Game/UI
+ *       [-Dir=<json root>] [-Summary=<file>] [-BatchSize=32] [-MemoryLimitMB=0] [-NoHashes] -unattended -nullrhi
+ *
+ * JSON files live at <Dir>/<package path>.json (default Dir: <Project>/Saved/UmgMcp/Json). Export writes them with
+ * subtree hashes unless -NoHashes; verify compares hashed files through DiffUmgAssetAgainstJson and plain ones as text.
+ * Apply saves only the assets whose tree actually changed. Returns non-zero when any asset failed, or differs in verify.
+ */
+UCLASS()
+class UMGMCP_API UUmgMcpBatchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UUmgMcpBatchCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -17,5 +17,15 @@
 class FUmgMcpFileTransformationCommands
 {
 public:
-    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+    /** PreparedLayout, when set, is the layout payload PrepareCommand already parsed; it is applied as is. */
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+        const TSharedPtr<FUmgPreparedLayout>& PreparedLayout = nullptr);
+
+    /**
+     * Runs the UObject-free part of a layout command (parse and validate) on the calling thread. On success the
+     * layout string is moved out of Params into OutLayout and nullptr is returned; an invalid payload returns the
+     * failure result without touching Params. Other commands are left alone.
+     */
+    static TSharedPtr<FJsonObject> PrepareCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+        TSharedPtr<FUmgPreparedLayout>& OutLayout);
 };
\ No newline at end of file
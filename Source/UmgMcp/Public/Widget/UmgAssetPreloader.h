@@ -0,0 +1,60 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class FJsonObject;
+class FJsonValue;
+struct FStreamableHandle;
+
+/**
+ * @brief Streams in the assets a command refers to before the command mutates anything.
+ *
+ * Property payloads name textures, fonts and materials by object path ("/Game/UI/T_Icon.T_Icon"). Those used to be
+ * resolved with LoadObject while the command ran, so a themed layout with dozens of brushes paid for each package
+ * load in series on the game thread. The bridge now hands the parameters of property-carrying commands to
+ * PreloadCommandAssets first; it collects every object path (including inside embedded layout JSON strings), skips
+ * the ones already in memory and requests the rest through FStreamableManager. The command runs from the completion
+ * callback, by which point the property writers find the objects in memory.
+ *
+ * Resolved paths are cached as weak pointers. ResolveObjectPath is the lookup the property writers use; it still
+ * falls back to a synchronous load for paths that were not preloaded (direct game-thread callers, unlisted commands).
+ *
+ * Game thread only.
+ */
+class UMGMCP_API FUmgAssetPreloader
+{
+public:
+    static FUmgAssetPreloader& Get();
+
+    /**
+     * Starts async loads for the assets referenced by Params. Returns false when nothing needs loading, in which case
+     * OnReady is not called and the caller proceeds immediately; otherwise OnReady runs on the game thread once every
+     * requested load has finished, successfully or not. OnReady also runs, exactly once, when the load is canceled or
+     * has not finished after PreloadTimeoutSeconds.
+     */
+    bool PreloadCommandAssets(const TSharedPtr<FJsonObject>& Params, TFunction<void()>&& OnReady);
+
+    /** Object for an asset path, from the cache, memory or (last resort) a synchronous load. */
+    UObject* ResolveObjectPath(const FString& ObjectPath);
+
+    /** Appends every asset object path found in Value. Bare package paths are expanded to Package.AssetName. */
+    static void CollectObjectPaths(const TSharedPtr<FJsonValue>& Value, TArray<FSoftObjectPath>& OutPaths);
+
+    /** Cancels pending loads, which runs their OnReady callbacks, and drops the cache. */
+    void Reset();
+
+    /** Upper bound on cached paths; the cache is cleared when it is reached. */
+    static constexpr int32 MaxCachedPaths = 4096;
+
+    /** Time a command waits for its preload before the load is canceled and the command runs anyway. */
+    static constexpr float PreloadTimeoutSeconds = 30.0f;
+
+private:
+    void CacheResolved(const FSoftObjectPath& Path, UObject* Object);
+
+    TMap<FSoftObjectPath, TWeakObjectPtr<UObject>> ResolvedPaths;
+    TArray<TSharedPtr<FStreamableHandle>> PendingHandles;
+};
@@ -3,8 +3,49 @@
 
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Layout/SlateRect.h"
+#include "Widget/UmgHeadlessLayout.h"
 #include "UmgGetSubsystem.generated.h"
 
+class FJsonObject;
+class FJsonValue;
+class UWidgetBlueprint;
+
+/** Bounds for one get_widget_tree read. Zero means unlimited. */
+struct FUmgWidgetTreeReadOptions
+{
+	/** Deepest level printed, counting the start widget as 1. Panels at this level are collapsed to a child count. */
+	int32 MaxDepth = 0;
+
+	/** Maximum number of widget lines in one page. */
+	int32 MaxNodes = 0;
+
+	/** Continuation token returned as NextCursor by the previous page. */
+	FString Cursor;
+};
+
+/** Two widgets whose layout rects overlap, excluding ancestor/descendant pairs. */
+struct FUmgWidgetOverlap
+{
+	FString WidgetA;
+	FString WidgetB;
+	FSlateRect Intersection;
+	double Area = 0.0;
+};
+
+/** One page of a bounded widget tree read. */
+struct FUmgWidgetTreePage
+{
+	FString Tree;
+
+	/** Non-empty when MaxNodes stopped the read early; pass back as FUmgWidgetTreeReadOptions::Cursor. */
+	FString NextCursor;
+
+	int32 NodeCount = 0;
+	int32 CollapsedSubtrees = 0;
+};
+
 // Define a log category for easy debugging.
 DECLARE_LOG_CATEGORY_EXTERN(LogUmgGet, Log, All);
 
@@ -45,4 +86,74 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "UMG MCP|Get")
 	FString GetWidgetSchema(const FString& WidgetType);
+
+	/**
+	 * Lays the blueprint out at every requested resolution through FUmgHeadlessLayout. When the headless pass cannot
+	 * run, a single-resolution request falls back to the designer's live geometry (bHeadless = false).
+	 */
+	bool EvaluateLayout(UWidgetBlueprint* WidgetBlueprint, TConstArrayView<FUmgLayoutResolution> Resolutions, TArray<FUmgLayoutResult>& OutResults, FString& OutError);
+
+	/** Serializes one layout result in the get_layout_data row format. */
+	static TArray<TSharedPtr<FJsonValue>> LayoutResultToJson(UWidgetBlueprint* WidgetBlueprint, const FUmgLayoutResult& Result);
+
+	/**
+	 * Lays the blueprint out at every sample in one headless pass and returns the layout_sweep payload: the samples
+	 * as width/height/dpi_scale columns, and per widget one left/top/right/bottom array indexed by sample. A widget
+	 * that is missing from a sample has null in that column.
+	 */
+	bool EvaluateLayoutSweep(UWidgetBlueprint* WidgetBlueprint, TConstArrayView<FUmgLayoutResolution> Samples, TSharedPtr<FJsonObject>& OutSweep, FString& OutError);
+
+	/**
+	 * Finds every overlapping pair among WidgetIds (widget names or object paths; empty means all widgets) in the
+	 * layout at Resolution. Widgets without layout geometry are listed in OutUnmeasured. Returns false with OutError
+	 * for unknown ids.
+	 */
+	bool CollectWidgetOverlaps(UWidgetBlueprint* WidgetBlueprint, const TArray<FString>& WidgetIds, const FUmgLayoutResolution& Resolution, TArray<FUmgWidgetOverlap>& OutOverlaps, TArray<FString>& OutUnmeasured, FString& OutError);
+
+	/**
+	 * Bounded variant of GetWidgetTree for very large assets. Returns false with OutError when the cursor is
+	 * malformed or was issued for another start widget or an older revision of the tree.
+	 */
+	bool GetWidgetTreePage(UWidgetBlueprint* WidgetBlueprint, const FString& StartWidgetName, const FUmgWidgetTreeReadOptions& Options, FUmgWidgetTreePage& OutPage, FString& OutError);
+
+	/**
+	 * Structural revision of the blueprint's widget tree (see FUmgWidgetIndexCache::GetRevision).
+	 * The tree shape at the returned revision is retained so a later GetWidgetTreeDelta can diff against it.
+	 */
+	int64 GetWidgetTreeRevision(class UWidgetBlueprint* WidgetBlueprint);
+
+	/**
+	 * Builds the inserted / removed / moved / renamed nodes between SinceRevision and the current revision.
+	 * Returns false when SinceRevision was never reported for this blueprint or has aged out of the retained history;
+	 * callers should fall back to a full GetWidgetTree read.
+	 */
+	bool GetWidgetTreeDelta(class UWidgetBlueprint* WidgetBlueprint, int64 SinceRevision, TSharedPtr<FJsonObject>& OutDelta);
+
+private:
+	struct FTreeSnapshotNode
+	{
+		FObjectKey Widget;
+		FObjectKey Parent;
+		FName Name;
+		FName ClassName;
+		int32 ChildIndex = INDEX_NONE;
+	};
+
+	struct FTreeSnapshot
+	{
+		int64 Revision = 0;
+		TArray<FTreeSnapshotNode> Nodes;
+	};
+
+	/** Serialized tree pages and shape snapshots of one blueprint. Serialized pages are only valid for Revision. */
+	struct FBlueprintTreeCache
+	{
+		int64 Revision = 0;
+		TMap<FString, FUmgWidgetTreePage> TreesByKey;
+		TArray<FTreeSnapshot> Snapshots;
+	};
+
+	FBlueprintTreeCache& GetTreeCache(UWidgetBlueprint* WidgetBlueprint, int64 Revision);
+
+	TMap<TObjectKey<UWidgetBlueprint>, FBlueprintTreeCache> TreeCaches;
 };
@@ -0,0 +1,59 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Layout/SlateRect.h"
+
+class UWidgetBlueprint;
+
+/** One viewport to lay a widget blueprint out in. Width and Height are physical pixels. */
+struct FUmgLayoutResolution
+{
+    int32 Width = 1920;
+    int32 Height = 1080;
+    float DpiScale = 1.0f;
+};
+
+struct FUmgLayoutRect
+{
+    FString WidgetName;
+
+    /** Bounding rect in viewport pixels. */
+    FSlateRect Rect;
+
+    bool bVisible = true;
+};
+
+struct FUmgLayoutResult
+{
+    FUmgLayoutResolution Resolution;
+    TArray<FUmgLayoutRect> Rects;
+
+    /** False when the rects were read from the designer's live widgets instead of a headless layout pass. */
+    bool bHeadless = true;
+};
+
+/**
+ * @brief Computes widget geometry for a UWidgetBlueprint without opening it in the designer or rendering a frame.
+ *
+ * The blueprint's WidgetTree is duplicated into the transient package, so uncompiled edits are included and the
+ * asset itself is never touched. The copy's Slate hierarchy is built once with TakeWidget(). For each requested
+ * viewport the root is laid out as a full-screen widget: SlatePrepass computes desired sizes at the DPI scale, then
+ * ArrangeChildren is walked from a root geometry of Width x Height pixels. Nothing is painted, so this also runs in an
+ * editor started with -nullrhi.
+ *
+ * Resolutions are evaluated grouped by DPI scale: the prepass runs once per distinct scale in a batch, and repeated
+ * viewports are arranged only once. The prepass is top-down, so a desired size never sees the geometry it is later
+ * given. Content whose desired size depends on its allotted width -- auto-wrapping text, rich text -- is therefore
+ * measured unwrapped (its single-line extent) at every viewport, and anything sized from it (a size box or a
+ * vertical box of wrapped paragraphs) is too. Fill and stretch slots are unaffected, as ArrangeChildren distributes
+ * the viewport to them. Treat heights that depend on wrapping as lower bounds.
+ *
+ * Game thread only.
+ */
+class UMGMCP_API FUmgHeadlessLayout
+{
+public:
+    /** Fills OutResults in the same order as Resolutions. Returns false with OutError when layout cannot run. */
+    static bool Evaluate(UWidgetBlueprint* WidgetBlueprint, TConstArrayView<FUmgLayoutResolution> Resolutions, TArray<FUmgLayoutResult>& OutResults, FString& OutError);
+};
@@ -0,0 +1,127 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/** How a compiled property path reads and writes its leaf value. */
+enum class EUmgPropertyAccessKind : uint8
+{
+    /** Exotic leaf type; values go through FJsonObjectConverter. */
+    Converter,
+    Bool,
+    Numeric,
+    Enum,
+    Object,
+    LinearColor,
+    Color,
+    Margin,
+    Vector2D,
+    Vector
+};
+
+/**
+ * Result of resolving one raw JSON key (possibly dotted, e.g. "slot.padding.left") against an owner struct.
+ */
+struct UMGMCP_API FUmgResolvedPropertyKey
+{
+    /** Key with every segment normalized; resolved segments use the reflected property name verbatim. */
+    FString NormalizedKey;
+
+    /** Properties for the leading segments that could be resolved. Shorter than the segment count when resolution stopped early. */
+    TArray<FProperty*, TInlineAllocator<4>> PropertyChain;
+
+    /** Number of '.'-separated, non-empty segments in the raw key. */
+    int32 SegmentCount = 0;
+
+    /** Struct or class that owns the fields of a JSON object stored under this key, or nullptr when unknown. */
+    const UStruct* ValueOwner = nullptr;
+
+    /** Byte offset of the leaf value from the start of the container. Only set when every hop before the leaf is an inline struct. */
+    int32 LeafOffset = INDEX_NONE;
+
+    /** Typed fast path selected for the leaf property. */
+    EUmgPropertyAccessKind AccessKind = EUmgPropertyAccessKind::Converter;
+
+    bool IsFullyResolved() const { return SegmentCount > 0 && PropertyChain.Num() == SegmentCount; }
+    bool HasDirectAccess() const { return LeafOffset != INDEX_NONE; }
+    FProperty* GetLeafProperty() const { return IsFullyResolved() ? PropertyChain.Last() : nullptr; }
+};
+
+/**
+ * @brief Process-wide cache that maps (owner struct, raw JSON key) to a normalized key and the reflected property chain.
+ *
+ * The same entry doubles as a compiled property-path accessor: when the chain only crosses inline structs
+ * (e.g. "LayoutData.Offsets.Left" on a canvas slot), the leaf's byte offset is folded at resolve time and
+ * ReadJsonValue / WriteJsonValue touch memory directly through typed paths for numeric, bool, enum, object,
+ * color, margin and vector leaves. Anything else falls back to FJsonObjectConverter on the leaf only.
+ *
+ * Key normalization used to split every key on '.', consult GetPropertyNameMappings() and fix up casing on every
+ * SetWidgetProperties call and for every widget applied from JSON. Keys repeat heavily across widgets of the same
+ * class, so the result is computed once per (UStruct, key) pair and reused.
+ *
+ * Entries hold raw FProperty pointers, so the cache is flushed whenever classes can be regenerated: Blueprint
+ * compilation, object reinstancing and hot reload / live coding. UUmgSetSubsystem owns the hook registration.
+ * Entries are immutable and handed out as shared references, so one a caller holds survives a flush; its property
+ * pointers are only meaningful while the class it was resolved against is alive, so re-resolve after anything that
+ * may compile a Blueprint. Tables are keyed by FObjectKey, so a freed class whose address is reused never sees the
+ * old entries. The table is guarded by a reader/writer lock, which makes ResolveKey callable from any thread.
+ */
+class UMGMCP_API FUmgPropertyPathCache
+{
+public:
+    static FUmgPropertyPathCache& Get();
+
+    /**
+     * Resolves a raw key against OwnerStruct. OwnerStruct may be nullptr, in which case only the
+     * name mapping table and the leading-capital rule are applied.
+     */
+    TSharedRef<const FUmgResolvedPropertyKey> ResolveKey(const UStruct* OwnerStruct, FStringView RawKey);
+
+    /**
+     * Rewrites the keys of JsonObject (and nested objects / arrays of objects) to their normalized form without
+     * copying the tree. OwnerStruct, when provided, lets keys resolve to the exact reflected property names.
+     */
+    void NormalizeJsonKeysInPlace(const TSharedPtr<FJsonObject>& JsonObject, const UStruct* OwnerStruct);
+
+    /**
+     * Writes Value into the leaf of a compiled path. Container must be an instance of the struct the path was
+     * resolved against. Returns false when the path has no direct access or the value could not be applied.
+     */
+    static bool WriteJsonValue(const FUmgResolvedPropertyKey& Path, void* Container, const TSharedPtr<FJsonValue>& Value);
+
+    /** Reads the leaf of a compiled path in the same JSON shape FJsonObjectConverter::UPropertyToJsonValue produces. */
+    static TSharedPtr<FJsonValue> ReadJsonValue(const FUmgResolvedPropertyKey& Path, const void* Container);
+
+    /** Drops every cached entry. */
+    void Invalidate();
+
+    void RegisterInvalidationHooks();
+    void UnregisterInvalidationHooks();
+
+private:
+    using FEntryRef = TSharedRef<const FUmgResolvedPropertyKey>;
+
+    struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, FEntryRef>, FString, false>
+    {
+        static const FString& GetSetKey(const TPair<FString, FEntryRef>& Element) { return Element.Key; }
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static bool Matches(const FString& A, FStringView B) { return FStringView(A).Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return GetTypeHash(FStringView(Key)); }
+        static uint32 GetKeyHash(FStringView Key) { return GetTypeHash(Key); }
+    };
+
+    using FKeyTable = TMap<FString, FEntryRef, FDefaultSetAllocator, FCaseSensitiveKeyFuncs>;
+
+    static FUmgResolvedPropertyKey BuildResolvedKey(const UStruct* OwnerStruct, FStringView RawKey);
+
+    FRWLock Lock;
+    TMap<FObjectKey, FKeyTable> Tables;
+
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle ObjectsReinstancedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
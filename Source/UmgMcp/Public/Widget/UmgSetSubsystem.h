@@ -5,8 +5,25 @@
 #include "EditorSubsystem.h"
 #include "UmgSetSubsystem.generated.h"
 
+class FJsonValue;
+
 DECLARE_LOG_CATEGORY_EXTERN(LogUmgSet, Log, All);
 
+/** How a property edit was committed to the blueprint. */
+enum class EUmgModificationPath : uint8
+{
+    /** Values only: the blueprint is marked modified and the open designer preview is patched in place. */
+    Property,
+
+    /** The edit renamed a widget or changed whether it is a variable: skeleton regeneration and a full preview rebuild. */
+    Structural
+};
+
+inline const TCHAR* LexToString(EUmgModificationPath Path)
+{
+    return Path == EUmgModificationPath::Property ? TEXT("property") : TEXT("structural");
+}
+
 /**
  * @brief Provides "action" capabilities for the AI to modify UMG assets.
  *
@@ -41,9 +58,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "UMG MCP|Set")
     bool SetWidgetProperties(class UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName, const FString& PropertiesJson);
 
+    /**
+     * SetWidgetProperties that also reports how the edit was committed. Value-only edits take the property path,
+     * which skips skeleton class regeneration and copies just the touched properties onto the designer preview.
+     */
+    bool SetWidgetProperties(class UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName, const FString& PropertiesJson, EUmgModificationPath& OutPath);
+
+    /**
+     * Mirrors a value-only edit onto the open designer's preview widget instead of rebuilding the whole preview:
+     * the listed properties of TemplateWidget and its slot are copied across. Falls back to RefreshPreview when the
+     * preview widget cannot be patched in place; does nothing when no widget editor has the asset open.
+     */
+    static void SyncDesignerPreview(class UWidgetBlueprint* WidgetBlueprint, class UWidget* TemplateWidget, TConstArrayView<FProperty*> WidgetProperties, TConstArrayView<FProperty*> SlotProperties);
+
     UFUNCTION(BlueprintCallable, Category = "UMG MCP|Set")
     FString CreateWidget(class UWidgetBlueprint* WidgetBlueprint, const FString& ParentName, const FString& WidgetType, const FString& WidgetName);
 
+    /**
+     * Creates a nested widget subtree under ParentName (empty: active widget scope, then root) in one pass.
+     *
+     * Spec is one node or an array of sibling nodes, each {"class", "name"?, "properties"?, "slot"?, "children"?}.
+     * Properties and slot use the set_widget_properties format. The whole spec is validated (classes, name
+     * collisions, panel capacity) before anything is constructed, GUIDs are registered in one pass and the
+     * blueprint is marked structurally modified once. OutCreatedWidgets lists the new widgets in pre-order.
+     */
+    bool CreateWidgetSubtree(class UWidgetBlueprint* WidgetBlueprint, const FString& ParentName, const TSharedPtr<FJsonValue>& Spec, TArray<FString>& OutCreatedWidgets, FString& OutError);
+
     UFUNCTION(BlueprintCallable, Category = "UMG MCP|Set")
     bool DeleteWidget(class UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName);
 
@@ -52,7 +92,8 @@ public:
      *
      * This is a union-style structural write: listed siblings are moved into the requested order,
      * unlisted siblings keep their relative order, and missing names are reported as warnings
-     * without deleting or creating widgets.
+     * without deleting or creating widgets. Only children outside the longest run already in the
+     * requested relative order are moved, so OutReorderedWidgets lists the minimal set of moves.
      */
     bool ReorderWidgetTree(class UWidgetBlueprint* WidgetBlueprint, const FString& RootName, const FString& TreeSpec, TArray<FString>& OutReorderedWidgets, TArray<FString>& OutWarnings, FString& OutError);
 
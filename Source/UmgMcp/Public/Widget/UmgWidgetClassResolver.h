@@ -0,0 +1,63 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+struct FAssetData;
+
+/**
+ * @brief Maps the widget type strings accepted by the MCP commands to a UClass, with caching.
+ *
+ * A type can be a short class name ("Button"), the C++ spelling ("UButton"), a class path ("/Script/UMG.Button",
+ * "/Game/UI/WBP_Card.WBP_Card_C") or a Blueprint asset path ("/Game/UI/WBP_Card"). Resolving one used to try every
+ * variant with FindObject and then LoadObject, so a bulk create of an unknown or misspelled type paid several failed
+ * package loads per widget.
+ *
+ * Hits are cached as weak pointers and re-resolved once the class is garbage collected or replaced by a recompile.
+ * Misses are cached for NegativeTtlSeconds. The whole cache is dropped when a module loads or unloads and after hot
+ * reload. When the asset registry adds, removes or renames a Blueprint only the misses are dropped, since that can
+ * make a missing class appear while hits stay valid through their weak pointers. Additions are ignored while the
+ * registry is still scanning, which reports every asset on disk; misses from that window expire through the TTL.
+ *
+ * Game thread only.
+ */
+class UMGMCP_API FUmgWidgetClassResolver
+{
+public:
+    static FUmgWidgetClassResolver& Get();
+
+    /** Returns the class for WidgetType, or nullptr when no variant resolves. */
+    UClass* Resolve(const FString& WidgetType);
+
+    /** Drops every cached result. */
+    void Invalidate();
+
+    /** Drops every cached result and unbinds the invalidation hooks. */
+    void Reset();
+
+    static constexpr double NegativeTtlSeconds = 10.0;
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<UClass> Class;
+
+        /** For misses: FPlatformTime::Seconds() after which the type is tried again. */
+        double RetryAfter = 0.0;
+    };
+
+    static UClass* ResolveUncached(const FString& WidgetType);
+
+    void BindHooks();
+    void HandleAssetChanged(const FAssetData& AssetData);
+    void HandleAssetAdded(const FAssetData& AssetData);
+
+    TMap<FString, FEntry> Entries;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -0,0 +1,80 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+class UWidget;
+class UWidgetBlueprint;
+class UWidgetTree;
+
+/**
+ * @brief Per-UWidgetBlueprint lookup tables: widget name -> widget and panel -> children.
+ *
+ * Widget commands used to call WidgetTree->FindWidget(), which walks the whole tree, several times per request.
+ * The index is built lazily on first lookup and then answers name and child queries in O(1).
+ *
+ * An index is dropped when the blueprint broadcasts OnChanged or OnCompiled, and whenever one of the plugin's own
+ * structural mutations calls Invalidate(). Name hits are checked against the widget's current name and tree, so a
+ * widget renamed outside those paths is never returned under its old name.
+ *
+ * Every invalidation also bumps the blueprint's structural revision. Revisions come from one process-wide counter, so a
+ * revision number never repeats across blueprints or across an index being dropped and rebuilt. A lookup that finds
+ * the index out of date on its own (stale hit, confirmed miss, replaced tree) rebuilds it under a new revision too.
+ * Undo/redo of widget objects is caught through OnObjectTransacted, since it does not always broadcast OnChanged.
+ *
+ * Game thread only.
+ */
+class UMGMCP_API FUmgWidgetIndexCache
+{
+public:
+    static FUmgWidgetIndexCache& Get();
+
+    /** O(1) replacement for WidgetTree->FindWidget(Name). */
+    UWidget* FindWidget(UWidgetBlueprint* WidgetBlueprint, FName WidgetName);
+    UWidget* FindWidget(UWidgetBlueprint* WidgetBlueprint, const FString& WidgetName);
+
+    /** Direct children of Parent in slot order. Returns false when Parent is not an indexed panel. */
+    bool GetChildren(UWidgetBlueprint* WidgetBlueprint, const UWidget* Parent, TArray<UWidget*>& OutChildren);
+
+    /** Every widget in the tree in ForEachWidget order (same as WidgetTree->GetAllWidgets). */
+    void GetAllWidgets(UWidgetBlueprint* WidgetBlueprint, TArray<UWidget*>& OutWidgets);
+
+    /** Current structural revision of the blueprint's widget tree. Returns 0 for an invalid blueprint. */
+    int64 GetRevision(UWidgetBlueprint* WidgetBlueprint);
+
+    /** Drops the index of one blueprint and bumps its revision. Call after any structural change made by the plugin. */
+    void Invalidate(const UWidgetBlueprint* WidgetBlueprint);
+
+    /** Drops every index and unbinds blueprint delegates. */
+    void Reset();
+
+private:
+    struct FBlueprintIndex
+    {
+        TWeakObjectPtr<UWidgetBlueprint> Blueprint;
+        TWeakObjectPtr<UWidgetTree> IndexedTree;
+        TMap<FName, TWeakObjectPtr<UWidget>> WidgetsByName;
+        TMap<TObjectKey<UWidget>, TArray<TWeakObjectPtr<UWidget>>> ChildrenByParent;
+        TArray<TWeakObjectPtr<UWidget>> AllWidgets;
+        int64 Revision = 0;
+        bool bBuilt = false;
+        FDelegateHandle ChangedHandle;
+        FDelegateHandle CompiledHandle;
+    };
+
+    FBlueprintIndex* GetOrBuildIndex(UWidgetBlueprint* WidgetBlueprint);
+    void BuildIndex(FBlueprintIndex& Index, UWidgetBlueprint* WidgetBlueprint);
+
+    /** BuildIndex for a change the cache was not told about; bumps the revision like Invalidate does. */
+    void RebuildStaleIndex(FBlueprintIndex& Index, UWidgetBlueprint* WidgetBlueprint);
+    void HandleBlueprintChanged(UBlueprint* Blueprint);
+    void HandleObjectTransacted(UObject* Object, const class FTransactionObjectEvent& Event);
+    void UnbindDelegates(FBlueprintIndex& Index);
+
+    TMap<TObjectKey<UWidgetBlueprint>, FBlueprintIndex> Indices;
+    int64 RevisionCounter = 0;
+    FDelegateHandle ObjectTransactedHandle;
+};
@@ -0,0 +1,115 @@
+// Copyright (c) 2025-2026 Winyunq. All rights reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class FJsonObject;
+struct FAssetData;
+
+/** One UWidget subclass known to the schema index. */
+struct FUmgWidgetClassInfo
+{
+    /** Short class name without prefix, e.g. "Button" or "WBP_MainMenu_C". */
+    FName ClassName;
+
+    /** Full object path, e.g. "/Script/UMG.Button" or "/Game/UI/WBP_MainMenu.WBP_MainMenu_C". */
+    FString ClassPath;
+
+    FString ParentClassPath;
+
+    bool bNative = true;
+    bool bAbstract = false;
+    bool bPanel = false;
+};
+
+/**
+ * @brief In-memory catalogue of every UWidget subclass and its editable-property schema.
+ *
+ * get_widget_schema used to resolve the class with FindObject / LoadObject and walk TFieldIterator, calling
+ * GetToolTipText for every property, on every request. The index is built once after editor startup and then answers
+ * get_widget_schema and list_widget_classes with a map lookup.
+ *
+ * Native classes come from the loaded UClass set. Blueprint-derived widget classes come from the asset registry tags
+ * of UWidgetBlueprint assets, so listing them never loads a package. Reflection data is only safe to read on the game
+ * thread, so the build is spread over editor ticks within a small per-tick budget instead of running on a worker; a
+ * lookup that arrives before its class is processed builds that one schema on demand.
+ *
+ * The native half is rebuilt after hot reload / live coding, Blueprint entries follow asset add / remove / rename,
+ * and cached Blueprint schemas are dropped whenever a Blueprint compiles. UUmgGetSubsystem owns Start / Stop.
+ *
+ * Game thread only.
+ */
+class UMGMCP_API FUmgWidgetSchemaIndex
+{
+public:
+    static FUmgWidgetSchemaIndex& Get();
+
+    /** Binds refresh hooks and schedules the initial build. Blueprint classes are added once the asset registry scan ends. */
+    void Start();
+    void Stop();
+
+    /**
+     * Schema of a widget class addressed by short name ("Button"), prefixed name ("UButton") or object path.
+     * Classes missing from the index are resolved with FindObject / LoadObject and added. Returns nullptr when no
+     * such class exists. The returned object is shared and must not be modified.
+     */
+    TSharedPtr<const FJsonObject> FindSchema(const FString& WidgetType);
+
+    /** Every indexed widget class, in class-name order. Pointers are valid until the index next changes. */
+    void GetClasses(TArray<const FUmgWidgetClassInfo*>& OutClasses);
+
+    /** True once the initial build has processed every class. */
+    bool IsReady() const { return bNativeScanned && bBlueprintsScanned && PendingSchemas.Num() == 0; }
+
+    /** Bumped on every rebuild or Blueprint entry change. */
+    int64 GetGeneration() const { return Generation; }
+
+private:
+    struct FClassEntry
+    {
+        FUmgWidgetClassInfo Info;
+        TWeakObjectPtr<UClass> Class;
+        TSharedPtr<const FJsonObject> Schema;
+    };
+
+    static TSharedPtr<const FJsonObject> BuildSchema(const UClass* WidgetClass);
+
+    void ScanNativeClasses();
+    void ScanBlueprintClasses();
+    FClassEntry& AddClassEntry(FUmgWidgetClassInfo&& Info, UClass* Class);
+    void AddBlueprintEntry(const FAssetData& AssetData);
+    void RemoveClassEntry(const FString& ClassPath);
+    FClassEntry* FindEntry(const FString& WidgetType);
+    void ResetEntries();
+    void ScheduleTick();
+    bool Tick(float DeltaTime);
+
+    void HandleAssetAdded(const FAssetData& AssetData);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void HandleBlueprintCompiled();
+    void HandleReloadComplete();
+
+    // Entries are heap-allocated so the name table and GetClasses results can point at them.
+    TMap<FString, TUniquePtr<FClassEntry>> EntriesByPath;
+    TMap<FName, FClassEntry*> EntriesByName;
+    TArray<const FUmgWidgetClassInfo*> SortedClasses;
+    bool bSortedClassesDirty = true;
+
+    /** Native entry paths whose schema still has to be built by Tick. */
+    TArray<FString> PendingSchemas;
+
+    bool bStarted = false;
+    bool bNativeScanned = false;
+    bool bBlueprintsScanned = false;
+    int64 Generation = 0;
+
+    FTSTicker::FDelegateHandle TickHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};